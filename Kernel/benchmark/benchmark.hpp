@@ -0,0 +1,211 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/utility.hpp"
+#include "kernel/interface/version.hpp"
+
+#if WINDOWS
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace Sen::Kernel::Benchmark {
+
+	/**
+	 * One measured benchmark
+	 * bytes: input size processed by a single run, 0 when throughput does not apply
+	 * peak_memory: peak resident set size in bytes while the benchmark ran
+	*/
+
+	struct Result {
+
+		std::string name;
+
+		std::size_t iteration;
+
+		double fastest;
+
+		double average;
+
+		std::size_t bytes;
+
+		std::size_t peak_memory;
+
+	};
+
+	// every measured result, in run order
+
+	inline static auto result_list = std::vector<Result>{};
+
+	// only benchmarks whose name contains the filter are run
+
+	inline static auto filter = std::string{};
+
+	/**
+	 * Reset the peak resident set size so it reflects the next benchmark only
+	 * The kernel only allow it on Linux, elsewhere the peak is the process peak
+	*/
+
+	inline static auto reset_peak_memory(
+	) -> void
+	{
+		#if LINUX && !ANDROID
+		auto file = std::unique_ptr<FILE, decltype(FileSystem::close_file)>(std::fopen("/proc/self/clear_refs", "w"), FileSystem::close_file);
+		if (file != nullptr) {
+			std::fputs("5", file.get());
+		}
+		#endif
+		return;
+	}
+
+	// return: peak resident set size in bytes
+
+	inline static auto peak_memory(
+	) -> std::size_t
+	{
+		#if WINDOWS
+		auto counter = PROCESS_MEMORY_COUNTERS{};
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counter, sizeof(counter)) == 0) {
+			return 0_size;
+		}
+		return static_cast<std::size_t>(counter.PeakWorkingSetSize);
+		#else
+		#if LINUX && !ANDROID
+		auto file = std::ifstream{"/proc/self/status"};
+		for (auto line = std::string{}; std::getline(file, line);) {
+			if (line.starts_with("VmHWM:")) {
+				return static_cast<std::size_t>(std::stoull(line.substr(6))) * 1024_size;
+			}
+		}
+		#endif
+		auto usage = rusage{};
+		getrusage(RUSAGE_SELF, &usage);
+		#if MACINTOSH
+		return static_cast<std::size_t>(usage.ru_maxrss);
+		#else
+		return static_cast<std::size_t>(usage.ru_maxrss) * 1024_size;
+		#endif
+		#endif
+	}
+
+	/**
+	 * Run the callback iteration times and print the fastest and the average run
+	 * name: benchmark name
+	 * iteration: how many times the callback run
+	 * bytes: input size of a single run, used for the throughput
+	 * callback: the measured work
+	*/
+
+	template <typename Callback>
+	inline static auto measure(
+		std::string_view name,
+		std::size_t iteration,
+		std::size_t bytes,
+		const Callback & callback
+	) -> void
+	{
+		if (!filter.empty() && name.find(filter) == std::string_view::npos) {
+			return;
+		}
+		reset_peak_memory();
+		auto fastest = std::numeric_limits<double>::max();
+		auto total = 0.0;
+		for (auto i : Range<std::size_t>(iteration)) {
+			auto before = std::chrono::steady_clock::now();
+			callback();
+			auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - before).count();
+			fastest = std::min(fastest, elapsed);
+			total += elapsed;
+		}
+		auto result = Result{
+			.name = std::string{name},
+			.iteration = iteration,
+			.fastest = fastest,
+			.average = total / static_cast<double>(iteration),
+			.bytes = bytes,
+			.peak_memory = peak_memory(),
+		};
+		auto throughput = bytes == 0_size ? std::string{} : fmt::format(", {:>10.2f} MiB/s", static_cast<double>(bytes) / 1048576.0 / (fastest / 1000.0));
+		std::cout << fmt::format("{:<48} fastest {:>10.3f} ms, average {:>10.3f} ms{}, peak {:>8.1f} MiB", name, result.fastest, result.average, throughput, static_cast<double>(result.peak_memory) / 1048576.0) << '\n' << std::flush;
+		result_list.emplace_back(std::move(result));
+		return;
+	}
+
+	template <typename Callback>
+	inline static auto measure(
+		std::string_view name,
+		std::size_t iteration,
+		const Callback & callback
+	) -> void
+	{
+		measure(name, iteration, 0_size, callback);
+		return;
+	}
+
+	/**
+	 * Write every result as json, so runs of different kernel versions can be compared
+	 * destination: report path
+	*/
+
+	inline static auto write_report(
+		std::string_view destination
+	) -> void
+	{
+		auto writer = Definition::JsonWriter{};
+		writer.WriteIndent = true;
+		writer.WriteStartObject();
+		writer.WritePropertyName(std::string{"kernel_version"});
+		writer.WriteValue(Sen::Kernel::version);
+		writer.WritePropertyName(std::string{"result"});
+		writer.WriteStartArray();
+		for (auto & result : result_list) {
+			writer.WriteStartObject();
+			writer.WritePropertyName(std::string{"name"});
+			writer.WriteValue(result.name);
+			writer.WritePropertyName(std::string{"iteration"});
+			writer.WriteValue(result.iteration);
+			writer.WritePropertyName(std::string{"fastest_ms"});
+			writer.WriteValue(result.fastest);
+			writer.WritePropertyName(std::string{"average_ms"});
+			writer.WriteValue(result.average);
+			writer.WritePropertyName(std::string{"bytes"});
+			writer.WriteValue(result.bytes);
+			writer.WritePropertyName(std::string{"throughput_mib_per_second"});
+			if (result.bytes == 0_size) {
+				writer.WriteNull();
+			}
+			else {
+				writer.WriteValue(static_cast<double>(result.bytes) / 1048576.0 / (result.fastest / 1000.0));
+			}
+			writer.WritePropertyName(std::string{"peak_memory"});
+			writer.WriteValue(result.peak_memory);
+			writer.WriteEndObject();
+		}
+		writer.WriteEndArray();
+		writer.WriteEndObject();
+		FileSystem::write_file(destination, writer.ToString());
+		return;
+	}
+
+	/**
+	 * Deterministic bytes for codec inputs, runs of repeated text broken by generated noise
+	 * so the compressors neither collapse nor give up on the data
+	*/
+
+	inline static auto make_bytes(
+		std::size_t size,
+		std::uint32_t seed = 0x9E3779B9u
+	) -> std::vector<std::uint8_t>
+	{
+		static constexpr auto text = std::string_view{"PACKAGES/IMAGES/RESOURCE_GROUP/"};
+		auto result = std::vector<std::uint8_t>(size);
+		auto state = seed;
+		for (auto i : Range<std::size_t>(size)) {
+			state = state * 1664525u + 1013904223u;
+			result[i] = (state >> 28) == 0u ? static_cast<std::uint8_t>(state >> 20) : static_cast<std::uint8_t>(text[i % text.size()]);
+		}
+		return result;
+	}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "benchmark/benchmark.hpp"
+#include "kernel/support/miscellaneous/shared.hpp"
+
+namespace Sen::Kernel::Benchmark::CompiledMapData {
+
+	using namespace Sen::Kernel::Support::Miscellaneous::Shared;
+
+	/**
+	 * Resource paths shaped like an unpacked bundle, many keys share long prefixes
+	*/
+
+	inline static auto make_value(
+		std::size_t count
+	) -> std::map<std::string, std::uint32_t>
+	{
+		auto value = std::map<std::string, std::uint32_t>{};
+		for (auto i : Range<std::size_t>(count)) {
+			value.emplace(fmt::format("PACKAGES/IMAGES/GROUP_{}/RESOURCE_{}.PTX", i % 97, i), static_cast<std::uint32_t>(i));
+		}
+		return value;
+	}
+
+	/**
+	 * Encode time should grow linearly with the key count
+	*/
+
+	inline static auto run(
+	) -> void
+	{
+		for (auto count : {1000_size, 4000_size, 16000_size, 64000_size}) {
+			auto value = make_value(count);
+			measure(fmt::format("CompiledMapData::encode {} keys", count), 5_size, [&]() {
+				auto stream = DataStreamView{};
+				Sen::Kernel::Support::Miscellaneous::Shared::CompiledMapData::encode(stream, value, [](DataStreamView & stream, std::uint32_t const & index) {
+					stream.writeUint32(index);
+				});
+			});
+		}
+		return;
+	}
+
+}
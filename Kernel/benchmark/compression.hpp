@@ -0,0 +1,45 @@
+#pragma once
+
+#include "benchmark/benchmark.hpp"
+
+namespace Sen::Kernel::Benchmark::Compression {
+
+	using namespace Sen::Kernel::Definition::Compression;
+
+	inline static auto run(
+	) -> void
+	{
+		for (auto size : {0x100000_size, 0x1000000_size}) {
+			auto data = make_bytes(size);
+			{
+				auto compressed = Zlib::compress<Zlib::Level::LEVEL_9>(data);
+				measure(fmt::format("Zlib::compress {} bytes", size), 3_size, size, [&]() {
+					Zlib::compress<Zlib::Level::LEVEL_9>(data);
+				});
+				measure(fmt::format("Zlib::uncompress {} bytes", size), 3_size, size, [&]() {
+					Zlib::uncompress(compressed);
+				});
+			}
+			{
+				auto compressed = Lzma::compress<Lzma::Level::LEVEL_5>(data);
+				measure(fmt::format("Lzma::compress {} bytes", size), 3_size, size, [&]() {
+					Lzma::compress<Lzma::Level::LEVEL_5>(data);
+				});
+				measure(fmt::format("Lzma::uncompress {} bytes", size), 3_size, size, [&]() {
+					Lzma::uncompress(compressed);
+				});
+			}
+			{
+				auto compressed = Bzip2::compress(data, 9, 0);
+				measure(fmt::format("Bzip2::compress {} bytes", size), 3_size, size, [&]() {
+					Bzip2::compress(data, 9, 0);
+				});
+				measure(fmt::format("Bzip2::uncompress {} bytes", size), 3_size, size, [&]() {
+					Bzip2::uncompress(compressed);
+				});
+			}
+		}
+		return;
+	}
+
+}
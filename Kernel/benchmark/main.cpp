@@ -0,0 +1,34 @@
+#include "benchmark/compiled_map_data.hpp"
+#include "benchmark/reflection_object_notation.hpp"
+#include "benchmark/resource_stream_bundle.hpp"
+#include "benchmark/texture.hpp"
+#include "benchmark/compression.hpp"
+
+using namespace Sen::Kernel;
+
+/**
+ * usage: benchmark [--filter <name>] [--json <report path>]
+*/
+
+int main(int size, char** argc)
+{
+	auto report = std::string{};
+	for (auto i = 1; i < size; ++i) {
+		auto argument = std::string_view{argc[i]};
+		if (argument == "--filter" && i + 1 < size) {
+			Benchmark::filter = argc[++i];
+		}
+		else if (argument == "--json" && i + 1 < size) {
+			report = argc[++i];
+		}
+	}
+	Benchmark::CompiledMapData::run();
+	Benchmark::ReflectionObjectNotation::run();
+	Benchmark::ResourceStreamBundle::run();
+	Benchmark::Texture::run();
+	Benchmark::Compression::run();
+	if (!report.empty()) {
+		Benchmark::write_report(report);
+	}
+	return 0;
+}
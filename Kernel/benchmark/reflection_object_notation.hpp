@@ -0,0 +1,128 @@
+#pragma once
+
+#include "benchmark/benchmark.hpp"
+#include "kernel/support/popcap/reflection_object_notation/encode.hpp"
+#include "kernel/support/popcap/reflection_object_notation/decode.hpp"
+
+namespace Sen::Kernel::Benchmark::ReflectionObjectNotation {
+
+	using namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation;
+
+	/**
+	 * Json shaped like a level definition, count objects with repeated class names and fresh aliases
+	*/
+
+	inline static auto make_value(
+		std::size_t count
+	) -> std::string
+	{
+		auto writer = Definition::JsonWriter{};
+		writer.WriteStartObject();
+		writer.WritePropertyName(std::string{"objects"});
+		writer.WriteStartArray();
+		for (auto i : Range<std::size_t>(count)) {
+			writer.WriteStartObject();
+			writer.WritePropertyName(std::string{"aliases"});
+			writer.WriteStartArray();
+			writer.WriteValue(fmt::format("Object{}", i));
+			writer.WriteEndArray();
+			writer.WritePropertyName(std::string{"objclass"});
+			writer.WriteValue(fmt::format("ObjectClass{}", i % 16));
+			writer.WritePropertyName(std::string{"objdata"});
+			writer.WriteStartObject();
+			writer.WritePropertyName(std::string{"Reference"});
+			writer.WriteValue(fmt::format("RTID(Object{}@CurrentLevel)", (i * 7) % count));
+			writer.WritePropertyName(std::string{"Index"});
+			writer.WriteValue(static_cast<int>(i));
+			writer.WritePropertyName(std::string{"Negative"});
+			writer.WriteValue(-static_cast<int>(i));
+			writer.WritePropertyName(std::string{"Scale"});
+			writer.WriteValue(static_cast<double>(i) * 0.5);
+			writer.WritePropertyName(std::string{"Enabled"});
+			writer.WriteBoolean(i % 2 == 0);
+			writer.WriteEndObject();
+			writer.WriteEndObject();
+		}
+		writer.WriteEndArray();
+		writer.WritePropertyName(std::string{"version"});
+		writer.WriteValue(1);
+		writer.WriteEndObject();
+		return writer.ToString();
+	}
+
+	/**
+	 * Json shaped like a localisation table, count strings where one in four repeat an earlier one
+	 * Odd indices are not ascii, so both string tables see fresh and indexed lookups
+	*/
+
+	inline static auto make_string_list(
+		std::size_t count
+	) -> std::string
+	{
+		auto make_string = [](std::size_t index) -> std::string {
+			return index % 2 == 0 ? fmt::format("[STRING_{}]", index) : fmt::format("[CHAÎNE_{}_文字列]", index);
+		};
+		// fixed seed so every run encodes the same table
+		auto generator = std::minstd_rand{0x5EED};
+		auto writer = Definition::JsonWriter{};
+		writer.WriteStartObject();
+		writer.WritePropertyName(std::string{"LocStringValues"});
+		writer.WriteStartArray();
+		for (auto i : Range<std::size_t>(count)) {
+			if (i % 4 == 3) {
+				writer.WriteValue(make_string(generator() % i));
+			}
+			else {
+				writer.WriteValue(make_string(i));
+			}
+		}
+		writer.WriteEndArray();
+		writer.WriteEndObject();
+		return writer.ToString();
+	}
+
+	inline static auto run(
+	) -> void
+	{
+		for (auto count : {1000_size, 10000_size, 100000_size}) {
+			auto value = make_value(count);
+			auto encoded = std::vector<std::uint8_t>{};
+			{
+				auto stream = DataStreamView{};
+				Encode::process_whole(stream, value);
+				encoded = stream.release();
+			}
+			measure(fmt::format("RTON::encode {} objects", count), 5_size, value.size(), [&]() {
+				auto stream = DataStreamView{};
+				Encode::process_whole(stream, value);
+			});
+			measure(fmt::format("RTON::decode {} objects", count), 5_size, encoded.size(), [&]() {
+				auto stream = DataStreamView{encoded};
+				auto writer = Definition::JsonWriter{};
+				writer.WriteIndent = true;
+				Decode::process_whole(stream, writer);
+			});
+		}
+		{
+			auto value = make_string_list(500000_size);
+			auto encoded = std::vector<std::uint8_t>{};
+			{
+				auto stream = DataStreamView{};
+				Encode::process_whole(stream, value);
+				encoded = stream.release();
+			}
+			measure("RTON::encode 500000 strings", 5_size, value.size(), [&]() {
+				auto stream = DataStreamView{};
+				Encode::process_whole(stream, value);
+			});
+			measure("RTON::decode 500000 strings", 5_size, encoded.size(), [&]() {
+				auto stream = DataStreamView{encoded};
+				auto writer = Definition::JsonWriter{};
+				writer.WriteIndent = true;
+				Decode::process_whole(stream, writer);
+			});
+		}
+		return;
+	}
+
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "benchmark/benchmark.hpp"
+#include "kernel/support/popcap/resource_stream_group/pack.hpp"
+#include "kernel/support/popcap/resource_stream_group/unpack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/pack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/unpack.hpp"
+
+namespace Sen::Kernel::Benchmark::ResourceStreamBundle {
+
+	namespace Bundle = Sen::Kernel::Support::PopCap::ResourceStreamBundle;
+
+	namespace Group = Sen::Kernel::Support::PopCap::ResourceStreamGroup;
+
+	using namespace Sen::Kernel::Support::Miscellaneous::Shared;
+
+	using PacketData = std::map<std::string, std::vector<std::uint8_t>>;
+
+	// resources of every subgroup
+
+	inline static constexpr auto k_resource_count = 8_size;
+
+	inline static constexpr auto k_resource_size = 0x4000_size;
+
+	/**
+	 * Bundle of count subgroups, one group each, every packet already packed in memory
+	*/
+
+	inline static auto make_value(
+		std::size_t count,
+		Bundle::BundleStructure & definition,
+		PacketData & packet
+	) -> void
+	{
+		definition.version = 4_ui;
+		definition.texture_information_section_size = Bundle::Common::k_texture_resource_information_section_block_size_version_0;
+		for (auto i : Range<std::size_t>(count)) {
+			auto subgroup_id = fmt::format("GROUP_{}_1536", i);
+			auto packet_structure = Group::PacketStructure{
+				.version = 4_ui,
+				.compression = Group::Common::PacketCompression{
+					.general = true,
+					.texture = false,
+				},
+			};
+			auto resource_data = PacketData{};
+			for (auto j : Range<std::size_t>(k_resource_count)) {
+				auto & resource = packet_structure.resource.emplace_back(Group::Resource{
+					.path = fmt::format("PACKAGES/GROUP_{}/RESOURCE_{}.BIN", i, j),
+					.use_texture_additional_instead = false,
+				});
+				resource_data[toupper_back(String::to_windows_style(resource.path))] = make_bytes(k_resource_size, static_cast<std::uint32_t>(i * k_resource_count + j));
+			}
+			auto stream = DataStreamView{};
+			Group::Pack::process_whole(stream, packet_structure, resource_data);
+			packet[subgroup_id] = stream.release();
+			auto & group = definition.group[fmt::format("GROUP_{}", i)];
+			group.composite = false;
+			group.subgroup[subgroup_id] = Bundle::SubgroupInformation{
+				.category = Bundle::SimpleCategoryInformation{
+					.is_image = false,
+					.resolution = 0,
+				},
+				.compression = 2_ui,
+				.resource = packet_structure.resource,
+			};
+		}
+		return;
+	}
+
+	inline static auto run(
+	) -> void
+	{
+		for (auto count : {100_size, 1000_size}) {
+			auto definition = Bundle::BundleStructure{};
+			auto packet = PacketData{};
+			make_value(count, definition, packet);
+			auto manifest = Bundle::ManifestStructure{};
+			auto packed = std::vector<std::uint8_t>{};
+			{
+				auto input = packet;
+				auto stream = DataStreamView{};
+				Bundle::Pack::process_whole(stream, definition, manifest, input);
+				packed = stream.release();
+			}
+			// pack consume its packets, every run get its own copy prepared ahead
+			auto iteration = 5_size;
+			auto input = std::vector<PacketData>(iteration, packet);
+			auto run_index = 0_size;
+			measure(fmt::format("RSB::pack {} subgroups", count), iteration, packed.size(), [&]() {
+				auto stream = DataStreamView{};
+				Bundle::Pack::process_whole(stream, definition, manifest, input[run_index++]);
+			});
+			measure(fmt::format("RSB::unpack {} subgroups", count), iteration, packed.size(), [&]() {
+				auto stream = DataStreamView{packed};
+				auto unpacked_definition = Bundle::BundleStructure{};
+				auto unpacked_manifest = Bundle::ManifestStructure{};
+				auto unpacked_packet = PacketData{};
+				Bundle::Unpack::process_whole(stream, unpacked_definition, unpacked_manifest, unpacked_packet);
+			});
+		}
+		return;
+	}
+
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "benchmark/benchmark.hpp"
+#include "kernel/support/texture/invoke.hpp"
+
+namespace Sen::Kernel::Benchmark::Texture {
+
+	using namespace Sen::Kernel::Support::Texture;
+
+	// every format the kernel can encode and decode
+
+	inline static constexpr auto k_format_list = std::array<Format, 20>{
+		Format::RGBA_8888,
+		Format::ARGB_8888,
+		Format::RGBA_4444,
+		Format::RGB_565,
+		Format::RGBA_5551,
+		Format::RGBA_4444_TILED,
+		Format::RGB_565_TILED,
+		Format::RGBA_5551_TILED,
+		Format::RGB_ETC1_A_8,
+		Format::RGB_ETC1_A_PALETTE,
+		Format::RGBA_PVRTC_4BPP,
+		Format::RGB_PVRTC_4BPP_A_8,
+		Format::A_8,
+		Format::ARGB_1555,
+		Format::ARGB_4444,
+		Format::RGB_ETC1,
+		Format::L_8,
+		Format::LA_44,
+		Format::LA_88,
+		Format::RGB_PVRTC_4BPP,
+	};
+
+	/**
+	 * Rgba image with gradients and a checker pattern, so block compressors see real edges
+	 * size: width and height, a power of two for PVRTC
+	*/
+
+	inline static auto make_value(
+		int size
+	) -> Definition::Image<int>
+	{
+		auto data = std::vector<std::uint8_t>(static_cast<std::size_t>(size) * static_cast<std::size_t>(size) * 4_size);
+		for (auto y : Range<int>(size)) {
+			for (auto x : Range<int>(size)) {
+				auto index = (static_cast<std::size_t>(y) * static_cast<std::size_t>(size) + static_cast<std::size_t>(x)) * 4_size;
+				data[index] = static_cast<std::uint8_t>(x * 255 / size);
+				data[index + 1] = static_cast<std::uint8_t>(y * 255 / size);
+				data[index + 2] = static_cast<std::uint8_t>(((x / 16 + y / 16) % 2) * 255);
+				data[index + 3] = static_cast<std::uint8_t>(255 - (x + y) * 255 / (size * 2));
+			}
+		}
+		return Definition::Image<int>(0, 0, size, size, data);
+	}
+
+	inline static auto run(
+	) -> void
+	{
+		for (auto size : {256, 1024}) {
+			auto image = make_value(size);
+			auto pixel_size = static_cast<std::size_t>(size) * static_cast<std::size_t>(size) * 4_size;
+			for (auto format : k_format_list) {
+				auto name = magic_enum::enum_name(format);
+				auto encoded = InvokeMethod::encode_whole(image, format);
+				measure(fmt::format("Texture::encode {} {}x{}", name, size, size), 3_size, pixel_size, [&]() {
+					InvokeMethod::encode_whole(image, format);
+				});
+				measure(fmt::format("Texture::decode {} {}x{}", name, size, size), 3_size, pixel_size, [&]() {
+					InvokeMethod::decode_whole(encoded, size, size, format);
+				});
+			}
+		}
+		return;
+	}
+
+}
@@ -5,7 +5,10 @@
 #include "kernel/definition/macro.hpp"
 #include "kernel/definition/basic/buffer.hpp"
 #include "kernel/definition/basic/string.hpp"
-#include "kernel/definition/encryption/crc.hpp"
+#include "kernel/definition/basic/filesystem.hpp"
+#include "kernel/definition/basic/image.hpp"
+#include "kernel/definition/basic/thread.hpp"
+#include "kernel/definition/compression/zlib.hpp"
 
 namespace Sen::Kernel::Definition
 {
@@ -35,216 +38,488 @@ namespace Sen::Kernel::Definition
         }
     };
 
+    /**
+     * Streaming APNG encoder
+     * Frames are raw RGBA of the canvas size, each one is cropped to the area that changed
+     * since the previous frame, filtered and deflated in parallel, and the chunks are written
+     * to the file in order so only a window of frames is kept in memory
+     * The file is written to destination.tmp and only renamed once every chunk was written
+     */
+
     struct APNGMaker
     {
     protected:
-        struct ImageHeader
-        {
-        public:
-            std::uint32_t width;
-            std::uint32_t height;
-            std::uint32_t x;
-            std::uint32_t y;
-            std::uint8_t depth;
-            std::uint8_t ctype;
-            std::uint8_t compress;
-            std::uint8_t filter;
-            std::uint8_t interlace;
-            explicit ImageHeader(
-
-                ) = default;
+        // fcTL dispose_op and blend_op
 
-            explicit ImageHeader(
-                std::uint32_t width,
-                std::uint32_t height,
-                std::uint32_t x,
-                std::uint32_t y,
-                std::uint8_t depth,
-                std::uint8_t ctype,
-                std::uint8_t compress,
-                std::uint8_t filter,
-                std::uint8_t interlace) : width(width), height(height), x(x), y(y),
-                                          depth(depth), ctype(ctype), compress(compress), filter(filter), interlace(interlace)
-            {
-            }
-
-            ~ImageHeader(
+        enum class DisposeOperation : std::uint8_t
+        {
+            none = 0,
+            background = 1,
+            previous = 2,
+        };
 
-                ) = default;
+        enum class BlendOperation : std::uint8_t
+        {
+            source = 0,
+            over = 1,
         };
 
-        struct ImageData
+        struct FrameRegion
         {
-            std::vector<std::vector<std::uint32_t>> pixel_list;
-            ImageHeader meta_data;
+            std::uint32_t x;
+            std::uint32_t y;
+            std::uint32_t width;
+            std::uint32_t height;
+            BlendOperation blend;
         };
 
-        inline static constexpr auto idat_uint32 = 1229209940u;
+        struct EncodedFrame
+        {
+            FrameRegion region;
+            std::vector<std::uint8_t> data;
+        };
 
-        inline static constexpr auto file_signature = 9894494448401390090ull;
+        inline static constexpr auto k_signature = std::array<std::uint8_t, 8>{0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
 
-        inline static constexpr auto image_trailer_end = 5279712195050102914ull;
+        inline static auto write_uint32(
+            std::vector<std::uint8_t> &data,
+            std::uint32_t value) -> void
+        {
+            data.push_back(static_cast<std::uint8_t>(value >> 24));
+            data.push_back(static_cast<std::uint8_t>(value >> 16));
+            data.push_back(static_cast<std::uint8_t>(value >> 8));
+            data.push_back(static_cast<std::uint8_t>(value));
+            return;
+        }
 
-        inline static auto find_idat(
-            DataStreamViewBigEndian &stream,
-            std::vector<std::vector<std::uint32_t>> &pixel_list) -> void
+        inline static auto write_uint16(
+            std::vector<std::uint8_t> &data,
+            std::uint16_t value) -> void
         {
+            data.push_back(static_cast<std::uint8_t>(value >> 8));
+            data.push_back(static_cast<std::uint8_t>(value));
+            return;
+        }
+
+        /**
+         * Bounding box of the pixels that differ from the previous frame
+         * When every changed pixel is opaque, the frame is blended over the previous one
+         * so the unchanged pixels inside the box can be written as transparent
+         */
 
-            auto pixel = std::vector<uint32_t>{};
-            auto found = 0;
-            while (stream.read_pos < stream.size() - 12ull)
+        inline static auto find_region(
+            const std::vector<std::uint8_t> &previous,
+            const std::vector<std::uint8_t> &current,
+            std::uint32_t width,
+            std::uint32_t height) -> FrameRegion
+        {
+            auto left = width;
+            auto top = height;
+            auto right = 0u;
+            auto bottom = 0u;
+            auto opaque = true;
+            for (auto y : Range<std::uint32_t>(height))
             {
-                auto read_num = stream.readUint32();
-                if (read_num == idat_uint32)
+                auto previous_row = reinterpret_cast<const std::uint8_t *>(previous.data()) + static_cast<std::size_t>(y) * width * 4_size;
+                auto current_row = reinterpret_cast<const std::uint8_t *>(current.data()) + static_cast<std::size_t>(y) * width * 4_size;
+                if (std::memcmp(previous_row, current_row, static_cast<std::size_t>(width) * 4_size) == 0)
                 {
-                    if (found > 0) {
-                        // pixel.pop_back(); // delete crc32 checksum;
-                        pixel.pop_back(); // delete next idat length;
-                        pixel_list.emplace_back(pixel);
-                    }
-                    pixel.clear();
-                    ++found;
+                    continue;
                 }
-                else {
-                    pixel.emplace_back(read_num);
+                for (auto x : Range<std::uint32_t>(width))
+                {
+                    if (std::memcmp(previous_row + x * 4_size, current_row + x * 4_size, 4_size) != 0)
+                    {
+                        left = std::min(left, x);
+                        right = std::max(right, x + 1u);
+                        opaque = opaque && current_row[x * 4_size + 3_size] == 0xFF;
+                    }
                 }
+                top = std::min(top, y);
+                bottom = y + 1u;
             }
-            pixel_list.emplace_back(pixel);
-            return;
+            if (left >= right)
+            {
+                // nothing changed, a single untouched pixel keep the frame timing
+                return FrameRegion{0u, 0u, 1u, 1u, BlendOperation::over};
+            }
+            return FrameRegion{left, top, right - left, bottom - top, opaque ? BlendOperation::over : BlendOperation::source};
         }
 
-        inline static auto to_uint32_vector(
-            DataStreamViewBigEndian &stream,
-            std::vector<uint32_t> &pixel_list) -> void
+        inline static auto paeth(
+            std::int32_t a,
+            std::int32_t b,
+            std::int32_t c) -> std::uint8_t
         {
+            auto p = a + b - c;
+            auto pa = std::abs(p - a);
+            auto pb = std::abs(p - b);
+            auto pc = std::abs(p - c);
+            if (pa <= pb && pa <= pc)
+            {
+                return static_cast<std::uint8_t>(a);
+            }
+            return static_cast<std::uint8_t>(pb <= pc ? b : c);
+        }
 
-            return;
+        /**
+         * Crop, filter every scanline with the filter of the lowest absolute sum, then deflate
+         * previous: null for the first frame
+         */
+
+        inline static auto encode_frame(
+            const std::vector<std::uint8_t> *previous,
+            const std::vector<std::uint8_t> &current,
+            std::uint32_t width,
+            const FrameRegion &region) -> std::vector<std::uint8_t>
+        {
+            auto row_size = static_cast<std::size_t>(region.width) * 4_size;
+            auto raw = std::vector<std::uint8_t>(row_size * region.height);
+            for (auto y : Range<std::uint32_t>(region.height))
+            {
+                auto offset = (static_cast<std::size_t>(region.y + y) * width + region.x) * 4_size;
+                auto destination = raw.data() + static_cast<std::size_t>(y) * row_size;
+                std::memcpy(destination, current.data() + offset, row_size);
+                if (previous != nullptr && region.blend == BlendOperation::over)
+                {
+                    for (auto x : Range<std::size_t>(region.width))
+                    {
+                        if (std::memcmp(destination + x * 4_size, previous->data() + offset + x * 4_size, 4_size) == 0)
+                        {
+                            std::memset(destination + x * 4_size, 0, 4_size);
+                        }
+                    }
+                }
+            }
+            auto filtered = std::vector<std::uint8_t>((row_size + 1_size) * region.height);
+            auto candidate = std::array<std::vector<std::uint8_t>, 5>{};
+            for (auto &e : candidate)
+            {
+                e.resize(row_size);
+            }
+            auto const zero_row = std::vector<std::uint8_t>(row_size);
+            for (auto y : Range<std::size_t>(region.height))
+            {
+                auto row = raw.data() + y * row_size;
+                auto above = y == 0_size ? zero_row.data() : raw.data() + (y - 1_size) * row_size;
+                for (auto i : Range<std::size_t>(row_size))
+                {
+                    auto left = i >= 4_size ? row[i - 4_size] : std::uint8_t{0};
+                    auto upper_left = i >= 4_size ? above[i - 4_size] : std::uint8_t{0};
+                    candidate[0][i] = row[i];
+                    candidate[1][i] = static_cast<std::uint8_t>(row[i] - left);
+                    candidate[2][i] = static_cast<std::uint8_t>(row[i] - above[i]);
+                    candidate[3][i] = static_cast<std::uint8_t>(row[i] - ((static_cast<std::uint32_t>(left) + above[i]) >> 1));
+                    candidate[4][i] = static_cast<std::uint8_t>(row[i] - paeth(left, above[i], upper_left));
+                }
+                auto best = 0_size;
+                auto best_sum = std::numeric_limits<std::uint64_t>::max();
+                for (auto filter : Range<std::size_t>(5_size))
+                {
+                    auto sum = std::uint64_t{0};
+                    for (auto value : candidate[filter])
+                    {
+                        sum += static_cast<std::uint64_t>(std::abs(static_cast<std::int8_t>(value)));
+                    }
+                    if (sum < best_sum)
+                    {
+                        best = filter;
+                        best_sum = sum;
+                    }
+                }
+                auto destination = filtered.data() + y * (row_size + 1_size);
+                destination[0] = static_cast<std::uint8_t>(best);
+                std::memcpy(destination + 1, candidate[best].data(), row_size);
+            }
+            return Compression::Zlib::compress<Compression::Zlib::Level::LEVEL_9>(filtered);
         }
 
-        inline static auto load_image_path(
-            const std::vector<std::string> &image_path_list,
-            std::vector<ImageData> &image_data_list) -> void
+        // frame of any png as RGBA on a width * height canvas, anchored at the top left
+        // palette, low bit depth and 16-bit images are expanded to 8-bit RGB or RGBA by libpng
+
+        inline static auto load_frame(
+            std::string_view source,
+            std::uint32_t width,
+            std::uint32_t height) -> std::vector<std::uint8_t>
         {
-            for (const auto &image_path : image_path_list)
-            {
-                auto stream = DataStreamViewBigEndian{image_path};
-                assert_conditional(stream.readString(4, 0xC_size) == "IHDR", String::format(fmt::format("{}", Language::get("mismatch_image_magic")), String::to_posix_style(image_path)), "load_image_path");
-                auto image_data = ImageData{
-                    .meta_data = ImageHeader{
-                        stream.readUint32(),
-                        stream.readUint32(),
-                        0,
-                        0,
-                        stream.readUint8(),
-                        stream.readUint8(),
-                        stream.readUint8(),
-                        stream.readUint8(),
-                        stream.readUint8()}};
-                find_idat(stream, image_data.pixel_list);
-                image_data_list.emplace_back(image_data);
+            auto image = ImageIO::read_png(source, PNG_TRANSFORM_EXPAND | PNG_TRANSFORM_STRIP_16 | PNG_TRANSFORM_GRAY_TO_RGB);
+            if (image.bit_depth != 8 || (image.channels != 3 && image.channels != 4))
+            {
+                throw Exception(String::format(fmt::format("{}", Language::get("apng_maker.unsupported_image")), String::to_posix_style(std::string{source})), std::source_location::current(), "load_frame");
             }
-            return;
-        };
+            auto const &data = image.data();
+            auto channels = static_cast<std::size_t>(image.channels);
+            auto result = std::vector<std::uint8_t>(static_cast<std::size_t>(width) * height * 4_size);
+            for (auto y : Range<std::size_t>(std::min<std::size_t>(static_cast<std::size_t>(image.height), height)))
+            {
+                for (auto x : Range<std::size_t>(std::min<std::size_t>(static_cast<std::size_t>(image.width), width)))
+                {
+                    auto pixel = data.data() + (y * static_cast<std::size_t>(image.width) + x) * channels;
+                    auto destination = result.data() + (y * width + x) * 4_size;
+                    destination[0] = pixel[0];
+                    destination[1] = pixel[1];
+                    destination[2] = pixel[2];
+                    destination[3] = channels == 4_size ? pixel[3] : std::uint8_t{0xFF};
+                }
+            }
+            return result;
+        }
 
     public:
-        inline static auto process_fs(
-            const std::vector<std::string> &image_path_list,
-            std::string_view destination,
-            APNGMakerSetting *setting) -> void
+        /**
+         * Incremental encoder, frames are appended in order a window at a time
+         * A writer destroyed before commit removes its temporary file
+         */
+
+        class Writer
         {
-            auto image_data_list = std::vector<ImageData>{};
-            load_image_path(image_path_list, image_data_list);
-            if (setting->width == 0 || setting->height == 0)
+        protected:
+            std::string destination;
+
+            std::string temporary;
+
+            std::unique_ptr<FILE, decltype(FileSystem::close_file)> file;
+
+            APNGMakerSetting setting;
+
+            std::size_t frame_count;
+
+            std::size_t frame_index;
+
+            std::uint32_t sequence;
+
+            std::vector<std::uint8_t> previous;
+
+            inline auto write(
+                std::span<const std::uint8_t> data) -> void
             {
-                auto max_width = std::vector<uint32_t>{};
-                auto max_height = std::vector<uint32_t>{};
-                for (auto &image_data : image_data_list)
+                auto written = std::fwrite(data.data(), 1_size, data.size(), thiz.file.get());
+                assert_conditional(written == data.size(), fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(thiz.destination)), "write");
+                return;
+            }
+
+            // length, type, data and crc of type + data
+
+            inline auto write_chunk(
+                std::string_view type,
+                std::span<const std::uint8_t> data) -> void
+            {
+                auto header = std::vector<std::uint8_t>{};
+                write_uint32(header, static_cast<std::uint32_t>(data.size()));
+                header.insert(header.end(), type.begin(), type.end());
+                auto crc = ::crc32(0L, header.data() + 4, 4u);
+                // crc32 with a null buffer returns the initial value instead of crc, IEND has no data
+                if (!data.empty())
                 {
-                    max_width.emplace_back(image_data.meta_data.width);
-                    max_height.emplace_back(image_data.meta_data.height);
+                    crc = ::crc32(crc, data.data(), static_cast<uInt>(data.size()));
                 }
-                if (setting->width == 0)
+                auto footer = std::vector<std::uint8_t>{};
+                write_uint32(footer, static_cast<std::uint32_t>(crc));
+                thiz.write(header);
+                thiz.write(data);
+                thiz.write(footer);
+                return;
+            }
+
+            inline static auto make_path(
+                std::string_view path) -> std::filesystem::path
+            {
+                #if WINDOWS
+                return std::filesystem::path{String::utf8_to_utf16(std::string{path})};
+                #else
+                return std::filesystem::path{std::string{path}};
+                #endif
+            }
+
+        public:
+            /**
+             * destination: output file
+             * frame_count: number of frame that will be appended
+             * setting: delay of every frame in millisecond, loop and canvas size
+             */
+
+            explicit Writer(
+                std::string_view destination,
+                std::size_t frame_count,
+                const APNGMakerSetting &setting) : destination{destination}, temporary{fmt::format("{}.tmp", destination)}, file{nullptr, FileSystem::close_file}, setting{setting}, frame_count{frame_count}, frame_index{0_size}, sequence{0u}, previous{}
+            {
+                assert_conditional(frame_count > 0_size && setting.width > 0u && setting.height > 0u, fmt::format("{}", Language::get("apng_maker.invalid_frame_size")), "Writer");
+                assert_conditional(setting.delay_frames_list.size() >= frame_count, fmt::format("{}", Language::get("apng_maker.invalid_frame_size")), "Writer");
+                #if WINDOWS
+                thiz.file.reset(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}", String::to_windows_style(thiz.temporary))).data(), L"wb"));
+                #else
+                thiz.file.reset(std::fopen(thiz.temporary.data(), "wb"));
+                #endif
+                if (thiz.file == nullptr)
                 {
-                    setting->width = *std::max_element(max_width.begin(), max_width.end());
+                    throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(thiz.destination)), std::source_location::current(), "Writer");
                 }
-                if (setting->height == 0)
+                thiz.write(k_signature);
+                auto header = std::vector<std::uint8_t>{};
+                write_uint32(header, setting.width);
+                write_uint32(header, setting.height);
+                header.insert(header.end(), {8, 6, 0, 0, 0});
+                thiz.write_chunk("IHDR", header);
+                if (frame_count > 1_size)
                 {
-                    setting->height = *std::max_element(max_height.begin(), max_height.end());
+                    auto animation_control = std::vector<std::uint8_t>{};
+                    write_uint32(animation_control, static_cast<std::uint32_t>(frame_count));
+                    write_uint32(animation_control, setting.loop);
+                    thiz.write_chunk("acTL", animation_control);
                 }
             }
-            auto stream = DataStreamViewBigEndian{};
-            stream.writeUint64(file_signature);
-            // IHDR
-            stream.writeUint32(13);
-            stream.writeString("IHDR");
-            stream.writeUint32(setting->width);
-            stream.writeUint32(setting->height);
-            stream.writeUint8(8);
-            stream.writeUint8(6);
-            stream.writeNull(3);
-            stream.writeUint32(Encryption::CRC32::Normal::compute(0, stream.readBytes(17, 12_size)));
-            auto is_animated = image_data_list.size() > 1;
-            if (is_animated)
-            {
-                stream.writeUint32(8);
-                stream.writeString("acTL");
-                stream.writeUint32(image_data_list.size());
-                stream.writeUint32(setting->loop);
-                stream.writeUint32(Encryption::CRC32::Normal::compute(0, stream.readBytes(12, 37_size)));
-            }
-            auto frame_index = 0;
-            for (const auto &i : Range<int>(image_data_list.size()))
-            {
-                const auto &image_data = image_data_list[i];
-                if (is_animated)
+
+            ~Writer(
+
+                )
+            {
+                if (thiz.file != nullptr)
                 {
-                    stream.writeUint32(26);
-                    auto pos = stream.write_pos;
-                    stream.writeString("fcTL");
-                    stream.writeUint32(frame_index++);
-                    stream.writeUint32(image_data.meta_data.width);
-                    stream.writeUint32(image_data.meta_data.height);
-                    stream.writeUint32(image_data.meta_data.x);
-                    stream.writeUint32(image_data.meta_data.y);
-                    stream.writeUint16(static_cast<uint16_t>(setting->delay_frames_list.at(i)));
-                    stream.writeUint16(1000);
-                    stream.writeNull(2);
-                    stream.writeUint32(Encryption::CRC32::Normal::compute(0, stream.readBytes(30, static_cast<std::size_t>(pos))));
+                    thiz.file.reset();
+                    auto error = std::error_code{};
+                    std::filesystem::remove(make_path(thiz.temporary), error);
                 }
-                if (i > 0)
+            }
+
+            Writer(
+                Writer &&that) = delete;
+
+            auto operator=(
+                Writer &&that) -> Writer & = delete;
+
+            /**
+             * frame_list: next frames, RGBA of setting.width * setting.height
+             */
+
+            inline auto append(
+                std::span<const std::vector<std::uint8_t>> frame_list) -> void
+            {
+                assert_conditional(thiz.file != nullptr && thiz.frame_index + frame_list.size() <= thiz.frame_count, fmt::format("{}", Language::get("apng_maker.invalid_frame_size")), "append");
+                for (auto const &frame : frame_list)
                 {
-                    for (const auto &pixel : image_data.pixel_list)
-                    {
-                        auto data_stream = DataStreamViewBigEndian{};
-                        auto data_size = static_cast<uint32_t>(pixel.size()  * 4);
-                        stream.writeUint32(data_size);
-                        data_stream.writeString("fdAT");
-                        data_stream.writeUint32(frame_index++);
-                        for (const auto &k : Range<int>(pixel.size() - 1)) {
-                            data_stream.writeUint32(pixel[k]);
-                        }
-                        auto data = data_stream.toBytes();
-                        stream.writeBytes(data);
-                        stream.writeUint32(Encryption::CRC32::Normal::compute(0, data));
-                    }
+                    assert_conditional(frame.size() == static_cast<std::size_t>(thiz.setting.width) * thiz.setting.height * 4_size, fmt::format("{}", Language::get("apng_maker.invalid_frame_size")), "append");
                 }
-                else
+                if (frame_list.empty())
                 {
-                    for (const auto &pixel : image_data.pixel_list)
+                    return;
+                }
+                auto encoded_list = std::vector<EncodedFrame>(frame_list.size());
+                parallel_for(frame_list.size(), [&](std::size_t index) {
+                    auto prior = index > 0_size ? &frame_list[index - 1_size] : thiz.previous.empty() ? nullptr : &thiz.previous;
+                    auto &encoded = encoded_list[index];
+                    encoded.region = prior == nullptr ? FrameRegion{0u, 0u, thiz.setting.width, thiz.setting.height, BlendOperation::source} : find_region(*prior, frame_list[index], thiz.setting.width, thiz.setting.height);
+                    encoded.data = encode_frame(prior, frame_list[index], thiz.setting.width, encoded.region);
+                });
+                for (auto const &encoded : encoded_list)
+                {
+                    if (thiz.frame_count > 1_size)
                     {
-                        stream.writeUint32(static_cast<uint32_t>((pixel.size() - 1) * 4));
-                        stream.writeString("IDAT");
-                        for (const auto &pixel_num : pixel)
-                        {
-                            stream.writeUint32(pixel_num);
-                        }
+                        auto frame_control = std::vector<std::uint8_t>{};
+                        write_uint32(frame_control, thiz.sequence++);
+                        write_uint32(frame_control, encoded.region.width);
+                        write_uint32(frame_control, encoded.region.height);
+                        write_uint32(frame_control, encoded.region.x);
+                        write_uint32(frame_control, encoded.region.y);
+                        write_uint16(frame_control, static_cast<std::uint16_t>(std::min(thiz.setting.delay_frames_list[thiz.frame_index], 0xFFFFu)));
+                        write_uint16(frame_control, 1000);
+                        frame_control.push_back(static_cast<std::uint8_t>(DisposeOperation::none));
+                        frame_control.push_back(static_cast<std::uint8_t>(encoded.region.blend));
+                        thiz.write_chunk("fcTL", frame_control);
                     }
+                    if (thiz.frame_index == 0_size)
+                    {
+                        thiz.write_chunk("IDAT", encoded.data);
+                    }
+                    else
+                    {
+                        auto frame_data = std::vector<std::uint8_t>{};
+                        frame_data.reserve(encoded.data.size() + 4_size);
+                        write_uint32(frame_data, thiz.sequence++);
+                        frame_data.insert(frame_data.end(), encoded.data.begin(), encoded.data.end());
+                        thiz.write_chunk("fdAT", frame_data);
+                    }
+                    ++thiz.frame_index;
+                }
+                thiz.previous = frame_list.back();
+                return;
+            }
+
+            // write IEND once every frame was appended, then move the file to the destination
+
+            inline auto commit(
+
+                ) -> void
+            {
+                assert_conditional(thiz.file != nullptr && thiz.frame_index == thiz.frame_count, fmt::format("{}", Language::get("apng_maker.invalid_frame_size")), "commit");
+                thiz.write_chunk("IEND", std::span<const std::uint8_t>{});
+                auto is_closed = std::fclose(thiz.file.release()) == 0;
+                if (!is_closed)
+                {
+                    auto error = std::error_code{};
+                    std::filesystem::remove(make_path(thiz.temporary), error);
+                    throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(thiz.destination)), std::source_location::current(), "commit");
+                }
+                std::filesystem::rename(make_path(thiz.temporary), make_path(thiz.destination));
+                return;
+            }
+        };
+
+        /**
+         * frame_count: number of frame
+         * load: (index) -> RGBA of setting.width * setting.height, called from several threads
+         * destination: output file
+         * setting: delay of every frame in millisecond, loop and canvas size
+         */
+
+        template <typename Loader>
+        inline static auto process(
+            std::size_t frame_count,
+            const Loader &load,
+            std::string_view destination,
+            const APNGMakerSetting &setting) -> void
+        {
+            auto writer = Writer{destination, frame_count, setting};
+            auto window = ThreadPool::hardware_concurrency();
+            for (auto begin = 0_size; begin < frame_count; begin += window)
+            {
+                auto count = std::min(window, frame_count - begin);
+                auto frame_list = std::vector<std::vector<std::uint8_t>>(count);
+                parallel_for(count, [&](std::size_t index) {
+                    frame_list[index] = load(begin + index);
+                });
+                writer.append(frame_list);
+            }
+            writer.commit();
+            return;
+        }
+
+        /**
+         * image_path_list: png of every frame
+         * destination: output file
+         * setting: width and height are taken from the largest frame when they are 0
+         */
+
+        inline static auto process_fs(
+            const std::vector<std::string> &image_path_list,
+            std::string_view destination,
+            APNGMakerSetting *setting) -> void
+        {
+            if (setting->width == 0 || setting->height == 0)
+            {
+                for (const auto &image_path : image_path_list)
+                {
+                    auto stream = DataStreamViewBigEndian{image_path};
+                    assert_conditional(stream.readString(4, 0xC_size) == "IHDR", String::format(fmt::format("{}", Language::get("mismatch_image_magic")), String::to_posix_style(image_path)), "process_fs");
+                    auto width = stream.readUint32();
+                    auto height = stream.readUint32();
+                    setting->width = std::max(setting->width, width);
+                    setting->height = std::max(setting->height, height);
                 }
             }
-            stream.writeNull(4);
-            stream.writeUint64(image_trailer_end);
-            stream.out_file(destination);
+            process(image_path_list.size(), [&](std::size_t index) {
+                return load_frame(image_path_list[index], setting->width, setting->height);
+            }, destination, *setting);
             return;
         }
     };
-}
\ No newline at end of file
+}
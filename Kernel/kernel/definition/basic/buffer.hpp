@@ -29,8 +29,6 @@ namespace Sen::Kernel::Definition
 
             std::size_t mutable length = size_t{0};
 
-            inline static auto constexpr buffer_size = static_cast<size_t>(8192);
-
             inline static auto constexpr close_file = [](FILE *file)
             {
                 if (file != nullptr)
@@ -41,6 +39,153 @@ namespace Sen::Kernel::Definition
                 return;
             };
 
+            // geometric growth, the vector only hold written bytes so nothing is zero filled ahead of a write
+
+            inline auto grow(
+                const std::size_t &size) const -> void
+            {
+                if (size > thiz.data.capacity())
+                {
+                    thiz.data.reserve(std::max(size, thiz.data.capacity() * 2_size));
+                }
+                return;
+            }
+
+            // bytes behind the end are copied in, skipped bytes before write_pos read as zero
+
+            inline auto write_raw(
+                const std::uint8_t *source,
+                const std::size_t &size) const -> void
+            {
+                auto new_pos = thiz.write_pos + size;
+                if (thiz.write_pos < thiz.spill_offset)
+                {
+                    auto patch_size = std::min(size, thiz.spill_offset - thiz.write_pos);
+                    thiz.write_file(thiz.write_pos, source, patch_size);
+                    source += patch_size;
+                    thiz.write_pos += patch_size;
+                    if (thiz.write_pos == new_pos)
+                    {
+                        return;
+                    }
+                }
+                auto position = thiz.write_pos - thiz.spill_offset;
+                auto remain = new_pos - thiz.write_pos;
+                thiz.grow(position + remain);
+                if (position > thiz.data.size())
+                {
+                    thiz.data.resize(position);
+                }
+                auto overwrite = std::min(remain, thiz.data.size() - position);
+                if (overwrite != 0_size)
+                {
+                    std::memcpy(thiz.data.data() + position, source, overwrite);
+                }
+                thiz.data.insert(thiz.data.end(), source + overwrite, source + remain);
+                thiz.length = thiz.spill_offset + thiz.data.size();
+                thiz.write_pos = new_pos;
+                thiz.spill_if_full();
+                return;
+            }
+
+            // spill mode, everything before spill_offset is already in the file and data hold the rest
+
+            std::unique_ptr<FILE, decltype(close_file)> mutable spill_file{nullptr};
+
+            std::string mutable spill_path;
+
+            std::size_t mutable spill_offset = size_t{0};
+
+            std::size_t mutable spill_threshold = size_t{0};
+
+            bool mutable spill_temporary = false;
+
+            // file that receive the spill file on commit, empty for scratch spills
+
+            std::string mutable spill_destination;
+
+            inline static auto constexpr k_spill_threshold = static_cast<size_t>(0x4000000);
+
+            inline static auto constexpr k_spill_chunk_size = static_cast<size_t>(0x100000);
+
+            inline static auto spill_counter = std::atomic<std::size_t>{0};
+
+            inline auto seek_file(
+                const std::size_t &position) const -> void
+            {
+#if WINDOWS
+                auto result = _fseeki64(thiz.spill_file.get(), static_cast<__int64>(position), SEEK_SET);
+#else
+                auto result = fseeko(thiz.spill_file.get(), static_cast<off_t>(position), SEEK_SET);
+#endif
+                assert_conditional(result == 0, fmt::format("{}: {}", Language::get("write_file_error"), thiz.spill_path), "seek_file");
+                return;
+            }
+
+            inline auto write_file(
+                const std::size_t &position,
+                const std::uint8_t *source,
+                const std::size_t &size) const -> void
+            {
+                thiz.seek_file(position);
+                assert_conditional(std::fwrite(source, 1, size, thiz.spill_file.get()) == size, fmt::format("{}: {}", Language::get("write_file_error"), thiz.spill_path), "write_file");
+                return;
+            }
+
+            inline auto spill_if_full(
+            ) const -> void
+            {
+                if (thiz.spill_file != nullptr && thiz.data.size() >= thiz.spill_threshold)
+                {
+                    thiz.flush();
+                }
+                return;
+            }
+
+            inline auto open_spill(
+                std::string_view path,
+                std::size_t threshold) const -> void
+            {
+                {
+#if WINDOWS
+                    auto filePath = std::filesystem::path(String::utf8_to_utf16(String::to_windows_style(path.data())));
+#else
+                    auto filePath = std::filesystem::path(path);
+#endif
+                    if (filePath.has_parent_path())
+                    {
+                        std::filesystem::create_directories(filePath.parent_path());
+                    }
+                }
+                thiz.flush();
+#if WINDOWS
+                thiz.spill_file.reset(_wfopen(String::utf8_to_utf16(path.data()).data(), L"w+b"));
+#else
+                thiz.spill_file.reset(std::fopen(path.data(), "w+b"));
+#endif
+                if (thiz.spill_file == nullptr)
+                {
+                    throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), path), std::source_location::current(),
+                                    "spill");
+                }
+                thiz.spill_path = std::string{path.data(), path.size()};
+                thiz.spill_threshold = threshold;
+                thiz.spill_offset = 0_size;
+                thiz.spill_temporary = false;
+                thiz.spill_destination.clear();
+                thiz.flush();
+                return;
+            }
+
+            // in spill mode only the bytes after spill_offset can be read back
+
+            inline auto view(
+                const std::size_t &position) const -> std::uint8_t *
+            {
+                assert_conditional(position >= thiz.spill_offset, fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), position, Language::get("buffer.actual_size"), thiz.size()), "view");
+                return thiz.data.data() + (position - thiz.spill_offset);
+            }
+
         public:
             std::size_t mutable read_pos = size_t{0};
 
@@ -57,8 +202,16 @@ namespace Sen::Kernel::Definition
             }
 
             Stream(
-                Stream &&that) noexcept : data(std::move(that.data)), length(that.length), read_pos(0), write_pos(0)
+                std::vector<std::uint8_t> &&data) : data(std::move(data)), read_pos(0), write_pos(thiz.data.size()), length(thiz.data.size())
             {
+                return;
+            }
+
+            Stream(
+                Stream &&that) noexcept : data(std::move(that.data)), length(that.length), read_pos(0), write_pos(0),
+                                          spill_file(std::move(that.spill_file)), spill_path(std::move(that.spill_path)), spill_offset(that.spill_offset), spill_threshold(that.spill_threshold), spill_temporary(that.spill_temporary), spill_destination(std::move(that.spill_destination))
+            {
+                that.spill_temporary = false;
             }
 
             auto operator=(
@@ -78,7 +231,7 @@ namespace Sen::Kernel::Definition
 #else
                 auto size = std::filesystem::file_size(std::filesystem::path{source});
 #endif
-                thiz.reserve(static_cast<std::uint64_t>(size + thiz.buffer_size));
+                thiz.data.resize(static_cast<std::size_t>(size));
                 thiz.file_path = source;
                 thiz.length = size;
                 thiz.write_pos = size;
@@ -88,7 +241,7 @@ namespace Sen::Kernel::Definition
             Stream(
                 const std::size_t &length) : read_pos(0), write_pos(length), length(length)
             {
-                thiz.reserve(length + thiz.buffer_size);
+                thiz.data.resize(length);
                 return;
             }
 
@@ -144,13 +297,13 @@ namespace Sen::Kernel::Definition
 
             ) const -> size_t
             {
-                return thiz.data.size();
+                return thiz.data.capacity();
             }
 
             inline auto constexpr reserve(
                 const std::size_t &capacity) const -> void
             {
-                thiz.data.resize(capacity);
+                thiz.data.reserve(capacity);
                 return;
             }
 
@@ -158,29 +311,37 @@ namespace Sen::Kernel::Definition
 
             ) const -> std::vector<std::uint8_t>
             {
-                auto bytes = std::vector<std::uint8_t>{};
-                bytes.reserve(thiz.length);
-                bytes.assign(thiz.data.begin(), data.begin() + thiz.length);
-                return bytes;
+                return thiz.data;
             }
 
             inline constexpr auto get(
 
             ) const -> const std::vector<std::uint8_t> &
             {
-                return thiz.toBytes();
+                return thiz.data;
+            }
+
+            // move the storage out, the stream is empty after
+
+            inline auto release(
+
+            ) -> std::vector<std::uint8_t>
+            {
+                auto bytes = std::move(thiz.data);
+                thiz.close();
+                return bytes;
             }
 
             inline auto get(
                 size_t from,
                 size_t to) const -> std::vector<uint8_t>
             {
-                if (from < 0 || to > thiz.data.size())
+                if (from < thiz.spill_offset || to > thiz.length || from > to)
                 {
                     throw Exception(fmt::format("{} {} {} {}", Language::get("buffer.invalid.size"), from, Language::get("to"), to),
                                     std::source_location::current(), "get");
                 }
-                return std::vector<unsigned char>(thiz.data.begin() + from, thiz.data.begin() + to);
+                return std::vector<unsigned char>(thiz.view(from), thiz.view(from) + (to - from));
             }
 
             inline constexpr auto get_read_pos(
@@ -216,10 +377,7 @@ namespace Sen::Kernel::Definition
 
                 ) -> std::string
             {
-                auto ss = std::stringstream{};
-                auto bytes = thiz.data.data();
-                ss << bytes;
-                return ss.str();
+                return std::string{thiz.data.begin(), std::find(thiz.data.begin(), thiz.data.end(), std::uint8_t{0})};
             }
 
             // insert to end of vector, write_pos will set to end.
@@ -229,9 +387,8 @@ namespace Sen::Kernel::Definition
             inline auto append(
                 const std::vector<T> &m_data) const -> void
             {
-                thiz.data.insert(thiz.data.begin() + thiz.length, m_data.begin(), m_data.end());
-                thiz.length += m_data.size();
                 thiz.write_pos = thiz.length;
+                thiz.write_raw(reinterpret_cast<const std::uint8_t *>(m_data.data()), m_data.size());
                 return;
             }
 
@@ -240,9 +397,119 @@ namespace Sen::Kernel::Definition
             inline auto append(
                 const std::array<T, n> &m_data) const -> void
             {
-                thiz.data.insert(thiz.data.begin() + thiz.length, m_data.begin(), m_data.end());
-                thiz.length += m_data.size();
                 thiz.write_pos = thiz.length;
+                thiz.write_raw(reinterpret_cast<const std::uint8_t *>(m_data.data()), m_data.size());
+                return;
+            }
+
+            // take the other stream to the end, its storage is reused when this one is empty
+
+            inline auto append(
+                Stream &&that) const -> void
+            {
+                thiz.write_pos = thiz.length;
+                if (that.spill_file != nullptr)
+                {
+                    // a spilled stream is copied back from its file by chunk
+                    that.flush();
+                    auto chunk = std::vector<std::uint8_t>(std::min(k_spill_chunk_size, that.length));
+                    for (auto position = 0_size; position < that.length; position += chunk.size())
+                    {
+                        auto size = std::min(chunk.size(), that.length - position);
+                        that.seek_file(position);
+                        assert_conditional(std::fread(chunk.data(), 1, size, that.spill_file.get()) == size, fmt::format("{}: {}", Language::get("cannot_read_file"), that.spill_path), "append");
+                        thiz.write_raw(chunk.data(), size);
+                    }
+                }
+                else if (thiz.length == 0_size && thiz.spill_file == nullptr)
+                {
+                    thiz.data = std::move(that.data);
+                    thiz.length = thiz.data.size();
+                    thiz.write_pos = thiz.length;
+                }
+                else
+                {
+                    thiz.write_raw(that.data.data(), that.data.size());
+                }
+                that.close();
+                return;
+            }
+
+            /**
+             * Spill mode: written bytes go to destination.tmp once the buffer reach the threshold
+             * Fields before the buffered region can still be written, they are patched in place in the file
+             * Only the buffered region can be read back
+             * commit move the file over destination, a stream closed before that leave destination untouched
+             */
+
+            inline auto spill(
+                std::string_view destination,
+                std::size_t threshold = k_spill_threshold) const -> void
+            {
+                thiz.open_spill(fmt::format("{}.tmp", destination), threshold);
+                thiz.spill_temporary = true;
+                thiz.spill_destination = std::string{destination.data(), destination.size()};
+                return;
+            }
+
+            // spill into a temporary file next to the other stream's file when that one is spilled
+
+            inline auto spill_next_to(
+                Stream const &that) const -> void
+            {
+                if (that.spill_file == nullptr)
+                {
+                    return;
+                }
+                thiz.open_spill(fmt::format("{}.{}.spill", that.spill_path, spill_counter++), that.spill_threshold);
+                thiz.spill_temporary = true;
+                return;
+            }
+
+            // write the last buffered bytes and rename the spill file over the destination given to spill
+
+            inline auto commit(
+
+            ) const -> void
+            {
+                assert_conditional(thiz.spill_file != nullptr && !thiz.spill_destination.empty(), fmt::format("{}: {}", Language::get("write_file_error"), thiz.spill_path), "commit");
+                thiz.flush();
+                auto is_closed = std::fclose(thiz.spill_file.release()) == 0;
+                assert_conditional(is_closed, fmt::format("{}: {}", Language::get("write_file_error"), thiz.spill_path), "commit");
+#if WINDOWS
+                std::filesystem::rename(std::filesystem::path{String::utf8_to_utf16(thiz.spill_path)}, std::filesystem::path{String::utf8_to_utf16(thiz.spill_destination)});
+#else
+                std::filesystem::rename(std::filesystem::path{thiz.spill_path}, std::filesystem::path{thiz.spill_destination});
+#endif
+                thiz.spill_temporary = false;
+                thiz.close();
+                return;
+            }
+
+            inline auto is_spilled(
+
+            ) const -> bool
+            {
+                return thiz.spill_file != nullptr;
+            }
+
+            // write the buffered region to the spill file
+
+            inline auto flush(
+
+            ) const -> void
+            {
+                if (thiz.spill_file == nullptr)
+                {
+                    return;
+                }
+                if (!thiz.data.empty())
+                {
+                    thiz.write_file(thiz.spill_offset, thiz.data.data(), thiz.data.size());
+                    thiz.spill_offset += thiz.data.size();
+                    thiz.data.clear();
+                }
+                assert_conditional(std::fflush(thiz.spill_file.get()) == 0, fmt::format("{}: {}", Language::get("write_file_error"), thiz.spill_path), "flush");
                 return;
             }
 
@@ -270,7 +537,20 @@ namespace Sen::Kernel::Definition
                     throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), path), std::source_location::current(),
                                     "out_file");
                 }
-                std::fwrite(thiz.data.data(), 1, thiz.length, file.get());
+                if (thiz.spill_file != nullptr)
+                {
+                    auto chunk = std::vector<std::uint8_t>(std::min(k_spill_chunk_size, thiz.length));
+                    thiz.flush();
+                    for (auto position = 0_size; position < thiz.length; position += chunk.size())
+                    {
+                        auto size = std::min(chunk.size(), thiz.length - position);
+                        thiz.seek_file(position);
+                        assert_conditional(std::fread(chunk.data(), 1, size, thiz.spill_file.get()) == size, fmt::format("{}: {}", Language::get("cannot_read_file"), thiz.spill_path), "out_file");
+                        assert_conditional(std::fwrite(chunk.data(), 1, size, file.get()) == size, fmt::format("{}: {}", Language::get("write_file_error"), path), "out_file");
+                    }
+                    return;
+                }
+                assert_conditional(std::fwrite(thiz.data.data(), 1, thiz.length, file.get()) == thiz.length, fmt::format("{}: {}", Language::get("write_file_error"), path), "out_file");
                 return;
             }
 
@@ -512,17 +792,7 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto new_pos = thiz.write_pos + inputBytes.size();
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
-                std::move(inputBytes.begin(), inputBytes.end(), thiz.data.begin() + thiz.write_pos);
-                thiz.write_pos = new_pos;
+                thiz.write_raw(inputBytes.data(), inputBytes.size());
                 return;
             }
 
@@ -596,7 +866,7 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto num = 0;
+                auto num = std::uint32_t{0};
                 for (num = static_cast<std::uint32_t>(value); num >= 128; num >>= 7)
                 {
                     thiz.writeUint8(static_cast<uint8_t>(num | 0x80));
@@ -668,17 +938,7 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto new_pos = thiz.write_pos + str.size();
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
-                std::copy(str.begin(), str.end(), thiz.data.begin() + thiz.write_pos);
-                thiz.write_pos = new_pos;
+                thiz.write_raw(reinterpret_cast<const std::uint8_t *>(str.data()), str.size());
                 return;
             }
 
@@ -693,19 +953,11 @@ namespace Sen::Kernel::Definition
                 {
                     thiz.write_pos = std::get<0>(std::make_tuple(args...));
                 }
-                auto new_pos = thiz.write_pos + str.size() * 4;
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
                 for (auto &c : str)
                 {
-                    thiz.data[thiz.write_pos++] = static_cast<std::uint8_t>(c);
-                    std::fill_n(&thiz.data[thiz.write_pos], 3, 0);
-                    thiz.write_pos += 3;
+                    this->template write_LE<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)));
                 }
-                std::fill_n(&thiz.data[thiz.write_pos], 4, 0);
-                thiz.write_pos += 4;
+                this->template write_LE<std::uint32_t>(0_ui);
                 return;
             }
 
@@ -724,22 +976,29 @@ namespace Sen::Kernel::Definition
                 {
                     return;
                 }
-                if (thiz.write_pos >= thiz.length)
+                if (thiz.spill_file != nullptr)
                 {
-                    auto new_length = thiz.write_pos + size;
-                    if (new_length > thiz.capacity()) {
-                        thiz.reserve(new_length + thiz.buffer_size);
+                    static constexpr auto zero = std::array<std::uint8_t, 0x1000>{};
+                    for (auto remain = size; remain != 0_size;)
+                    {
+                        auto chunk = std::min(remain, zero.size());
+                        thiz.write_raw(zero.data(), chunk);
+                        remain -= chunk;
                     }
-                    thiz.length = new_length;
-                    thiz.write_pos += size;
+                    return;
                 }
-                else
+                auto new_pos = thiz.write_pos + size;
+                if (thiz.write_pos < thiz.length)
                 {
-                    for (auto i : Range(size))
-                    {
-                        thiz.writeUint8(0x0);
-                    }
+                    std::memset(thiz.data.data() + thiz.write_pos, 0, std::min(size, thiz.length - thiz.write_pos));
                 }
+                if (new_pos > thiz.length)
+                {
+                    thiz.grow(new_pos);
+                    thiz.data.resize(new_pos);
+                    thiz.length = new_pos;
+                }
+                thiz.write_pos = new_pos;
                 return;
             }
 
@@ -951,26 +1210,15 @@ namespace Sen::Kernel::Definition
             inline auto operator[](
                 size_t position) const -> uint8_t &
             {
-                return this->data.at(position);
+                assert_conditional(position < thiz.length, fmt::format("{}, {}: {}, {}: {}", Language::get("buffer.read_offset_outside_bounds_of_dataview"), Language::get("buffer.new_position"), position, Language::get("buffer.actual_size"), thiz.size()), "operator[]");
+                return *thiz.view(position);
             }
 
             template <typename T>
                 requires std::is_integral<T>::value
             inline auto write_LE(T value) const -> void
             {
-                auto size = sizeof(T);
-                auto new_pos = thiz.write_pos + size;
-                // append capacity.
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
-                std::memcpy(&thiz.data[thiz.write_pos], &value, size);
-                thiz.write_pos += size;
+                thiz.write_raw(reinterpret_cast<const std::uint8_t *>(&value), sizeof(T));
                 return;
             }
 
@@ -980,20 +1228,12 @@ namespace Sen::Kernel::Definition
                 T value) const -> void
             {
                 auto size = sizeof(T);
-                auto new_pos = thiz.write_pos + size;
-                // append capacity.
-                if (new_pos > thiz.capacity())
-                {
-                    thiz.reserve(new_pos + thiz.buffer_size);
-                }
-                if (new_pos > thiz.length)
-                {
-                    thiz.length = new_pos;
-                }
+                auto bytes = std::array<std::uint8_t, sizeof(T)>{};
                 for (auto i : Range(size))
                 {
-                    thiz.data[thiz.write_pos++] = ((value >> ((size - 1 - i) * 8)) & 0xFF);
+                    bytes[i] = static_cast<std::uint8_t>((value >> ((size - 1 - i) * 8)) & 0xFF);
                 }
+                thiz.write_raw(bytes.data(), size);
                 return;
             }
 
@@ -1495,7 +1735,7 @@ namespace Sen::Kernel::Definition
                 size_t to) const -> std::vector<std::uint8_t>
             {
                 auto bytes = std::vector<std::uint8_t>{};
-                bytes.assign(thiz.data.begin() + from, thiz.data.begin() + to);
+                bytes.assign(thiz.view(from), thiz.view(from) + (to - from));
                 if (use_big_endian)
                 {
                     std::reverse(bytes.begin(), bytes.end());
@@ -1518,7 +1758,7 @@ namespace Sen::Kernel::Definition
                     thiz.read_pos = view;
                 }
                 auto bytes = std::vector<std::uint8_t>{};
-                bytes.assign(thiz.data.begin() + thiz.read_pos, thiz.data.begin() + thiz.read_pos + size);
+                bytes.assign(thiz.view(thiz.read_pos), thiz.view(thiz.read_pos) + size);
                 thiz.read_pos += size;
                 return bytes;
             }
@@ -1651,6 +1891,29 @@ namespace Sen::Kernel::Definition
                 return decoded;
             }
 
+            // bounds check a whole block once, read_pos move past it
+
+            inline auto read_block(
+                std::size_t size) const -> const std::uint8_t *
+            {
+                if (thiz.read_pos + size > thiz.size())
+                {
+                    throw Exception(fmt::format("{}, {}: thiz.read_pos + size <= thiz.size(), {}: {} + {} <= {}", Language::get("offset_outside_bounds_of_data_stream"), Language::get("conditional"), Language::get("but_received"), thiz.read_pos, size, thiz.size()),
+                                    std::source_location::current(), "read_block");
+                }
+                auto source = thiz.view(thiz.read_pos);
+                thiz.read_pos += size;
+                return source;
+            }
+
+            inline auto write_block(
+                const std::uint8_t *source,
+                std::size_t size) const -> void
+            {
+                thiz.write_raw(source, size);
+                return;
+            }
+
             template <typename T>
                 requires std::is_integral_v<T> || std::is_floating_point_v<T>
             inline auto static reverse_endian(T num) -> T
@@ -1673,7 +1936,7 @@ namespace Sen::Kernel::Definition
                                     std::source_location::current(), "read");
                 }
                 auto value = T{0};
-                std::memcpy(&value, thiz.data.data() + thiz.read_pos, sizeof(T));
+                std::memcpy(&value, thiz.view(thiz.read_pos), sizeof(T));
                 thiz.read_pos += sizeof(T);
                 return value;
             }
@@ -1689,7 +1952,7 @@ namespace Sen::Kernel::Definition
                                     std::source_location::current(), "read_has");
                 }
                 auto value = T{0};
-                std::memcpy(&value, thiz.data.data() + thiz.read_pos, size);
+                std::memcpy(&value, thiz.view(thiz.read_pos), size);
                 this->read_pos += size;
                 return value;
             }
@@ -1698,6 +1961,24 @@ namespace Sen::Kernel::Definition
 
             ) const -> void
             {
+                // an uncommitted spill file is dropped without a flush, so close never throw and the destructor is safe
+                if (!thiz.spill_path.empty())
+                {
+                    thiz.spill_file.reset();
+                    if (thiz.spill_temporary)
+                    {
+                        auto error = std::error_code{};
+#if WINDOWS
+                        std::filesystem::remove(std::filesystem::path{String::utf8_to_utf16(thiz.spill_path)}, error);
+#else
+                        std::filesystem::remove(std::filesystem::path{thiz.spill_path}, error);
+#endif
+                    }
+                    thiz.spill_path.clear();
+                    thiz.spill_destination.clear();
+                    thiz.spill_offset = 0_size;
+                    thiz.spill_temporary = false;
+                }
                 thiz.data.clear();
                 thiz.length = 0_size;
                 thiz.read_pos = 0_size;
@@ -1705,6 +1986,160 @@ namespace Sen::Kernel::Definition
                 return;
             }
         };
+
+        // Fixed size gap inside a record, skipped on read and zero on write
+
+        template <std::size_t t_size>
+        struct Padding
+        {
+            inline static constexpr auto size = t_size;
+        };
+
+        // Data member stored with a different width than its declared type, converted on read and write
+
+        template <auto t_member, typename Value>
+        struct As
+        {
+            using Type = Value;
+
+            inline static constexpr auto member = t_member;
+
+            inline static constexpr auto size = sizeof(Value);
+        };
+
+        /**
+         * Compile-time layout of a packed record, each field is a data member pointer, an As or a Padding
+         * The record is bounds checked once and moved as one block
+         * Fields are byte swapped only on big-endian stream
+         */
+
+        template <typename Member>
+        struct RecordMember;
+
+        template <typename Class, typename Value>
+        struct RecordMember<Value Class::*>
+        {
+            using Type = Value;
+        };
+
+        template <auto t_value>
+        inline static constexpr auto record_field_size(
+
+        ) -> std::size_t
+        {
+            if constexpr (std::is_member_object_pointer_v<decltype(t_value)>)
+            {
+                return sizeof(typename RecordMember<decltype(t_value)>::Type);
+            }
+            else
+            {
+                return decltype(t_value)::size;
+            }
+        }
+
+        template <auto... t_field>
+        struct Record
+        {
+        private:
+            template <typename Member>
+            using member_type = typename RecordMember<Member>::Type;
+
+            inline static constexpr auto k_offset = []() {
+                auto result = std::array<std::size_t, sizeof...(t_field)>{};
+                auto offset = std::size_t{0};
+                auto index = std::size_t{0};
+                ((result[index++] = offset, offset += record_field_size<t_field>()), ...);
+                return result;
+            }();
+
+            template <auto use_big_endian, auto t_value, typename Class>
+            inline static auto read_field(
+                const std::uint8_t *source,
+                Class &value) -> void
+            {
+                if constexpr (std::is_member_object_pointer_v<decltype(t_value)>)
+                {
+                    using Value = member_type<decltype(t_value)>;
+                    static_assert(std::is_integral_v<Value> || std::is_floating_point_v<Value>);
+                    auto field = Value{};
+                    std::memcpy(&field, source, sizeof(Value));
+                    if constexpr (use_big_endian)
+                    {
+                        field = Stream<use_big_endian>::reverse_endian(field);
+                    }
+                    value.*t_value = field;
+                }
+                else if constexpr (requires { decltype(t_value)::member; })
+                {
+                    using Stored = typename decltype(t_value)::Type;
+                    auto field = Stored{};
+                    std::memcpy(&field, source, sizeof(Stored));
+                    if constexpr (use_big_endian)
+                    {
+                        field = Stream<use_big_endian>::reverse_endian(field);
+                    }
+                    value.*decltype(t_value)::member = static_cast<member_type<std::remove_cv_t<decltype(decltype(t_value)::member)>>>(field);
+                }
+                return;
+            }
+
+            template <auto use_big_endian, auto t_value, typename Class>
+            inline static auto write_field(
+                std::uint8_t *destination,
+                Class const &value) -> void
+            {
+                if constexpr (std::is_member_object_pointer_v<decltype(t_value)>)
+                {
+                    using Value = member_type<decltype(t_value)>;
+                    static_assert(std::is_integral_v<Value> || std::is_floating_point_v<Value>);
+                    auto field = value.*t_value;
+                    if constexpr (use_big_endian)
+                    {
+                        field = Stream<use_big_endian>::reverse_endian(field);
+                    }
+                    std::memcpy(destination, &field, sizeof(Value));
+                }
+                else if constexpr (requires { decltype(t_value)::member; })
+                {
+                    using Stored = typename decltype(t_value)::Type;
+                    auto field = static_cast<Stored>(value.*decltype(t_value)::member);
+                    if constexpr (use_big_endian)
+                    {
+                        field = Stream<use_big_endian>::reverse_endian(field);
+                    }
+                    std::memcpy(destination, &field, sizeof(Stored));
+                }
+                return;
+            }
+
+        public:
+            inline static constexpr auto size = (record_field_size<t_field>() + ... + std::size_t{0});
+
+            template <auto use_big_endian, typename Class>
+            inline static auto read(
+                Stream<use_big_endian> const &stream,
+                Class &value) -> void
+            {
+                auto source = stream.read_block(size);
+                [&]<std::size_t... t_index>(std::index_sequence<t_index...>) {
+                    (read_field<use_big_endian, t_field>(source + k_offset[t_index], value), ...);
+                }(std::make_index_sequence<sizeof...(t_field)>{});
+                return;
+            }
+
+            template <auto use_big_endian, typename Class>
+            inline static auto write(
+                Stream<use_big_endian> const &stream,
+                Class const &value) -> void
+            {
+                auto block = std::array<std::uint8_t, size>{};
+                [&]<std::size_t... t_index>(std::index_sequence<t_index...>) {
+                    (write_field<use_big_endian, t_field>(block.data() + k_offset[t_index], value), ...);
+                }(std::make_index_sequence<sizeof...(t_field)>{});
+                stream.write_block(block.data(), size);
+                return;
+            }
+        };
     }
     template <bool T>
     using SenBuffer = Sen::Kernel::Definition::Buffer::Stream<T>;
@@ -1712,4 +2147,13 @@ namespace Sen::Kernel::Definition
     using DataStreamView = SenBuffer<false>;
 
     using DataStreamViewBigEndian = SenBuffer<true>;
+
+    template <std::size_t t_size>
+    using Padding = Buffer::Padding<t_size>;
+
+    template <auto t_member, typename Value>
+    using As = Buffer::As<t_member, Value>;
+
+    template <auto... t_field>
+    using Record = Buffer::Record<t_field...>;
 }
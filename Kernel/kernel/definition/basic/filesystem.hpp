@@ -4,6 +4,7 @@
 #include "kernel/definition/assert.hpp"
 #include "kernel/definition/basic/string.hpp"
 #include "kernel/definition/basic/path.hpp"
+#include "kernel/definition/basic/thread.hpp"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -339,6 +340,77 @@ namespace Sen::Kernel::FileSystem
 		return data;	
 	}
 
+	// filepath: the file to measure
+	// return: the file size in bytes, the file is not opened
+
+	inline static auto file_size(
+		std::string_view filepath
+	) -> std::size_t
+	{
+		auto error = std::error_code{};
+		#if WINDOWS
+		auto size = fs::file_size(String::utf8view_to_utf16(fmt::format("\\\\?\\{}", String::to_windows_style(filepath.data()))), error);
+		#else
+		auto size = fs::file_size(fs::path{std::string{filepath.data(), filepath.size()}}, error);
+		#endif
+		assert_conditional(!error, fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "file_size");
+		return static_cast<std::size_t>(size);
+	}
+
+	// filepath: the file to read
+	// destination: receive the whole file, its capacity is reused when large enough
+
+	template <typename T> requires CharacterBufferView<T>
+	inline static auto read_binary(
+		std::string_view filepath,
+		std::vector<T> & destination
+	) -> void
+	{
+		#if WINDOWS
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
+				String::to_windows_style(filepath.data()))).data(), L"rb"), close_file);
+		#else
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(std::fopen(String::to_posix_style(std::string{filepath.data(), filepath.size()}).data(), "rb"), close_file);
+		#endif
+		assert_conditional(file != nullptr, fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "read_binary");
+		destination.resize(file_size(filepath));
+		assert_conditional(std::fread(destination.data(), 1, destination.size(), file.get()) == destination.size(), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "read_binary");
+		return;
+	}
+
+	// filepath: the file to read
+	// chunk_size: maximum bytes handed to the callback at once
+	// callback: receive every chunk as a span, in file order
+	// return: the whole file is read without being held in memory
+
+	template <typename Callback>
+	inline static auto read_chunk(
+		std::string_view filepath,
+		std::size_t chunk_size,
+		const Callback & callback
+	) -> void
+	{
+		#if WINDOWS
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
+				String::to_windows_style(filepath.data()))).data(), L"rb"), close_file);
+		#else
+		auto file = std::unique_ptr<FILE, decltype(close_file)>(std::fopen(filepath.data(), "rb"), close_file);
+		#endif
+		assert_conditional(file != nullptr, fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "read_chunk");
+		auto buffer = std::vector<std::uint8_t>(chunk_size);
+		while (true) {
+			auto size = std::fread(buffer.data(), 1, buffer.size(), file.get());
+			if (size != 0) {
+				callback(std::span<const std::uint8_t>{buffer.data(), size});
+			}
+			if (size < buffer.size()) {
+				assert_conditional(std::ferror(file.get()) == 0, fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(filepath.data())), "read_chunk");
+				break;
+			}
+		}
+		return;
+	}
+
 	// dirPath: directory to read
 	// return: everything inside it even directory or file
 
@@ -413,38 +485,214 @@ namespace Sen::Kernel::FileSystem
 	}
 
 
-	// dirPath: directory to read
-	// return: only files inside nested directories
+	/**
+	 * Filter used by walk_directory
+	 * extension: accepted extensions with the dot, compared case-insensitively, empty accept every file
+	 * pattern: glob matched against the path relative to the walked directory with '/' separators
+	 * '*' and '?' never cross a separator, '**' does, empty accept every file
+	*/
 
-	inline static auto read_whole_directory(
-		std::string_view directory_path
-	) -> std::vector<std::string> const
+	struct DirectoryFilter {
+
+		std::vector<std::string> extension{};
+
+		std::string pattern{};
+
+	};
+
+	// pattern: glob pattern
+	// value: relative path to test
+	// return: true if the whole value match the pattern
+
+	inline static auto match_pattern(
+		std::string_view pattern,
+		std::string_view value
+	) -> bool
+	{
+		auto pattern_index = 0_size;
+		auto value_index = 0_size;
+		while (pattern_index < pattern.size()) {
+			if (pattern[pattern_index] == '*') {
+				auto recursive = pattern_index + 1 < pattern.size() && pattern[pattern_index + 1] == '*';
+				auto next = pattern_index + (recursive ? 2_size : 1_size);
+				if (recursive && next < pattern.size() && pattern[next] == '/' && match_pattern(pattern.substr(next + 1), value.substr(value_index))) {
+					return true;
+				}
+				for (auto index = value_index; ; ++index) {
+					if (match_pattern(pattern.substr(next), value.substr(index))) {
+						return true;
+					}
+					if (index == value.size() || (!recursive && value[index] == '/')) {
+						return false;
+					}
+				}
+			}
+			if (value_index == value.size() || value[value_index] == '/' && pattern[pattern_index] == '?') {
+				return false;
+			}
+			if (pattern[pattern_index] != '?' && pattern[pattern_index] != value[value_index]) {
+				return false;
+			}
+			++pattern_index;
+			++value_index;
+		}
+		return value_index == value.size();
+	}
+
+	// filter: directory filter
+	// path: full path of the file
+	// offset: size of the walked directory prefix inside path
+	// return: true if the file pass the filter
+
+	inline static auto match_filter(
+		const DirectoryFilter & filter,
+		std::string_view path,
+		std::size_t offset
+	) -> bool
+	{
+		if (!filter.extension.empty()) {
+			auto matched = std::any_of(filter.extension.begin(), filter.extension.end(), [&](const std::string & extension) {
+				return path.size() >= extension.size() && std::equal(extension.begin(), extension.end(), path.end() - extension.size(), [](char lhs, char rhs) {
+					return std::tolower(static_cast<unsigned char>(lhs)) == std::tolower(static_cast<unsigned char>(rhs));
+				});
+			});
+			if (!matched) {
+				return false;
+			}
+		}
+		if (!filter.pattern.empty()) {
+			auto relative = std::string{path.substr(offset)};
+			#if WINDOWS
+				std::replace(relative.begin(), relative.end(), '\\', '/');
+			#endif
+			return match_pattern(filter.pattern, relative);
+		}
+		return true;
+	}
+
+	/**
+	 * Walk every nested directory on a bounded pool of threads
+	 * directory_path: directory to walk
+	 * filter: files that do not pass the filter are skipped
+	 * callback: receive batches of normalized file paths, always on the calling thread
+	 * limit: maximum thread count
+	 * Batches arrive in no particular order
+	*/
+
+	template <typename Callback>
+	inline static auto walk_directory(
+		std::string_view directory_path,
+		const DirectoryFilter & filter,
+		const Callback & callback,
+		std::size_t limit = ThreadPool::hardware_concurrency()
+	) -> void
 	{
-		auto result = std::vector<string>{};
 		#if WINDOWS
-				for (auto& c : fs::directory_iterator(String::utf8_to_utf16(directory_path.data())))
+			auto static constexpr separator = '\\';
 		#else
-				for (auto& c : fs::directory_iterator(directory_path))
+			auto static constexpr separator = '/';
 		#endif
-		{
-			if(c.is_directory()){
+		auto root = Path::normalize(std::string{directory_path.data(), directory_path.size()});
+		if (root.empty() || root.back() != separator) {
+			root += separator;
+		}
+		auto offset = root.size();
+		auto mutex = std::mutex{};
+		auto signal = std::condition_variable{};
+		auto batch = std::vector<std::string>{};
+		auto remaining = 1_size;
+		auto cancelled = false;
+		auto exception = std::exception_ptr{};
+		auto visit = std::function<void(std::string)>{};
+		auto pool = ThreadPool{limit};
+		visit = [&](std::string directory) {
+			auto files = std::vector<std::string>{};
+			try {
+				auto skip = false;
+				{
+					auto lock = std::lock_guard<std::mutex>(mutex);
+					skip = cancelled;
+				}
 				#if WINDOWS
-					for (auto& e : read_whole_directory(String::utf16_to_utf8(c.path().wstring())))
+					for (auto& c : skip ? fs::directory_iterator{} : fs::directory_iterator(String::utf8_to_utf16(directory)))
 				#else
-					for (auto& e : read_whole_directory(c.path().string()))
+					for (auto& c : skip ? fs::directory_iterator{} : fs::directory_iterator(directory))
 				#endif
 				{
-					result.emplace_back(Path::normalize(e));
+					#if WINDOWS
+						auto path = directory + String::utf16_to_utf8(c.path().filename().wstring());
+					#else
+						auto path = directory + c.path().filename().string();
+					#endif
+					if (c.is_directory()) {
+						path += separator;
+						{
+							auto lock = std::lock_guard<std::mutex>(mutex);
+							++remaining;
+						}
+						pool.enqueue([&visit, path = std::move(path)]() { visit(path); });
+					}
+					else if (match_filter(filter, path, offset)) {
+						files.emplace_back(std::move(path));
+					}
 				}
 			}
-			else{
-				#if WINDOWS
-					result.emplace_back(Path::normalize(String::utf16_to_utf8(c.path().wstring())));
-				#else
-					result.emplace_back(Path::normalize(c.path().string()));
-				#endif
+			catch (...) {
+				auto lock = std::lock_guard<std::mutex>(mutex);
+				if (exception == nullptr) {
+					exception = std::current_exception();
+				}
+			}
+			auto lock = std::lock_guard<std::mutex>(mutex);
+			if (batch.empty()) {
+				batch = std::move(files);
 			}
+			else {
+				batch.insert(batch.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+			}
+			--remaining;
+			signal.notify_one();
+		};
+		pool.enqueue([&visit, &root]() { visit(root); });
+		auto lock = std::unique_lock<std::mutex>(mutex);
+		try {
+			while (true) {
+				signal.wait(lock, [&]() { return !batch.empty() || remaining == 0; });
+				if (batch.empty()) {
+					break;
+				}
+				auto current = std::move(batch);
+				batch.clear();
+				lock.unlock();
+				callback(std::move(current));
+				lock.lock();
+			}
+		}
+		catch (...) {
+			if (!lock.owns_lock()) {
+				lock.lock();
+			}
+			cancelled = true;
+			throw;
+		}
+		if (exception != nullptr) {
+			std::rethrow_exception(exception);
 		}
+		return;
+	}
+
+	// dirPath: directory to read
+	// return: only files inside nested directories, sorted
+
+	inline static auto read_whole_directory(
+		std::string_view directory_path
+	) -> std::vector<std::string> const
+	{
+		auto result = std::vector<std::string>{};
+		walk_directory(directory_path, DirectoryFilter{}, [&](std::vector<std::string> && files) {
+			result.insert(result.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+		});
+		std::sort(result.begin(), result.end());
 		return result;
 	}
 
@@ -474,6 +722,29 @@ namespace Sen::Kernel::FileSystem
 		return;
 	}
 
+	/**
+	 * outFile: the output file to write
+	 * data: view of the bytes to write, nothing is copied
+	*/
+
+	inline static auto write_binary(
+		std::string_view filepath,
+		std::span<const std::uint8_t> data
+	) -> void
+	{
+		#if WINDOWS
+				auto file = std::unique_ptr<FILE, decltype(close_file)>(_wfopen(String::utf8view_to_utf16(fmt::format("\\\\?\\{}",
+				String::to_windows_style(filepath.data()))).data(), L"wb"), close_file);
+		#else
+				auto file = std::unique_ptr<FILE, decltype(close_file)>(std::fopen(String::to_posix_style(std::string{filepath.data(), filepath.size()}).data(), "wb"), close_file);
+		#endif
+		if(file == nullptr){
+			throw Exception(fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(filepath.data())), std::source_location::current(), "write_binary");
+		}
+		assert_conditional(std::fwrite(data.data(), 1, data.size(), file.get()) == data.size(), fmt::format("{}: {}", Language::get("write_file_error"), String::to_posix_style(filepath.data())), "write_binary");
+		return;
+	}
+
 
 	/**
 	 * file path: the file path to read
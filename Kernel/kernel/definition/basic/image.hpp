@@ -692,11 +692,13 @@ namespace Sen::Kernel::Definition {
 			/**
 			 * libpng readpng adapation -> C++ implementation
 			 * file path: provide file path to read
+			 * transform: libpng read transforms, the image is returned as stored by default
 			 * return: image data
 			*/
 			
 			inline static auto read_png(
-				std::string_view source
+				std::string_view source,
+				int transform = PNG_TRANSFORM_IDENTITY
 			) -> Image<int> 
 			{
 				#if WINDOWS
@@ -722,7 +724,7 @@ namespace Sen::Kernel::Definition {
 					throw Exception(fmt::format("{}: {}", Language::get("image.unknown_error"), source), std::source_location::current(), "read_png");
 				}
 				png_init_io(png_ptr, fp.get());
-				png_read_png(png_ptr, info_ptr, PNG_TRANSFORM_IDENTITY, nullptr);
+				png_read_png(png_ptr, info_ptr, transform, nullptr);
 				auto row_pointers = png_get_rows(png_ptr, info_ptr);
 				auto data = std::vector<unsigned char>();
 				auto width = static_cast<int>(png_get_image_width(png_ptr, info_ptr));
@@ -0,0 +1,261 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+#include "kernel/definition/assert.hpp"
+#include "kernel/definition/basic/string.hpp"
+#include "kernel/definition/basic/filesystem.hpp"
+
+namespace Sen::Kernel::Definition
+{
+    /**
+     * Typed json reader on top of simdjson on demand parser,
+     * the value is converted straight into the structure without building a DOM
+     * Custom structure provide: from_json(simdjson::ondemand::value, T &) found by ADL
+     */
+
+    namespace JsonReader
+    {
+        using Value = simdjson::ondemand::value;
+
+        template <typename T>
+        struct is_vector : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_vector<std::vector<T>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        struct is_string_map : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_string_map<std::map<std::string, T>> : std::true_type
+        {
+        };
+
+        inline static auto read_generic(
+            Value value,
+            nlohmann::ordered_json &result) -> void
+        {
+            switch (value.type())
+            {
+            case simdjson::ondemand::json_type::object:
+            {
+                result = nlohmann::ordered_json::object();
+                for (auto field : value.get_object())
+                {
+                    auto key = std::string{static_cast<std::string_view>(field.unescaped_key())};
+                    read_generic(field.value(), result[key]);
+                }
+                break;
+            }
+            case simdjson::ondemand::json_type::array:
+            {
+                result = nlohmann::ordered_json::array();
+                for (auto element : value.get_array())
+                {
+                    read_generic(element.value(), result.emplace_back());
+                }
+                break;
+            }
+            case simdjson::ondemand::json_type::string:
+            {
+                result = std::string{static_cast<std::string_view>(value.get_string())};
+                break;
+            }
+            case simdjson::ondemand::json_type::number:
+            {
+                switch (static_cast<simdjson::ondemand::number_type>(value.get_number_type()))
+                {
+                case simdjson::ondemand::number_type::signed_integer:
+                {
+                    result = static_cast<int64_t>(value.get_int64());
+                    break;
+                }
+                case simdjson::ondemand::number_type::unsigned_integer:
+                {
+                    result = static_cast<uint64_t>(value.get_uint64());
+                    break;
+                }
+                default:
+                {
+                    result = static_cast<double>(value.get_double());
+                    break;
+                }
+                }
+                break;
+            }
+            case simdjson::ondemand::json_type::boolean:
+            {
+                result = static_cast<bool>(value.get_bool());
+                break;
+            }
+            default:
+            {
+                result = nullptr;
+                break;
+            }
+            }
+            return;
+        }
+
+        template <typename T>
+        inline static auto read(
+            Value value,
+            T &result) -> void
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                result = static_cast<bool>(value.get_bool());
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                auto data = std::underlying_type_t<T>{};
+                read(value, data);
+                result = static_cast<T>(data);
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                if (value.is_negative())
+                {
+                    result = static_cast<T>(static_cast<int64_t>(value.get_int64()));
+                }
+                else
+                {
+                    result = static_cast<T>(static_cast<uint64_t>(value.get_uint64()));
+                }
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                result = static_cast<T>(static_cast<double>(value.get_double()));
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                result = std::string{static_cast<std::string_view>(value.get_string())};
+            }
+            else if constexpr (std::is_same_v<T, nlohmann::ordered_json>)
+            {
+                read_generic(value, result);
+            }
+            else if constexpr (is_vector<T>::value)
+            {
+                result.clear();
+                for (auto element : value.get_array())
+                {
+                    read(element.value(), result.emplace_back());
+                }
+            }
+            else if constexpr (is_string_map<T>::value)
+            {
+                result.clear();
+                for (auto field : value.get_object())
+                {
+                    auto key = std::string{static_cast<std::string_view>(field.unescaped_key())};
+                    read(field.value(), result[key]);
+                }
+            }
+            else
+            {
+                from_json(value, result);
+            }
+            return;
+        }
+
+        /**
+         * Keys an object must carry, nlohmann at() used to throw when one was absent
+         * visit every key while the object is iterated, then check once it is finished
+         */
+
+        template <auto size>
+        struct RequiredKey
+        {
+            std::array<std::string_view, size> name;
+
+            std::array<bool, size> seen{};
+
+            inline auto visit(
+                std::string_view key) -> void
+            {
+                for (auto index = std::size_t{0}; index < size; ++index)
+                {
+                    if (thiz.name[index] == key)
+                    {
+                        thiz.seen[index] = true;
+                        return;
+                    }
+                }
+                return;
+            }
+
+            inline auto check() const -> void
+            {
+                for (auto index = std::size_t{0}; index < size; ++index)
+                {
+                    if (!thiz.seen[index])
+                    {
+                        throw Exception(String::format(fmt::format("{}", Language::get("json_reader.missing_key")), std::string{thiz.name[index]}), std::source_location::current(), "check");
+                    }
+                }
+                return;
+            }
+        };
+
+        template <typename... Key>
+        inline static auto required_key(
+            Key... key) -> RequiredKey<sizeof...(Key)>
+        {
+            return RequiredKey<sizeof...(Key)>{.name = {std::string_view{key}...}};
+        }
+
+        // Null check without consuming the value
+
+        inline static auto is_null(
+            Value value) -> bool
+        {
+            return static_cast<bool>(value.is_null());
+        }
+
+        /**
+         * source: json file path
+         * result: structure to fill
+         */
+
+        template <typename T>
+        inline static auto read_fs(
+            std::string_view source,
+            T &result) -> void
+        {
+            auto content = simdjson::padded_string{FileSystem::read_file(source)};
+            auto parser = simdjson::ondemand::parser{};
+            try
+            {
+                auto document = static_cast<simdjson::ondemand::document>(parser.iterate(content));
+                read(static_cast<Value>(document.get_value()), result);
+                if (!document.at_end())
+                {
+                    throw Exception(String::format(fmt::format("{}", Language::get("json_reader.trailing_content")), String::to_posix_style(std::string{source})), std::source_location::current(), "read_fs");
+                }
+            }
+            catch (simdjson::simdjson_error &e)
+            {
+                throw Exception(String::format(fmt::format("{}", Language::get("json_reader.invalid_json")), String::to_posix_style(std::string{source}), std::string{e.what()}), std::source_location::current(), "read_fs");
+            }
+            return;
+        }
+
+        template <typename T>
+        inline static auto read_fs(
+            std::string_view source) -> T
+        {
+            auto result = T{};
+            read_fs(source, result);
+            return result;
+        }
+
+    }
+}
@@ -121,193 +121,166 @@ namespace Sen::Kernel::Definition
         struct JsonWriterHelper
         {
 
-        private:
-            inline static constexpr auto utf8_d = std::array<std::uint8_t, 400>{
-                {
-                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 00..1F
-                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 20..3F
-                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 40..5F
-                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 60..7F
-                    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, // 80..9F
-                    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, // A0..BF
-                    8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // C0..DF
-                    0xA, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3,                 // E0..EF
-                    0xB, 0x6, 0x6, 0x6, 0x5, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,                 // F0..FF
-                    0x0, 0x1, 0x2, 0x3, 0x5, 0x8, 0x7, 0x1, 0x1, 0x1, 0x4, 0x6, 0x1, 0x1, 0x1, 0x1,                 // s0..s0
-                    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, // s1..s2
-                    1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, // s3..s4
-                    1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, // s5..s6
-                    1, 3, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1  // s7..s8
-                }};
-
         protected:
-            inline static auto Decode(
-                std::uint8_t &state,
-                std::uint32_t &codepoint,
-                const std::uint8_t byte) -> std::uint8_t
+            inline static constexpr auto k_byte_one = 0x0101010101010101ull;
+
+            inline static constexpr auto k_byte_high = 0x8080808080808080ull;
+
+            inline static constexpr auto k_hex = std::string_view{"0123456789abcdef"};
+
+            inline static auto IsSpecial(
+                std::uint8_t character,
+                bool stop_on_non_ascii) -> bool
             {
-                assert_conditional(byte < utf8_d.size(), fmt::format("{}", Language::get("json_writer.byte_cannot_smaller_than_utf8_size")), "Decode");
-                auto type = static_cast<std::uint8_t>(utf8_d[byte]);
-                codepoint = (state != 0_byte)
-                                ? (byte & 0x3fu) | (codepoint << 6u)
-                                : (0xFFu >> type) & (byte);
-                auto index = 256u + static_cast<size_t>(state) * 16u + static_cast<size_t>(type);
-                assert_conditional(index < utf8_d.size(), fmt::format("{}", Language::get("json_writer.index_cannot_smaller_than_utf8_size")), "Decode");
-                state = utf8_d[index];
-                return state;
+                return character < 0x20u || character == JsonConstants::Quotation_Mark_Point || character == JsonConstants::Reverse_Solidus_Point || (stop_on_non_ascii && character >= 0x80u);
             }
 
-            inline static auto ComputeUtf8CharacterExtraSize(
-                char const &character) -> size_t
+            /*
+                Index of the first byte that has to be escaped, or that is not ascii when stop_on_non_ascii is set.
+                Eight bytes are tested at once, the exact byte is only searched inside a word that has one.
+            */
+            inline static auto FindSpecial(
+                std::string_view value,
+                std::size_t position,
+                bool stop_on_non_ascii) -> std::size_t
             {
-                auto extra_size = size_t{};
-                if (character < 0b1'0000000)
-                {
-                    extra_size = 0;
-                }
-                else if (character < 0b11'000000)
-                {
-                    assert("first utf-8 character is valid");
-                }
-                else if (character < 0b111'00000)
-                {
-                    extra_size = 1;
-                }
-                else if (character < 0b1111'0000)
-                {
-                    extra_size = 2;
-                }
-                else if (character < 0b11111'000)
-                {
-                    extra_size = 3;
+                for (; position + 8_size <= value.size(); position += 8_size)
+                {
+                    auto word = std::uint64_t{};
+                    std::memcpy(&word, value.data() + position, sizeof(word));
+                    auto quote = word ^ (k_byte_one * JsonConstants::Quotation_Mark_Point);
+                    auto reverse_solidus = word ^ (k_byte_one * JsonConstants::Reverse_Solidus_Point);
+                    auto mask = ((word - k_byte_one * 0x20u) & ~word) | ((quote - k_byte_one) & ~quote) | ((reverse_solidus - k_byte_one) & ~reverse_solidus);
+                    if (stop_on_non_ascii)
+                    {
+                        mask |= word;
+                    }
+                    if ((mask & k_byte_high) != 0ull)
+                    {
+                        break;
+                    }
                 }
-                else
+                for (; position < value.size(); ++position)
                 {
-                    assert("first utf-8 character is valid");
+                    if (IsSpecial(static_cast<std::uint8_t>(value[position]), stop_on_non_ascii))
+                    {
+                        break;
+                    }
                 }
-                return extra_size;
-            }
-
-            inline static auto ClipBitChar(
-                char const &it,
-                size_t const &begin,
-                size_t const &size) -> std::string
-            {
-                return std::to_string((it >> begin) & ~(static_cast<char>((std::numeric_limits<char>::max)()) << size));
+                return position;
             }
 
         public:
-            // Unnecessary.
             /*
-            inline static auto Validate(std::string propertyName) -> void
-            {
-                return;
-            }
+                Runs without anything to escape are appended in one go.
+                Non ascii bytes are validated once with simdjson, then copied as they are.
             */
-
             inline static auto WriteEscapeString(
                 std::string &output,
-                const std::string &s) -> void
+                std::string_view value) -> void
             {
-                /*
-                if (value.find(JsonConstants::BackSlash) != std::string::npos)
-                {
-                    value = std::regex_replace(value, JsonConstants::backslash_pattern, "\\\\");
-                }
-                */
-                auto codepoint = std::uint32_t{0};
-                auto state = 0_byte;
-                for (auto i = 0; i < s.size(); i++)
+                auto position = 0_size;
+                auto stop_on_non_ascii = true;
+                while (true)
                 {
-                    if (Decode(state, codepoint, static_cast<std::uint8_t>(s[i])) == 0_byte)
+                    auto next = FindSpecial(value, position, stop_on_non_ascii);
+                    output.append(value.data() + position, next - position);
+                    if (next == value.size())
+                    {
+                        break;
+                    }
+                    auto character = static_cast<std::uint8_t>(value[next]);
+                    position = next + 1_size;
+                    if (character >= 0x80u)
+                    {
+                        assert_conditional(simdjson::validate_utf8(value.data() + next, value.size() - next), fmt::format("{}", Language::get("json_writer.incomplete_utf8_string")), "WriteEscapeString");
+                        stop_on_non_ascii = false;
+                        output += static_cast<char>(character);
+                        continue;
+                    }
+                    switch (character)
                     {
-                        switch (codepoint)
-                        {
-                        case JsonConstants::Backspace_Point: // backspace
-                        {
-                            output += "\\b";
-                            break;
-                        }
-
-                        case JsonConstants::Horizontal_Tab_Point: // horizontal tab
-                        {
-                            output += "\\t";
-                            break;
-                        }
-
-                        case JsonConstants::Newline_Point: // newline
-                        {
-                            output += "\\n";
-                            break;
-                        }
-
-                        case JsonConstants::Formfeed_Point: // formfeed
-                        {
-                            output += "\\f";
-                            break;
-                        }
-
-                        case JsonConstants::Carriage_Return_Point: // carriage return
-                        {
-                            output += "\\r";
-                            break;
-                        }
-
-                        case JsonConstants::Quotation_Mark_Point: // quotation mark
-                        {
-                            output += "\\\"";
-                            break;
-                        }
-                        case JsonConstants::Reverse_Solidus_Point: // reverse solidus
-                        {
-                            output += "\\\\";
-                            break;
-                        }
-                        default:
-                            auto &char_str = s[i];
-                            if ((codepoint <= 0x1F))
-                            {
-                                if (codepoint >= 0xFFFF)
-                                {
-                                    output += "\\u";
-                                    output += ClipBitChar(char_str, 28, 4);
-                                    output += ClipBitChar(char_str, 24, 4);
-                                    output += ClipBitChar(char_str, 20, 4);
-                                    output += ClipBitChar(char_str, 16, 4);
-                                }
-                                output += "\\u";
-                                output += ClipBitChar(char_str, 12, 4);
-                                output += ClipBitChar(char_str, 8, 4);
-                                output += ClipBitChar(char_str, 4, 4);
-                                output += ClipBitChar(char_str, 0, 4);
-                            }
-                            else
-                            {
-                                output += char_str;
-                            }
-                            break;
-                        }
+                    case JsonConstants::Backspace_Point:
+                    {
+                        output += "\\b";
+                        break;
+                    }
+                    case JsonConstants::Horizontal_Tab_Point:
+                    {
+                        output += "\\t";
+                        break;
+                    }
+                    case JsonConstants::Newline_Point:
+                    {
+                        output += "\\n";
+                        break;
                     }
-                    else
+                    case JsonConstants::Formfeed_Point:
                     {
-                        auto extra_size = ComputeUtf8CharacterExtraSize(s[i]);
-                        output += s[i];
-                        while (extra_size > 0)
-                        {
-                            --extra_size;
-                            auto char_8 = s[++i];
-                            if ((char_8 & 0b11'000000) != 0b11'000000)
-                            {
-                                assert("extra utf-8 character is valid");
-                            }
-                            output += char_8;
-                        }
+                        output += "\\f";
+                        break;
+                    }
+                    case JsonConstants::Carriage_Return_Point:
+                    {
+                        output += "\\r";
+                        break;
+                    }
+                    case JsonConstants::Quotation_Mark_Point:
+                    {
+                        output += "\\\"";
+                        break;
+                    }
+                    case JsonConstants::Reverse_Solidus_Point:
+                    {
+                        output += "\\\\";
+                        break;
+                    }
+                    default:
+                    {
+                        output += "\\u00";
+                        output += k_hex[character >> 4];
+                        output += k_hex[character & 0xFu];
+                        break;
+                    }
                     }
                 }
-                assert_conditional(state == 0_byte, fmt::format("{}", Language::get("json_writer.incomplete_utf8_string")), "WriteEscapeString");
                 return;
             }
 
+            /*
+                Number text written straight into a stack buffer, no std::string is built.
+                Floating values use the shortest text that read back to the same value,
+                a decimal point is kept so they are not read back as integer.
+            */
+            template <typename T>
+                requires std::is_arithmetic_v<T>
+            inline static auto FormatNumber(
+                std::array<char, 64> &buffer,
+                T value) -> std::string_view
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    auto end = fmt::format_to(buffer.data(), "{}", value);
+                    auto result = std::string_view{buffer.data(), static_cast<std::size_t>(end - buffer.data())};
+                    if (result.find_first_of(".eEn") == std::string_view::npos)
+                    {
+                        *end++ = '.';
+                        *end++ = '0';
+                    }
+                    return std::string_view{buffer.data(), static_cast<std::size_t>(end - buffer.data())};
+                }
+                else if constexpr (sizeof(T) < sizeof(int))
+                {
+                    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), static_cast<int>(value));
+                    return std::string_view{buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())};
+                }
+                else
+                {
+                    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+                    return std::string_view{buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())};
+                }
+            }
+
             inline static auto
             WriteNewLine(std::string &output) -> void
             {
@@ -321,10 +294,7 @@ namespace Sen::Kernel::Definition
 
             inline static auto WriteIndentation(std::string &output, int indent) -> void
             {
-                for (auto i : Range<int>(indent))
-                {
-                    output += JsonConstants::Tab;
-                }
+                output.append(static_cast<std::size_t>(std::max(indent, 0)), '\t');
                 return;
             }
         };
@@ -348,7 +318,7 @@ namespace Sen::Kernel::Definition
 
             std::size_t mutable _indentLength = 1;
 
-            inline auto WriteStart(const std::string &token) const -> void
+            inline auto WriteStart(std::string_view token) const -> void
             {
                 if (thiz.WriteIndent)
                 {
@@ -371,7 +341,7 @@ namespace Sen::Kernel::Definition
                 Writes the UTF-8 property name (as a JSON string) as the first part of a name/value pair of a JSON object.
             */
 
-            inline auto WriteStringPropertyName(const std::string &propertyName) const -> void
+            inline auto WriteStringPropertyName(std::string_view propertyName) const -> void
             {
                 if (thiz.WriteIndent)
                 {
@@ -392,7 +362,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteStringValue(const std::string &value) const -> void
+            inline auto WriteStringValue(std::string_view value) const -> void
             {
                 if (thiz.WriteIndent)
                 {
@@ -412,7 +382,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteSimpleIndented(const std::string &value) const -> void
+            inline auto WriteSimpleIndented(std::string_view value) const -> void
             {
                 if (thiz._currentDepth < 0)
                 {
@@ -431,7 +401,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteSimpleValue(const std::string &value) const -> void
+            inline auto WriteSimpleValue(std::string_view value) const -> void
             {
                 if (thiz.WriteIndent)
                 {
@@ -449,7 +419,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteEnd(const std::string &token) const -> void
+            inline auto WriteEnd(std::string_view token) const -> void
             {
                 if (thiz.WriteIndent)
                 {
@@ -467,7 +437,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteStringIndented(const std::string &value) const -> void
+            inline auto WriteStringIndented(std::string_view value) const -> void
             {
                 if (thiz._currentDepth < 0)
                 {
@@ -488,7 +458,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteStringIndentedPropertyName(const std::string &propertyName) const -> void
+            inline auto WriteStringIndentedPropertyName(std::string_view propertyName) const -> void
             {
                 auto indent = thiz._currentDepth & JsonConstants::RemoveFlagsBitMask * thiz._indentLength;
                 if (thiz._currentDepth < 0)
@@ -508,7 +478,7 @@ namespace Sen::Kernel::Definition
                 return;
             }
 
-            inline auto WriteEndIndented(const std::string &token) const -> void
+            inline auto WriteEndIndented(std::string_view token) const -> void
             {
                 if (thiz._tokenType == StartArray || thiz._tokenType == StartObject)
                 {
@@ -604,7 +574,7 @@ namespace Sen::Kernel::Definition
                 Writes the property name (as a JSON string) as the first part of a name/value pair of a JSON object.
                 @param[in] properyName The name of the property to write.
             */
-            inline auto WritePropertyName(const std::string &propertyName) const -> void
+            inline auto WritePropertyName(std::string_view propertyName) const -> void
             {
                 thiz.WriteStringPropertyName(propertyName);
                 thiz._tokenType = PropertyName;
@@ -626,7 +596,7 @@ namespace Sen::Kernel::Definition
                 Writes the pre-encoded text value (as a JSON string) as an element of a JSON.
                 @param[in] value The JSON-encoded value to write.
             */
-            inline auto WriteValue(const std::string &value) const -> void
+            inline auto WriteValue(std::string_view value) const -> void
             {
                 thiz.WriteStringValue(value);
                 thiz._tokenType = String;
@@ -640,8 +610,8 @@ namespace Sen::Kernel::Definition
                 requires std::is_arithmetic_v<T>
             inline auto WriteValue(T value) const -> void
             {
-                auto num_value = std::to_string(value);
-                thiz.WriteSimpleValue(num_value);
+                auto buffer = std::array<char, 64>{};
+                thiz.WriteSimpleValue(JsonWriterHelper::FormatNumber(buffer, value));
                 thiz._tokenType = Number;
                 return;
             }
@@ -684,6 +654,15 @@ namespace Sen::Kernel::Definition
                 thiz.Clear();
                 return baseString;
             }
+
+            /*
+                View of the written json without copying it.
+                The view is only valid until the next write or Clear.
+            */
+            inline auto View() const -> std::string_view
+            {
+                return thiz._baseString;
+            }
         };
 
         // Unnecessary.
@@ -6,6 +6,8 @@
 #include <cstdio>
 #include <vector>
 #include <cstdarg>
+#include <cstdint>
+#include <algorithm>
 #include <string_view>
 #include "kernel/dependencies/json.hpp"
 #include "kernel/definition/assert.hpp"
@@ -14,11 +16,74 @@
 namespace Sen::Kernel::Language
 {
 
+	// Identifier definition
+	// FNV-1a 64 of the key, computed at compile-time for literal keys
+
+	using Identifier = std::uint64_t;
+
+	inline static constexpr auto hash(
+		std::string_view key
+	) -> Identifier
+	{
+		auto value = static_cast<Identifier>(0xCBF29CE484222325ull);
+		for (auto & c : key) {
+			value ^= static_cast<std::uint8_t>(c);
+			value *= static_cast<Identifier>(0x100000001B3ull);
+		}
+		return value;
+	}
+
+	/**
+	 * Message key with its precomputed identifier
+	 * String literal are hashed at compile-time, other keys are hashed once on lookup
+	*/
+
+	struct Message {
+
+		Identifier identifier;
+
+		std::string_view key;
+
+		template <std::size_t Size>
+		consteval Message(
+			const char (&value)[Size]
+		) : identifier(hash(std::string_view{value, Size - 1})), key(value, Size - 1)
+		{
+
+		}
+
+		constexpr Message(
+			std::string_view value
+		) : identifier(hash(value)), key(value)
+		{
+
+		}
+
+		Message(
+			const std::string & value
+		) : Message(std::string_view{value})
+		{
+
+		}
+
+	};
+
 	/**
 	 * DO NOT USE THIS, THIS IS LANGUAGE CONTAINER
+	 * Flat table sorted by identifier, filled once by read_language
 	*/
 
-	static std::unordered_map<std::string, std::string> language;
+	struct Entry {
+
+		Identifier identifier;
+
+		std::string key;
+
+		std::string value;
+
+	};
+
+	inline static auto language = std::vector<Entry>{};
 
 	/**
 	 * Lambda auto close file
@@ -61,7 +126,15 @@ namespace Sen::Kernel::Language
 			#endif
 		}
 		auto buffer = std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-		language = nlohmann::ordered_json::parse(buffer);
+		auto json = nlohmann::ordered_json::parse(buffer);
+		language.clear();
+		language.reserve(json.size());
+		for (auto & element : json.items()) {
+			language.emplace_back(hash(element.key()), element.key(), element.value().get<std::string>());
+		}
+		std::stable_sort(language.begin(), language.end(), [](auto const & lhs, auto const & rhs) {
+			return lhs.identifier < rhs.identifier;
+		});
 		return;
 	}
 
@@ -72,12 +145,17 @@ namespace Sen::Kernel::Language
 	*/
 
 	inline static auto get(
-		std::string_view key
+		Message const & message
 	) -> std::string_view
 	{
-		if (language.find(key.data()) == language.end()){
-			return key;
+		auto entry = std::lower_bound(language.begin(), language.end(), message.identifier, [](auto const & element, Identifier identifier) {
+			return element.identifier < identifier;
+		});
+		for (; entry != language.end() && entry->identifier == message.identifier; ++entry) {
+			if (entry->key == message.key) {
+				return entry->value;
+			}
 		}
-		return language[key.data()];
+		return message.key;
 	}
 }
\ No newline at end of file
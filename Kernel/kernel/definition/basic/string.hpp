@@ -1221,6 +1221,24 @@ namespace Sen::Kernel {
 				return ss.str();
 			}
 
+			/**
+			 * bytes: the bytes to stringify
+			 * return: lowercase hexadecimal string, two characters per byte
+			*/
+
+			inline static auto to_hexadecimal (
+				std::span<const std::uint8_t> bytes
+			) -> std::string
+			{
+				static constexpr auto character = std::string_view{"0123456789abcdef"};
+				auto result = std::string(bytes.size() * 2, '0');
+				for (auto i : Range<std::size_t>(bytes.size())) {
+					result[i * 2] = character[bytes[i] >> 4];
+					result[i * 2 + 1] = character[bytes[i] & 0x0F];
+				}
+				return result;
+			}
+
 	};
 
 	struct OptimizeString {
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+
+namespace Sen::Kernel::Definition
+{
+    /**
+     * Interning table, every distinct string receive the next index in insertion order
+     * The slots are a flat open addressing array holding the full hash and the index,
+     * so a probe only compare characters when the hashes are equal
+     * Keys are copied into fixed size blocks that never move, clear keep every block
+     * so a table reused across documents stop allocating once it has grown
+     */
+
+    class StringTable
+    {
+    public:
+        using Index = std::uint32_t;
+
+    protected:
+        struct Slot
+        {
+            std::uint64_t hash;
+
+            Index index;
+        };
+
+        inline static constexpr auto k_empty = std::numeric_limits<Index>::max();
+
+        inline static constexpr auto k_minimum_slot_count = 64_size;
+
+        inline static constexpr auto k_block_size = 0x10000_size;
+
+        std::vector<Slot> slot_list{};
+
+        std::vector<std::string_view> key_list{};
+
+        std::vector<std::vector<char>> block_list{};
+
+        std::size_t block_index{};
+
+        inline static auto hash(
+            std::string_view value) -> std::uint64_t
+        {
+            return static_cast<std::uint64_t>(std::hash<std::string_view>{}(value));
+        }
+
+        // the block capacity is reserved once, appending inside it never reallocate so views stay valid
+
+        inline auto store(
+            std::string_view value) -> std::string_view
+        {
+            while (thiz.block_index < thiz.block_list.size())
+            {
+                auto &block = thiz.block_list[thiz.block_index];
+                if (block.capacity() - block.size() >= value.size())
+                {
+                    auto offset = block.size();
+                    block.insert(block.end(), value.begin(), value.end());
+                    return std::string_view{block.data() + offset, value.size()};
+                }
+                ++thiz.block_index;
+            }
+            auto &block = thiz.block_list.emplace_back();
+            block.reserve(std::max(k_block_size, value.size()));
+            block.insert(block.end(), value.begin(), value.end());
+            return std::string_view{block.data(), value.size()};
+        }
+
+        inline auto rehash(
+            std::size_t slot_count) -> void
+        {
+            auto slot_list = std::vector<Slot>(slot_count, Slot{.hash = 0, .index = k_empty});
+            auto mask = slot_count - 1_size;
+            for (auto &slot : thiz.slot_list)
+            {
+                if (slot.index == k_empty)
+                {
+                    continue;
+                }
+                auto position = static_cast<std::size_t>(slot.hash) & mask;
+                while (slot_list[position].index != k_empty)
+                {
+                    position = (position + 1_size) & mask;
+                }
+                slot_list[position] = slot;
+            }
+            thiz.slot_list = std::move(slot_list);
+            return;
+        }
+
+    public:
+        /**
+         * value: string to intern
+         * return: the index of the string, and true if it was not in the table before
+         */
+
+        inline auto insert(
+            std::string_view value) -> std::pair<Index, bool>
+        {
+            if ((thiz.key_list.size() + 1_size) * 2_size > thiz.slot_list.size())
+            {
+                thiz.rehash(std::max(k_minimum_slot_count, thiz.slot_list.size() * 2_size));
+            }
+            auto value_hash = hash(value);
+            auto mask = thiz.slot_list.size() - 1_size;
+            auto position = static_cast<std::size_t>(value_hash) & mask;
+            while (thiz.slot_list[position].index != k_empty)
+            {
+                auto &slot = thiz.slot_list[position];
+                if (slot.hash == value_hash && thiz.key_list[slot.index] == value)
+                {
+                    return std::make_pair(slot.index, false);
+                }
+                position = (position + 1_size) & mask;
+            }
+            auto index = static_cast<Index>(thiz.key_list.size());
+            thiz.slot_list[position] = Slot{.hash = value_hash, .index = index};
+            thiz.key_list.emplace_back(thiz.store(value));
+            return std::make_pair(index, true);
+        }
+
+        inline auto size(
+
+        ) const -> std::size_t
+        {
+            return thiz.key_list.size();
+        }
+
+        inline auto operator[](
+            Index index) const -> std::string_view
+        {
+            return thiz.key_list[index];
+        }
+
+        // forget every string, the slots and the blocks are kept
+
+        inline auto clear(
+
+        ) -> void
+        {
+            std::fill(thiz.slot_list.begin(), thiz.slot_list.end(), Slot{.hash = 0, .index = k_empty});
+            thiz.key_list.clear();
+            for (auto &block : thiz.block_list)
+            {
+                block.clear();
+            }
+            thiz.block_index = 0_size;
+            return;
+        }
+    };
+
+}
@@ -2,6 +2,18 @@
 
 #include "kernel/definition/macro.hpp"
 #include "kernel/definition/library.hpp"
+#include "kernel/definition/basic/string.hpp"
+#include "kernel/definition/basic/thread.hpp"
+
+#if !WINDOWS
+#include <spawn.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+extern char **environ;
+#endif
 
 namespace Sen::Kernel {
 
@@ -18,6 +30,21 @@ namespace Sen::Kernel {
 		ARM64,
 	};
 
+	/**
+	 * Result of a child process
+	 * exit_code: -1 when the process was killed by a signal
+	*/
+
+	struct ProcessResult {
+
+		int exit_code;
+
+		std::string output;
+
+		std::string error;
+
+	};
+
 	/**
 	 * Process call
 	*/
@@ -91,5 +118,233 @@ namespace Sen::Kernel {
 				return result;
 			#endif
 		}
+
+		#if WINDOWS
+
+		// quote an argument the way CommandLineToArgvW split it back
+
+		inline static auto quote_argument(
+			std::string_view argument
+		) -> std::string
+		{
+			if (!argument.empty() && argument.find_first_of(" \t\n\v\"") == std::string_view::npos) {
+				return std::string{argument};
+			}
+			auto result = std::string{"\""};
+			auto backslash = 0_size;
+			for (auto c : argument) {
+				if (c == '\\') {
+					++backslash;
+					continue;
+				}
+				result.append(c == '"' ? backslash * 2_size + 1_size : backslash, '\\');
+				backslash = 0_size;
+				result.push_back(c);
+			}
+			result.append(backslash * 2_size, '\\');
+			result.push_back('"');
+			return result;
+		}
+
+		#endif
+
+		/**
+		 * Spawn a program directly without a shell and wait for it
+		 * argument: program followed by its arguments, the program is searched in PATH
+		 * return: exit code, stdout and stderr of the child
+		*/
+
+		inline static auto spawn(
+			const std::vector<std::string> & argument
+		) -> ProcessResult
+		{
+			assert_conditional(!argument.empty(), fmt::format("{}", Language::get("process.empty_command")), "spawn");
+			auto result = ProcessResult{};
+			#if WINDOWS
+				auto security = SECURITY_ATTRIBUTES{sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE};
+				auto output_read = HANDLE{nullptr};
+				auto output_write = HANDLE{nullptr};
+				auto error_read = HANDLE{nullptr};
+				auto error_write = HANDLE{nullptr};
+				if (CreatePipe(&output_read, &output_write, &security, 0) == 0 || CreatePipe(&error_read, &error_write, &security, 0) == 0) {
+					for (auto handle : {output_read, output_write, error_read, error_write}) {
+						if (handle != nullptr) {
+							CloseHandle(handle);
+						}
+					}
+					throw Exception(fmt::format("{}: {}", Language::get("process.spawn_failed"), argument.front()), std::source_location::current(), "spawn");
+				}
+				SetHandleInformation(output_read, HANDLE_FLAG_INHERIT, 0);
+				SetHandleInformation(error_read, HANDLE_FLAG_INHERIT, 0);
+				// the child only inherit its own stdio, not the pipes of jobs spawned at the same time
+				auto input = HANDLE{nullptr};
+				auto standard_input = GetStdHandle(STD_INPUT_HANDLE);
+				if (standard_input != nullptr && standard_input != INVALID_HANDLE_VALUE) {
+					if (DuplicateHandle(GetCurrentProcess(), standard_input, GetCurrentProcess(), &input, 0, TRUE, DUPLICATE_SAME_ACCESS) == 0) {
+						input = nullptr;
+					}
+				}
+				auto inherit_list = std::vector<HANDLE>{output_write, error_write};
+				if (input != nullptr) {
+					inherit_list.emplace_back(input);
+				}
+				auto attribute_size = SIZE_T{};
+				InitializeProcThreadAttributeList(nullptr, 1, 0, &attribute_size);
+				auto attribute_buffer = std::vector<std::uint8_t>(attribute_size);
+				auto attribute = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(attribute_buffer.data());
+				auto is_attribute_ready = InitializeProcThreadAttributeList(attribute, 1, 0, &attribute_size) != 0;
+				auto is_created = BOOL{FALSE};
+				auto information = PROCESS_INFORMATION{};
+				if (is_attribute_ready) {
+					if (UpdateProcThreadAttribute(attribute, 0, PROC_THREAD_ATTRIBUTE_HANDLE_LIST, inherit_list.data(), inherit_list.size() * sizeof(HANDLE), nullptr, nullptr) != 0) {
+						auto startup = STARTUPINFOEXW{};
+						startup.StartupInfo.cb = sizeof(STARTUPINFOEXW);
+						startup.StartupInfo.dwFlags = STARTF_USESTDHANDLES;
+						startup.StartupInfo.hStdInput = input;
+						startup.StartupInfo.hStdOutput = output_write;
+						startup.StartupInfo.hStdError = error_write;
+						startup.lpAttributeList = attribute;
+						auto command = std::string{};
+						for (auto & element : argument) {
+							if (!command.empty()) {
+								command.push_back(' ');
+							}
+							command += quote_argument(element);
+						}
+						auto command_line = String::utf8_to_utf16(command);
+						is_created = CreateProcessW(nullptr, command_line.data(), nullptr, nullptr, TRUE, CREATE_NO_WINDOW | EXTENDED_STARTUPINFO_PRESENT, nullptr, nullptr, &startup.StartupInfo, &information);
+					}
+					DeleteProcThreadAttributeList(attribute);
+				}
+				if (input != nullptr) {
+					CloseHandle(input);
+				}
+				CloseHandle(output_write);
+				CloseHandle(error_write);
+				if (is_created == 0) {
+					CloseHandle(output_read);
+					CloseHandle(error_read);
+					throw Exception(fmt::format("{}: {}", Language::get("process.spawn_failed"), argument.front()), std::source_location::current(), "spawn");
+				}
+				auto read_pipe = [](HANDLE pipe, std::string & destination) {
+					auto buffer = std::array<char, 4096>{};
+					auto size = DWORD{};
+					while (ReadFile(pipe, buffer.data(), static_cast<DWORD>(buffer.size()), &size, nullptr) != 0 && size != 0) {
+						destination.append(buffer.data(), size);
+					}
+					CloseHandle(pipe);
+				};
+				// stderr is drained on its own thread so a full pipe never block the child
+				auto error_thread = std::thread(read_pipe, error_read, std::ref(result.error));
+				read_pipe(output_read, result.output);
+				error_thread.join();
+				WaitForSingleObject(information.hProcess, INFINITE);
+				auto exit_code = DWORD{};
+				GetExitCodeProcess(information.hProcess, &exit_code);
+				result.exit_code = static_cast<int>(exit_code);
+				CloseHandle(information.hThread);
+				CloseHandle(information.hProcess);
+			#else
+				auto output_pipe = std::array<int, 2>{-1, -1};
+				auto error_pipe = std::array<int, 2>{-1, -1};
+				// the pipes are close-on-exec, so children spawned at the same time never inherit each other's pipes
+				// dup2 clear the flag on the child's stdio
+				#if APPLE
+				auto is_pipe_created = pipe(output_pipe.data()) == 0 && pipe(error_pipe.data()) == 0;
+				#else
+				auto is_pipe_created = pipe2(output_pipe.data(), O_CLOEXEC) == 0 && pipe2(error_pipe.data(), O_CLOEXEC) == 0;
+				#endif
+				if (!is_pipe_created) {
+					for (auto descriptor : {output_pipe[0], output_pipe[1], error_pipe[0], error_pipe[1]}) {
+						if (descriptor >= 0) {
+							close(descriptor);
+						}
+					}
+					throw Exception(fmt::format("{}: {}", Language::get("process.spawn_failed"), argument.front()), std::source_location::current(), "spawn");
+				}
+				auto action = posix_spawn_file_actions_t{};
+				posix_spawn_file_actions_init(&action);
+				posix_spawn_file_actions_adddup2(&action, output_pipe[1], STDOUT_FILENO);
+				posix_spawn_file_actions_adddup2(&action, error_pipe[1], STDERR_FILENO);
+				auto spawn_attribute = posix_spawnattr_t{};
+				posix_spawnattr_init(&spawn_attribute);
+				#if APPLE
+				// no pipe2 here, every descriptor but the child's stdio is closed on spawn instead
+				posix_spawn_file_actions_addinherit_np(&action, STDIN_FILENO);
+				posix_spawnattr_setflags(&spawn_attribute, POSIX_SPAWN_CLOEXEC_DEFAULT);
+				#endif
+				auto argument_list = std::vector<char *>{};
+				for (auto & element : argument) {
+					argument_list.emplace_back(const_cast<char *>(element.data()));
+				}
+				argument_list.emplace_back(nullptr);
+				auto pid = pid_t{};
+				auto state = posix_spawnp(&pid, argument.front().data(), &action, &spawn_attribute, argument_list.data(), environ);
+				posix_spawnattr_destroy(&spawn_attribute);
+				posix_spawn_file_actions_destroy(&action);
+				close(output_pipe[1]);
+				close(error_pipe[1]);
+				if (state != 0) {
+					close(output_pipe[0]);
+					close(error_pipe[0]);
+					throw Exception(fmt::format("{}: {}", Language::get("process.spawn_failed"), argument.front()), std::source_location::current(), "spawn");
+				}
+				// both pipes are polled together so a full pipe never block the child
+				auto poll_list = std::array<pollfd, 2>{pollfd{output_pipe[0], POLLIN, 0}, pollfd{error_pipe[0], POLLIN, 0}};
+				auto destination = std::array<std::string *, 2>{&result.output, &result.error};
+				auto buffer = std::array<char, 4096>{};
+				for (auto opened = 2_size; opened != 0_size;) {
+					if (poll(poll_list.data(), static_cast<nfds_t>(poll_list.size()), -1) < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						break;
+					}
+					for (auto i : Range<std::size_t>(poll_list.size())) {
+						if (poll_list[i].fd < 0 || poll_list[i].revents == 0) {
+							continue;
+						}
+						auto size = read(poll_list[i].fd, buffer.data(), buffer.size());
+						if (size > 0) {
+							destination[i]->append(buffer.data(), static_cast<std::size_t>(size));
+						}
+						else if (size == 0 || errno != EINTR) {
+							close(poll_list[i].fd);
+							poll_list[i].fd = -1;
+							--opened;
+						}
+					}
+				}
+				for (auto & element : poll_list) {
+					if (element.fd >= 0) {
+						close(element.fd);
+					}
+				}
+				auto status = 0;
+				while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+				}
+				result.exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+			#endif
+			return result;
+		}
+
+		/**
+		 * Spawn every command, at most limit at the same time
+		 * command_list: every command as program followed by its arguments
+		 * limit: concurrent process count, hardware concurrency by default
+		 * return: result of each command, in the same order
+		*/
+
+		inline static auto spawn_all(
+			const std::vector<std::vector<std::string>> & command_list,
+			std::size_t limit = ThreadPool::hardware_concurrency()
+		) -> std::vector<ProcessResult>
+		{
+			auto result = std::vector<ProcessResult>(command_list.size());
+			parallel_for(command_list.size(), [&](std::size_t index) {
+				result[index] = spawn(command_list[index]);
+			}, limit);
+			return result;
+		}
 	};
 }
@@ -173,4 +173,179 @@ concept IsValidArguments = true;
 				return;
 			}
 	};
+
+	/**
+	 * Bounded worker pool
+	 * Tasks are queued and executed by a fixed number of workers
+	 * The first exception thrown by a task is rethrown on wait
+	*/
+
+	class ThreadPool {
+		public:
+			using ThreadCount = std::size_t;
+			using Task = std::function<void()>;
+		protected:
+			std::vector<std::thread> workers{};
+			std::queue<Task> tasks{};
+			std::mutex g_mutex{};
+			std::condition_variable task_available{};
+			std::condition_variable task_finished{};
+			std::size_t pending{};
+			bool stopped{};
+			std::exception_ptr exception{};
+
+			auto work (
+			) -> void
+			{
+				while (true) {
+					auto task = Task{};
+					{
+						auto lock = std::unique_lock<std::mutex>(thiz.g_mutex);
+						thiz.task_available.wait(lock, [&]() { return thiz.stopped || !thiz.tasks.empty(); });
+						if (thiz.tasks.empty()) {
+							return;
+						}
+						task = std::move(thiz.tasks.front());
+						thiz.tasks.pop();
+					}
+					try {
+						task();
+					}
+					catch (...) {
+						auto lock = std::lock_guard<std::mutex>(thiz.g_mutex);
+						if (thiz.exception == nullptr) {
+							thiz.exception = std::current_exception();
+						}
+					}
+					{
+						auto lock = std::lock_guard<std::mutex>(thiz.g_mutex);
+						--thiz.pending;
+					}
+					thiz.task_finished.notify_all();
+				}
+			}
+
+		public:
+
+			inline static auto hardware_concurrency (
+			) -> ThreadCount
+			{
+				return std::max<ThreadCount>(std::thread::hardware_concurrency(), 1_size);
+			}
+
+			explicit ThreadPool(
+				ThreadCount count = ThreadPool::hardware_concurrency()
+			)
+			{
+				count = std::max<ThreadCount>(count, 1_size);
+				thiz.workers.reserve(count);
+				for (auto i : Range<ThreadCount>(count)) {
+					thiz.workers.emplace_back([this]() { thiz.work(); });
+				}
+			}
+
+			~ThreadPool(
+			)
+			{
+				{
+					auto lock = std::lock_guard<std::mutex>(thiz.g_mutex);
+					thiz.stopped = true;
+				}
+				thiz.task_available.notify_all();
+				for (auto& worker : thiz.workers) {
+					if (worker.joinable()) {
+						worker.join();
+					}
+				}
+			}
+
+			ThreadPool(
+				ThreadPool&& that
+			) = delete;
+
+			auto operator =(
+				ThreadPool&& that
+			)->ThreadPool & = delete;
+
+			auto enqueue (
+				Task task
+			) -> void
+			{
+				{
+					auto lock = std::lock_guard<std::mutex>(thiz.g_mutex);
+					thiz.tasks.emplace(std::move(task));
+					++thiz.pending;
+				}
+				thiz.task_available.notify_one();
+				return;
+			}
+
+			auto size (
+			) -> ThreadCount
+			{
+				return thiz.workers.size();
+			}
+
+			auto wait (
+			) -> void
+			{
+				auto lock = std::unique_lock<std::mutex>(thiz.g_mutex);
+				thiz.task_finished.wait(lock, [&]() { return thiz.pending == 0; });
+				if (thiz.exception != nullptr) {
+					auto exception = thiz.exception;
+					thiz.exception = nullptr;
+					std::rethrow_exception(exception);
+				}
+				return;
+			}
+	};
+
+	/**
+	 * Run callback(index) for every index in [0, count) on at most limit threads
+	 * The first exception thrown is rethrown after every thread has joined
+	*/
+
+	template <typename Callback>
+	inline static auto parallel_for (
+		std::size_t count,
+		const Callback & callback,
+		std::size_t limit = ThreadPool::hardware_concurrency()
+	) -> void
+	{
+		auto thread_count = std::min<std::size_t>(std::max<std::size_t>(limit, 1_size), count);
+		if (thread_count <= 1_size) {
+			for (auto index : Range<std::size_t>(count)) {
+				callback(index);
+			}
+			return;
+		}
+		auto next = std::atomic<std::size_t>{0_size};
+		auto exception = std::exception_ptr{};
+		auto exception_mutex = std::mutex{};
+		auto threads = std::vector<std::thread>{};
+		threads.reserve(thread_count);
+		for (auto i : Range<std::size_t>(thread_count)) {
+			threads.emplace_back([&]() {
+				for (auto index = next.fetch_add(1_size); index < count; index = next.fetch_add(1_size)) {
+					try {
+						callback(index);
+					}
+					catch (...) {
+						auto lock = std::lock_guard<std::mutex>(exception_mutex);
+						if (exception == nullptr) {
+							exception = std::current_exception();
+						}
+						next.store(count);
+					}
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		if (exception != nullptr) {
+			std::rethrow_exception(exception);
+		}
+		return;
+	}
 }
\ No newline at end of file
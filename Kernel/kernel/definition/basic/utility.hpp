@@ -41,8 +41,10 @@ namespace Sen::Kernel::Definition
             std::string_view value) -> size_t
         {
             auto string_length = size_t{0};
-            for (auto &c : value)
+            for (auto &element : value)
             {
+                // char is signed on most desktop targets, lead bytes must be compared unsigned
+                auto c = static_cast<unsigned char>(element);
                 if (c <= 0b01111111)
                 {
                     ++string_length;
@@ -51,7 +53,7 @@ namespace Sen::Kernel::Definition
                 {
                     ++string_length;
                 }
-                else if (c >= 0b11100001 && c <= 0b11101111)
+                else if (c >= 0b11100000 && c <= 0b11101111)
                 {
                     ++string_length;
                 }
@@ -4,6 +4,16 @@
 #include "kernel/definition/assert.hpp"
 #include "kernel/definition/macro.hpp"
 
+#if (defined __SSE4_2__ || defined __AVX__) && (defined __x86_64__ || defined _M_X64)
+#include <nmmintrin.h>
+#define M_CRC32C_INSTRUCTION 1
+#endif
+
+#if defined __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+#define M_CRC32_ARM_INSTRUCTION 1
+#endif
+
 namespace Sen::Kernel::Definition::Encryption {
 
 	template <typename Polinomial> requires std::is_integral<Polinomial>::value
@@ -14,11 +24,14 @@ namespace Sen::Kernel::Definition::Encryption {
 			using Type = Polinomial;
 
 		private:
-			using Buffer = std::vector<uint8_t>;
+			using Buffer = std::span<const std::uint8_t>;
 
 			template <typename T, auto size>
 			using ByteArray = std::array<T, size>;
 
+			template <typename T, auto size>
+			using SliceTable = std::array<ByteArray<T, size>, 8>;
+
 		protected:
 
 			inline static constexpr auto polynomial = static_cast<Polinomial>(0xEDB88320);
@@ -55,6 +68,29 @@ namespace Sen::Kernel::Definition::Encryption {
 				return;
 			}
 
+			/**
+			 * Derive the eight slicing tables from a byte table
+			 * slice[k][i] is the crc of byte i followed by k zero bytes
+			*/
+
+			template <typename T, auto size>
+			static auto constexpr generate_slice_table(
+				const ByteArray<T, size> & table
+			) -> SliceTable<T, size>
+			{
+				auto slice = SliceTable<T, size>{};
+				slice[0] = table;
+				for (auto k = 1; k < 8; ++k) {
+					for (auto i = 0; i < size; ++i) {
+						slice[k][i] = (slice[k - 1][i] >> 8) ^ table[slice[k - 1][i] & 0xFF];
+					}
+				}
+				return slice;
+			}
+
+			template <const auto & table>
+			inline static constexpr auto slice_table = generate_slice_table<typename std::remove_cvref_t<decltype(table)>::value_type, std::tuple_size_v<std::remove_cvref_t<decltype(table)>>>(table);
+
 			template <typename T, auto size>
 			constexpr auto update (
 				const ByteArray<T, size> & table,
@@ -79,6 +115,37 @@ namespace Sen::Kernel::Definition::Encryption {
 				auto crc = CRC<P>{};
 				return crc.template update<T, size>(table, initial, buffer);
 			}
+
+			/**
+			 * Slicing-by-8: consume eight bytes per step through eight lookup tables
+			 * Produce the same result as update with the byte table
+			*/
+
+			template <const auto & table>
+			static auto constexpr compute_slice (
+				std::uint32_t initial,
+				const Buffer & buffer
+			) -> std::uint32_t
+			{
+				const auto & slice = slice_table<table>;
+				auto c = initial ^ 0xFFFFFFFF;
+				auto data = buffer.data();
+				auto size = buffer.size();
+				while (size >= 8) {
+					auto one = c ^ (static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) | 
+						(static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24));
+					auto two = static_cast<std::uint32_t>(data[4]) | (static_cast<std::uint32_t>(data[5]) << 8) | 
+						(static_cast<std::uint32_t>(data[6]) << 16) | (static_cast<std::uint32_t>(data[7]) << 24);
+					c = slice[7][one & 0xFF] ^ slice[6][(one >> 8) & 0xFF] ^ slice[5][(one >> 16) & 0xFF] ^ slice[4][one >> 24] ^
+						slice[3][two & 0xFF] ^ slice[2][(two >> 8) & 0xFF] ^ slice[1][(two >> 16) & 0xFF] ^ slice[0][two >> 24];
+					data += 8;
+					size -= 8;
+				}
+				while (size-- != 0) {
+					c = slice[0][(c ^ *data++) & 0xFF] ^ (c >> 8);
+				}
+				return c ^ 0xFFFFFFFF;
+			}
 	};
 
 	namespace CRC32 {
@@ -96,10 +163,26 @@ namespace Sen::Kernel::Definition::Encryption {
 
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					#if defined M_CRC32_ARM_INSTRUCTION
+					if (!std::is_constant_evaluated()) {
+						auto c = initial ^ 0xFFFFFFFF;
+						auto data = buffer.data();
+						auto size = buffer.size();
+						for (; size >= 8; data += 8, size -= 8) {
+							auto value = std::uint64_t{};
+							std::memcpy(&value, data, sizeof(value));
+							c = __crc32d(c, value);
+						}
+						for (; size != 0; ++data, --size) {
+							c = __crc32b(c, *data);
+						}
+						return c ^ 0xFFFFFFFF;
+					}
+					#endif
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 			
@@ -116,10 +199,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -135,10 +218,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -154,10 +237,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -173,10 +256,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -192,10 +275,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -211,10 +294,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -230,10 +313,34 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					#if defined M_CRC32C_INSTRUCTION || defined M_CRC32_ARM_INSTRUCTION
+					if (!std::is_constant_evaluated()) {
+						auto c = initial ^ 0xFFFFFFFF;
+						auto data = buffer.data();
+						auto size = buffer.size();
+						for (; size >= 8; data += 8, size -= 8) {
+							auto value = std::uint64_t{};
+							std::memcpy(&value, data, sizeof(value));
+							#if defined M_CRC32C_INSTRUCTION
+							c = static_cast<std::uint32_t>(_mm_crc32_u64(c, value));
+							#else
+							c = __crc32cd(c, value);
+							#endif
+						}
+						for (; size != 0; ++data, --size) {
+							#if defined M_CRC32C_INSTRUCTION
+							c = _mm_crc32_u8(c, *data);
+							#else
+							c = __crc32cb(c, *data);
+							#endif
+						}
+						return c ^ 0xFFFFFFFF;
+					}
+					#endif
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -249,10 +356,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -268,10 +375,10 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint32_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint32_t
 				{
-					return CRC32::compute<CRC32::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
+					return CRC32::compute_slice<TABLE>(initial, buffer);
 				}
 
 		};
@@ -291,7 +398,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -308,7 +415,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -325,7 +432,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -342,7 +449,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -359,7 +466,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -376,7 +483,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -393,7 +500,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -410,7 +517,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -427,7 +534,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -444,7 +551,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint8_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint8_t
 				{
 					return CRC8::compute<CRC8::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -466,7 +573,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -484,7 +591,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -502,7 +609,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -520,7 +627,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -538,7 +645,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -556,7 +663,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -574,7 +681,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -592,7 +699,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -610,7 +717,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -628,7 +735,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -646,7 +753,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -664,7 +771,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -682,7 +789,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -700,7 +807,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -718,7 +825,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -736,7 +843,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -754,7 +861,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -772,7 +879,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -790,7 +897,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -808,7 +915,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -826,7 +933,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -844,7 +951,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
@@ -862,7 +969,7 @@ namespace Sen::Kernel::Definition::Encryption {
 			
 				constexpr static auto compute(
 					std::uint16_t initial, 
-					const std::vector<uint8_t> & buffer
+					std::span<const std::uint8_t> buffer
 				) -> std::uint16_t
 				{
 					return CRC16::compute<CRC16::Type, typename decltype(TABLE)::value_type, TABLE.size()>(TABLE, initial, buffer);
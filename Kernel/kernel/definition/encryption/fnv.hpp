@@ -36,6 +36,8 @@ namespace Sen::Kernel::Definition::Encryption::FNV {
 
 			using Size = std::uint64_t;
 
+			inline static constexpr auto chunk_size = static_cast<std::size_t>(0x100000);
+
 		protected:
 
 			auto constexpr hash (
@@ -70,8 +72,20 @@ namespace Sen::Kernel::Definition::Encryption::FNV {
 			) noexcept -> Hash::Type
 			{
 				auto value = Common::offset;
-				while (str != nullptr) {
-					value ^= *str++;
+				while (*str != '\0') {
+					value ^= static_cast<unsigned char>(*str++);
+					value *= Common::prime;
+				}
+				return value;
+			}
+
+			auto constexpr update (
+				std::span<const std::uint8_t> data,
+				Hash::Type value = Common::offset
+			) noexcept -> Hash::Type
+			{
+				for (auto & e : data) {
+					value ^= e;
 					value *= Common::prime;
 				}
 				return value;
@@ -82,7 +96,10 @@ namespace Sen::Kernel::Definition::Encryption::FNV {
 			) -> Hash::Type
 			{
 				auto hash = Hash<T>{};
-				auto destination = hash.make_hash(FileSystem::read_file(source).data());
+				auto destination = Common::offset;
+				FileSystem::read_chunk(source, chunk_size, [&](std::span<const std::uint8_t> data) {
+					destination = hash.update(data, destination);
+				});
 				return destination;
 			}
 	};
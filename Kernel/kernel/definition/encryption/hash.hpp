@@ -0,0 +1,26 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/macro.hpp"
+
+namespace Sen::Kernel::Definition::Encryption {
+
+	/**
+	 * t_hash_fs: hash_fs of the algorithm, called on one file
+	 * source: source files
+	 * return: hashed string of every file, in the same order
+	*/
+
+	template <auto t_hash_fs>
+	inline static auto hash_fs_as_multiple_thread(
+		const std::vector<std::string> & source
+	) -> std::vector<std::string>
+	{
+		auto result = std::vector<std::string>(source.size());
+		parallel_for(source.size(), [&](std::size_t index) {
+			result[index] = t_hash_fs(source[index]);
+		});
+		return result;
+	}
+
+}
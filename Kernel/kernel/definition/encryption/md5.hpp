@@ -1,27 +1,176 @@
-#pragma once 
+#pragma once
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/assert.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/encryption/hash.hpp"
 
-namespace Sen::Kernel::Definition::Encryption::MD5 
+namespace Sen::Kernel::Definition::Encryption::MD5
 {
 
 	// Byte definition
 
 	typedef unsigned char byte;
 
+	// Digest definition
+
+	using Digest = std::array<std::uint8_t, 16>;
+
+	// Chunk size used when a file is hashed
+
+	inline static constexpr auto chunk_size = static_cast<std::size_t>(0x100000);
+
+	/**
+	 * Incremental MD5
+	 * update may be called any number of times before finalize
+	*/
+
+	class Context {
+
+		protected:
+
+			inline static constexpr auto shift = std::array<std::uint32_t, 64>{
+				7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+				5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+				4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+				6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+			};
+
+			inline static constexpr auto constant = std::array<std::uint32_t, 64>{
+				0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+				0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+				0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+				0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+				0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+				0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+				0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+				0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+			};
+
+			std::array<std::uint32_t, 4> state{ 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+
+			std::array<std::uint8_t, 64> block{};
+
+			std::size_t block_size{};
+
+			std::uint64_t length{};
+
+			auto transform(
+				const std::uint8_t* data
+			) -> void
+			{
+				auto word = std::array<std::uint32_t, 16>{};
+				for (auto i : Range<std::size_t>(16)) {
+					word[i] = static_cast<std::uint32_t>(data[i * 4]) | (static_cast<std::uint32_t>(data[i * 4 + 1]) << 8) |
+						(static_cast<std::uint32_t>(data[i * 4 + 2]) << 16) | (static_cast<std::uint32_t>(data[i * 4 + 3]) << 24);
+				}
+				auto a = thiz.state[0];
+				auto b = thiz.state[1];
+				auto c = thiz.state[2];
+				auto d = thiz.state[3];
+				for (auto i : Range<std::uint32_t>(64)) {
+					auto f = std::uint32_t{};
+					auto g = std::uint32_t{};
+					if (i < 16) {
+						f = (b & c) | (~b & d);
+						g = i;
+					}
+					else if (i < 32) {
+						f = (d & b) | (~d & c);
+						g = (5 * i + 1) % 16;
+					}
+					else if (i < 48) {
+						f = b ^ c ^ d;
+						g = (3 * i + 5) % 16;
+					}
+					else {
+						f = c ^ (b | ~d);
+						g = (7 * i) % 16;
+					}
+					f += a + constant[i] + word[g];
+					a = d;
+					d = c;
+					c = b;
+					b += std::rotl(f, static_cast<int>(shift[i]));
+				}
+				thiz.state[0] += a;
+				thiz.state[1] += b;
+				thiz.state[2] += c;
+				thiz.state[3] += d;
+				return;
+			}
+
+		public:
+
+			Context(
+			) = default;
+
+			~Context(
+			) = default;
+
+			auto update(
+				std::span<const std::uint8_t> data
+			) -> void
+			{
+				thiz.length += data.size();
+				auto position = 0_size;
+				if (thiz.block_size != 0) {
+					auto size = std::min(data.size(), 64_size - thiz.block_size);
+					std::memcpy(thiz.block.data() + thiz.block_size, data.data(), size);
+					thiz.block_size += size;
+					position += size;
+					if (thiz.block_size != 64) {
+						return;
+					}
+					thiz.transform(thiz.block.data());
+					thiz.block_size = 0;
+				}
+				for (; position + 64 <= data.size(); position += 64) {
+					thiz.transform(data.data() + position);
+				}
+				thiz.block_size = data.size() - position;
+				std::memcpy(thiz.block.data(), data.data() + position, thiz.block_size);
+				return;
+			}
+
+			auto finalize(
+			) -> Digest
+			{
+				auto bit_length = thiz.length * 8;
+				auto padding = std::array<std::uint8_t, 72>{0x80};
+				auto padding_size = (thiz.block_size < 56 ? 56 : 120) - thiz.block_size;
+				for (auto i : Range<std::size_t>(8)) {
+					padding[padding_size + i] = static_cast<std::uint8_t>(bit_length >> (i * 8));
+				}
+				thiz.update(std::span<const std::uint8_t>{padding.data(), padding_size + 8});
+				auto digest = Digest{};
+				for (auto i : Range<std::size_t>(16)) {
+					digest[i] = static_cast<std::uint8_t>(thiz.state[i / 4] >> ((i % 4) * 8));
+				}
+				return digest;
+			}
+	};
+
+	// provide digest to stringify
+	// return: lowercase hexadecimal string
+
+	inline static auto to_string(
+		const Digest & digest
+	) -> std::string
+	{
+		return String::to_hexadecimal(digest);
+	}
 
 	// provide message to hash
 	// return: the hashed message
-	
+
 	inline static auto hash(
 		const std::span<const byte> &message
 	) -> std::string
 	{
-		auto md5 = std::make_unique<Dependencies::md5::MD5>(message);
-		auto result = md5->toStr();
-		return result;
+		auto context = Context{};
+		context.update(message);
+		return to_string(context.finalize());
 	}
 
 	/**
@@ -33,9 +182,23 @@ namespace Sen::Kernel::Definition::Encryption::MD5
 		std::string_view source
 	) -> std::string
 	{
-		auto str = FileSystem::read_binary<unsigned char>(source);
-		auto result = Kernel::Definition::Encryption::MD5::hash(str);
-		return result;
+		auto context = Context{};
+		FileSystem::read_chunk(source, chunk_size, [&](std::span<const std::uint8_t> data) {
+			context.update(data);
+		});
+		return to_string(context.finalize());
+	}
+
+	/**
+	 * @param source: source files
+	 * @returns: hashed string of every file, in the same order
+	*/
+
+	inline static auto hash_fs_as_multiple_thread(
+		const std::vector<std::string> & source
+	) -> std::vector<std::string>
+	{
+		return Encryption::hash_fs_as_multiple_thread<hash_fs>(source);
 	}
 
-}
\ No newline at end of file
+}
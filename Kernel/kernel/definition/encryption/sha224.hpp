@@ -2,8 +2,20 @@
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/encryption/hash.hpp"
+#include "kernel/definition/encryption/sha256.hpp"
 
 namespace Sen::Kernel::Definition::Encryption::Sha224 {
+
+	// SHA-224 initial hash value, the compressor is shared with SHA-256
+
+	inline static constexpr auto initial_state = SHA256::State{
+		0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939, 0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+	};
+
+	// SHA-224 keep the first 28 bytes of the digest
+
+	inline static constexpr auto digest_size = 28_size;
 	
 	/**
 	 * message: the message need to hash
@@ -14,9 +26,10 @@ namespace Sen::Kernel::Definition::Encryption::Sha224 {
 		const std::string & message
 	) -> std::string
 	{
-		auto sha224 = std::make_shared<Dependencies::SHA224CryptoServiceProvider::sha224>();
-		auto result = sha224->Hashing(message);
-		return result;
+		auto context = SHA256::Context{initial_state};
+		context.update(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(message.data()), message.size()});
+		auto digest = context.finalize();
+		return String::to_hexadecimal(std::span<const std::uint8_t>{digest.data(), digest_size});
 	}
 
 	/**
@@ -28,8 +41,24 @@ namespace Sen::Kernel::Definition::Encryption::Sha224 {
 		const std::string & source
 	) -> std::string
 	{
-		return Sen::Kernel::Definition::Encryption::Sha224::hash(FileSystem::read_file(source));
+		auto context = SHA256::Context{initial_state};
+		FileSystem::read_chunk(source, SHA256::chunk_size, [&](std::span<const std::uint8_t> data) {
+			context.update(data);
+		});
+		auto digest = context.finalize();
+		return String::to_hexadecimal(std::span<const std::uint8_t>{digest.data(), digest_size});
 	}
 
+	/**
+	 * source: the source files need to hash
+	 * return: hashed message of every file, in the same order
+	*/
+
+	inline static auto hash_fs_as_multiple_thread(
+		const std::vector<std::string> & source
+	) -> std::vector<std::string>
+	{
+		return Encryption::hash_fs_as_multiple_thread<hash_fs>(source);
+	}
 
-}
\ No newline at end of file
+}
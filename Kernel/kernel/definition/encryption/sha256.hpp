@@ -2,11 +2,217 @@
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/encryption/hash.hpp"
+
+#if defined __SHA__ && defined __SSE4_1__
+#include <immintrin.h>
+#define M_SHA_INSTRUCTION 1
+#endif
 
 namespace Sen::Kernel::Definition::Encryption::SHA256
 {
 
-	// Hash method
+	// Digest definition
+
+	using Digest = std::array<std::uint8_t, 32>;
+
+	// State definition
+
+	using State = std::array<std::uint32_t, 8>;
+
+	// Chunk size used when a file is hashed
+
+	inline static constexpr auto chunk_size = static_cast<std::size_t>(0x100000);
+
+	// SHA-256 initial hash value
+
+	inline static constexpr auto initial_state = State{
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+	};
+
+	/**
+	 * Incremental SHA-256 compressor
+	 * Use the SHA extension when the target has it, the portable rounds otherwise
+	 * SHA-224 share this compressor with another initial state
+	*/
+
+	class Context {
+
+		protected:
+
+			inline static constexpr auto constant = std::array<std::uint32_t, 64>{
+				0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+				0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+				0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+				0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+				0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+				0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+				0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+				0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+			};
+
+			State state{};
+
+			std::array<std::uint8_t, 64> block{};
+
+			std::size_t block_size{};
+
+			std::uint64_t length{};
+
+			inline static auto transform_portable(
+				State & state,
+				const std::uint8_t* data,
+				std::size_t count
+			) -> void
+			{
+				auto word = std::array<std::uint32_t, 64>{};
+				for (; count != 0; --count, data += 64) {
+					for (auto i : Range<std::size_t>(16)) {
+						word[i] = (static_cast<std::uint32_t>(data[i * 4]) << 24) | (static_cast<std::uint32_t>(data[i * 4 + 1]) << 16) |
+							(static_cast<std::uint32_t>(data[i * 4 + 2]) << 8) | static_cast<std::uint32_t>(data[i * 4 + 3]);
+					}
+					for (auto i = 16_size; i < 64; ++i) {
+						auto s0 = std::rotr(word[i - 15], 7) ^ std::rotr(word[i - 15], 18) ^ (word[i - 15] >> 3);
+						auto s1 = std::rotr(word[i - 2], 17) ^ std::rotr(word[i - 2], 19) ^ (word[i - 2] >> 10);
+						word[i] = word[i - 16] + s0 + word[i - 7] + s1;
+					}
+					auto [a, b, c, d, e, f, g, h] = state;
+					for (auto i : Range<std::size_t>(64)) {
+						auto t1 = h + (std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25)) + ((e & f) ^ (~e & g)) + constant[i] + word[i];
+						auto t2 = (std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+						h = g;
+						g = f;
+						f = e;
+						e = d + t1;
+						d = c;
+						c = b;
+						b = a;
+						a = t1 + t2;
+					}
+					state[0] += a;
+					state[1] += b;
+					state[2] += c;
+					state[3] += d;
+					state[4] += e;
+					state[5] += f;
+					state[6] += g;
+					state[7] += h;
+				}
+				return;
+			}
+
+			#if defined M_SHA_INSTRUCTION
+			inline static auto transform_instruction(
+				State & state,
+				const std::uint8_t* data,
+				std::size_t count
+			) -> void
+			{
+				auto const mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+				auto temporary = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+				auto state_1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+				auto state_0 = _mm_alignr_epi8(temporary, state_1, 8);
+				state_1 = _mm_blend_epi16(state_1, temporary, 0xF0);
+				for (; count != 0; --count, data += 64) {
+					auto const abef = state_0;
+					auto const cdgh = state_1;
+					__m128i message[4];
+					for (auto i : Range<std::size_t>(16)) {
+						auto& current = message[i % 4];
+						if (i < 4) {
+							current = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), mask);
+						}
+						auto value = _mm_add_epi32(current, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&constant[i * 4])));
+						state_1 = _mm_sha256rnds2_epu32(state_1, state_0, value);
+						if (i >= 3 && i <= 14) {
+							auto& next = message[(i + 1) % 4];
+							next = _mm_add_epi32(next, _mm_alignr_epi8(current, message[(i + 3) % 4], 4));
+							next = _mm_sha256msg2_epu32(next, current);
+						}
+						state_0 = _mm_sha256rnds2_epu32(state_0, state_1, _mm_shuffle_epi32(value, 0x0E));
+						if (i >= 1 && i <= 12) {
+							message[(i + 3) % 4] = _mm_sha256msg1_epu32(message[(i + 3) % 4], current);
+						}
+					}
+					state_0 = _mm_add_epi32(state_0, abef);
+					state_1 = _mm_add_epi32(state_1, cdgh);
+				}
+				temporary = _mm_shuffle_epi32(state_0, 0x1B);
+				state_1 = _mm_shuffle_epi32(state_1, 0xB1);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(temporary, state_1, 0xF0));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(state_1, temporary, 8));
+				return;
+			}
+			#endif
+
+			inline static auto transform(
+				State & state,
+				const std::uint8_t* data,
+				std::size_t count
+			) -> void
+			{
+				#if defined M_SHA_INSTRUCTION
+				transform_instruction(state, data, count);
+				#else
+				transform_portable(state, data, count);
+				#endif
+				return;
+			}
+
+		public:
+
+			explicit Context(
+				const State & initial = initial_state
+			) : state(initial)
+			{
+
+			}
+
+			~Context(
+			) = default;
+
+			auto update(
+				std::span<const std::uint8_t> data
+			) -> void
+			{
+				thiz.length += data.size();
+				auto position = 0_size;
+				if (thiz.block_size != 0) {
+					auto size = std::min(data.size(), 64_size - thiz.block_size);
+					std::memcpy(thiz.block.data() + thiz.block_size, data.data(), size);
+					thiz.block_size += size;
+					position += size;
+					if (thiz.block_size != 64) {
+						return;
+					}
+					transform(thiz.state, thiz.block.data(), 1);
+					thiz.block_size = 0;
+				}
+				auto count = (data.size() - position) / 64;
+				transform(thiz.state, data.data() + position, count);
+				position += count * 64;
+				thiz.block_size = data.size() - position;
+				std::memcpy(thiz.block.data(), data.data() + position, thiz.block_size);
+				return;
+			}
+
+			auto finalize(
+			) -> Digest
+			{
+				auto bit_length = thiz.length * 8;
+				auto padding = std::array<std::uint8_t, 72>{0x80};
+				auto padding_size = (thiz.block_size < 56 ? 56 : 120) - thiz.block_size;
+				for (auto i : Range<std::size_t>(8)) {
+					padding[padding_size + i] = static_cast<std::uint8_t>(bit_length >> ((7 - i) * 8));
+				}
+				thiz.update(std::span<const std::uint8_t>{padding.data(), padding_size + 8});
+				auto digest = Digest{};
+				for (auto i : Range<std::size_t>(32)) {
+					digest[i] = static_cast<std::uint8_t>(thiz.state[i / 4] >> ((3 - i % 4) * 8));
+				}
+				return digest;
+			}
+	};
 
 	/**
 	 * Pass: the string to hash
@@ -17,11 +223,9 @@ namespace Sen::Kernel::Definition::Encryption::SHA256
 		const std::string & message
 	) -> std::string
 	{
-
-		auto sha = std::make_shared<Sen::Kernel::Dependencies::SHA256::SHA256>();
-		sha->update(message);
-		auto digest = static_cast<std::array<uint8_t, 32>>(sha->digest());
-		return Sen::Kernel::Dependencies::SHA256::SHA256::toString(digest);
+		auto context = Context{};
+		context.update(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(message.data()), message.size()});
+		return String::to_hexadecimal(context.finalize());
 	}
 
 	/**
@@ -33,9 +237,23 @@ namespace Sen::Kernel::Definition::Encryption::SHA256
 		const std::string & source
 	) -> std::string
 	{
-		return SHA256::hash(FileSystem::read_file(source));
+		auto context = Context{};
+		FileSystem::read_chunk(source, chunk_size, [&](std::span<const std::uint8_t> data) {
+			context.update(data);
+		});
+		return String::to_hexadecimal(context.finalize());
 	}
 
+	/**
+	 * @param source: source files
+	 * @returns: hashed string of every file, in the same order
+	*/
 
+	inline static auto hash_fs_as_multiple_thread(
+		const std::vector<std::string> & source
+	) -> std::vector<std::string>
+	{
+		return Encryption::hash_fs_as_multiple_thread<hash_fs>(source);
+	}
 
-}
\ No newline at end of file
+}
@@ -2,6 +2,8 @@
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/encryption/hash.hpp"
+#include "kernel/definition/encryption/sha512.hpp"
 
 namespace Sen::Kernel::Definition::Encryption {
 
@@ -9,6 +11,17 @@ namespace Sen::Kernel::Definition::Encryption {
 
 		public:
 
+			// SHA-384 initial hash value, the compressor is shared with SHA-512
+
+			inline static constexpr auto initial_state = SHA512::State{
+				0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL, 0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+				0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL, 0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL
+			};
+
+			// SHA-384 keep the first 48 bytes of the digest
+
+			inline static constexpr auto digest_size = 48_size;
+
 			/**
 			 * message: the message to hash
 			 * return: the hashed message
@@ -18,9 +31,10 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string & message
 			) -> std::string 
 			{
-				auto sha384 = std::make_shared<Sen::Kernel::Dependencies::SHA::SHA384>();
-				auto result = sha384->hash(message);
-				return result;
+				auto context = SHA512::Context{initial_state};
+				context.update(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(message.data()), message.size()});
+				auto digest = context.finalize();
+				return String::to_hexadecimal(std::span<const std::uint8_t>{digest.data(), digest_size});
 			}
 
 			/**
@@ -32,8 +46,25 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string & source
 			) -> std::string 
 			{
-				return SHA384::hash(FileSystem::read_file(source));
+				auto context = SHA512::Context{initial_state};
+				FileSystem::read_chunk(source, SHA512::chunk_size, [&](std::span<const std::uint8_t> data) {
+					context.update(data);
+				});
+				auto digest = context.finalize();
+				return String::to_hexadecimal(std::span<const std::uint8_t>{digest.data(), digest_size});
+			}
+
+			/**
+			 * @param source: source files
+			 * @return: hashed string of every file, in the same order
+			*/
+
+			inline static auto hash_fs_as_multiple_thread(
+				const std::vector<std::string> & source
+			) -> std::vector<std::string>
+			{
+				return Encryption::hash_fs_as_multiple_thread<hash_fs>(source);
 			}
 
 	};
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 
 #include "kernel/definition/library.hpp"
 #include "kernel/definition/macro.hpp"
+#include "kernel/definition/encryption/hash.hpp"
 
 namespace Sen::Kernel::Definition::Encryption {
 
@@ -9,6 +10,157 @@ namespace Sen::Kernel::Definition::Encryption {
 
 		public:
 
+			// Digest definition
+
+			using Digest = std::array<std::uint8_t, 64>;
+
+			// State definition
+
+			using State = std::array<std::uint64_t, 8>;
+
+			// Chunk size used when a file is hashed
+
+			inline static constexpr auto chunk_size = static_cast<std::size_t>(0x100000);
+
+			// SHA-512 initial hash value
+
+			inline static constexpr auto initial_state = State{
+				0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+				0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+			};
+
+			/**
+			 * Incremental SHA-512 compressor
+			 * SHA-384 share this compressor with another initial state
+			*/
+
+			class Context {
+
+				protected:
+
+					inline static constexpr auto constant = std::array<std::uint64_t, 80>{
+						0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL,
+						0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL, 0x12835b0145706fbeULL,
+						0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL, 0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+						0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+						0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL, 0x983e5152ee66dfabULL,
+						0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+						0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL,
+						0x53380d139d95b3dfULL, 0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+						0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+						0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL, 0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL,
+						0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL,
+						0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+						0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL, 0xca273eceea26619cULL,
+						0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL,
+						0x113f9804bef90daeULL, 0x1b710b35131c471bULL, 0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+						0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+					};
+
+					State state{};
+
+					std::array<std::uint8_t, 128> block{};
+
+					std::size_t block_size{};
+
+					std::uint64_t length{};
+
+					auto transform(
+						const std::uint8_t* data
+					) -> void
+					{
+						auto word = std::array<std::uint64_t, 80>{};
+						for (auto i : Range<std::size_t>(16)) {
+							auto value = std::uint64_t{};
+							for (auto j : Range<std::size_t>(8)) {
+								value = (value << 8) | static_cast<std::uint64_t>(data[i * 8 + j]);
+							}
+							word[i] = value;
+						}
+						for (auto i = 16_size; i < 80; ++i) {
+							auto s0 = std::rotr(word[i - 15], 1) ^ std::rotr(word[i - 15], 8) ^ (word[i - 15] >> 7);
+							auto s1 = std::rotr(word[i - 2], 19) ^ std::rotr(word[i - 2], 61) ^ (word[i - 2] >> 6);
+							word[i] = word[i - 16] + s0 + word[i - 7] + s1;
+						}
+						auto [a, b, c, d, e, f, g, h] = thiz.state;
+						for (auto i : Range<std::size_t>(80)) {
+							auto t1 = h + (std::rotr(e, 14) ^ std::rotr(e, 18) ^ std::rotr(e, 41)) + ((e & f) ^ (~e & g)) + constant[i] + word[i];
+							auto t2 = (std::rotr(a, 28) ^ std::rotr(a, 34) ^ std::rotr(a, 39)) + ((a & b) ^ (a & c) ^ (b & c));
+							h = g;
+							g = f;
+							f = e;
+							e = d + t1;
+							d = c;
+							c = b;
+							b = a;
+							a = t1 + t2;
+						}
+						thiz.state[0] += a;
+						thiz.state[1] += b;
+						thiz.state[2] += c;
+						thiz.state[3] += d;
+						thiz.state[4] += e;
+						thiz.state[5] += f;
+						thiz.state[6] += g;
+						thiz.state[7] += h;
+						return;
+					}
+
+				public:
+
+					explicit Context(
+						const State & initial = initial_state
+					) : state(initial)
+					{
+
+					}
+
+					~Context(
+					) = default;
+
+					auto update(
+						std::span<const std::uint8_t> data
+					) -> void
+					{
+						thiz.length += data.size();
+						auto position = 0_size;
+						if (thiz.block_size != 0) {
+							auto size = std::min(data.size(), 128_size - thiz.block_size);
+							std::memcpy(thiz.block.data() + thiz.block_size, data.data(), size);
+							thiz.block_size += size;
+							position += size;
+							if (thiz.block_size != 128) {
+								return;
+							}
+							thiz.transform(thiz.block.data());
+							thiz.block_size = 0;
+						}
+						for (; position + 128 <= data.size(); position += 128) {
+							thiz.transform(data.data() + position);
+						}
+						thiz.block_size = data.size() - position;
+						std::memcpy(thiz.block.data(), data.data() + position, thiz.block_size);
+						return;
+					}
+
+					auto finalize(
+					) -> Digest
+					{
+						auto bit_length = thiz.length * 8;
+						auto padding = std::array<std::uint8_t, 144>{0x80};
+						auto padding_size = (thiz.block_size < 112 ? 112 : 240) - thiz.block_size;
+						for (auto i : Range<std::size_t>(8)) {
+							padding[padding_size + 8 + i] = static_cast<std::uint8_t>(bit_length >> ((7 - i) * 8));
+						}
+						thiz.update(std::span<const std::uint8_t>{padding.data(), padding_size + 16});
+						auto digest = Digest{};
+						for (auto i : Range<std::size_t>(64)) {
+							digest[i] = static_cast<std::uint8_t>(thiz.state[i / 8] >> ((7 - i % 8) * 8));
+						}
+						return digest;
+					}
+			};
+
 			/**
 			 * message: the message to hash
 			 * return: the hashed message
@@ -18,9 +170,9 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string & message
 			) -> std::string
 			{
-				auto sha512 = std::make_shared<Sen::Kernel::Dependencies::SHA::SHA512>();
-				auto result = sha512->hash(message);
-				return result;
+				auto context = Context{};
+				context.update(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(message.data()), message.size()});
+				return String::to_hexadecimal(context.finalize());
 			}
 
 			/**
@@ -32,8 +184,24 @@ namespace Sen::Kernel::Definition::Encryption {
 				const std::string & source
 			) -> std::string const
 			{
-				return SHA512::hash(FileSystem::read_file(source));
+				auto context = Context{};
+				FileSystem::read_chunk(source, chunk_size, [&](std::span<const std::uint8_t> data) {
+					context.update(data);
+				});
+				return String::to_hexadecimal(context.finalize());
+			}
+
+			/**
+			 * @param source: source files
+			 * @returns: hashed string of every file, in the same order
+			*/
+
+			inline static auto hash_fs_as_multiple_thread(
+				const std::vector<std::string> & source
+			) -> std::vector<std::string>
+			{
+				return Encryption::hash_fs_as_multiple_thread<hash_fs>(source);
 			}
 
 	};
-}
\ No newline at end of file
+}
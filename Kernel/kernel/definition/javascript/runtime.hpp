@@ -214,7 +214,129 @@ namespace Sen::Kernel::Definition::JavaScript
 				std::string_view source
 			) -> JSValue
 			{
-				return thiz.evaluate(FileSystem::read_file(source), source);
+				auto source_data = FileSystem::read_file(source);
+				auto lock = std::lock_guard<std::mutex>(thiz.mutex);
+				auto function = JS::compile(thiz.ctx.get(), source_data, source, JS_EVAL_FLAG_STRICT | thiz.evaluate_flag());
+				if (JS_IsException(function) || JS_ResolveModule(thiz.ctx.get(), function) < 0) {
+					throw Exception(thiz.exception(), std::source_location::current(), "evaluate_fs");
+				}
+				auto eval_result = JS_EvalFunction(thiz.ctx.get(), function);
+				if (JS_IsException(eval_result)) {
+					throw Exception(thiz.exception(), std::source_location::current(), "evaluate_fs");
+				}
+				return eval_result;
+			}
+
+			/**
+			 * Bytecode cache kept next to the source file
+			 * Header: magic, layout version, eval flag, engine id and SHA-256 of the source, followed by QuickJS bytecode
+			 * The engine id reject bytecode written by another QuickJS build, its format is not stable across versions
+			 * A cache that does not match or cannot be read is rebuilt, a cache that cannot be written is skipped
+			*/
+
+			inline static constexpr auto bytecode_extension = std::string_view{".bytecode"};
+
+			inline static constexpr auto bytecode_magic = std::array<std::uint8_t, 4>{0x53, 0x45, 0x4E, 0x42};
+
+			inline static constexpr auto bytecode_version = static_cast<std::uint32_t>(2);
+
+			/**
+			 * QuickJS build this kernel is linked with and its pointer size
+			 * quickjs.c_smile has no version macro, keep its id in sync with dependencies/quickjs.c_smile/VERSION
+			*/
+
+			inline static auto make_engine_id(
+			) -> std::string
+			{
+				#if defined MSVC_COMPILER
+					return fmt::format("quickjs.c_smile-2021-03-27-{}", sizeof(void*) * 8);
+				#else
+					return fmt::format("quickjs-ng-{}.{}.{}{}-{}", QJS_VERSION_MAJOR, QJS_VERSION_MINOR, QJS_VERSION_PATCH, QJS_VERSION_SUFFIX, sizeof(void*) * 8);
+				#endif
+			}
+
+			inline static auto make_bytecode_header(
+				const std::string & source_data,
+				int flag
+			) -> std::vector<std::uint8_t>
+			{
+				auto context = Encryption::SHA256::Context{};
+				context.update(std::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(source_data.data()), source_data.size()});
+				auto digest = context.finalize();
+				auto engine_id = make_engine_id();
+				auto header = std::vector<std::uint8_t>(bytecode_magic.begin(), bytecode_magic.end());
+				auto write_uint32 = [&](std::uint32_t value) {
+					for (auto i : Range<std::size_t>(sizeof(std::uint32_t))) {
+						header.emplace_back(static_cast<std::uint8_t>(value >> (i * 8)));
+					}
+				};
+				write_uint32(bytecode_version);
+				write_uint32(static_cast<std::uint32_t>(flag));
+				write_uint32(static_cast<std::uint32_t>(engine_id.size()));
+				header.insert(header.end(), engine_id.begin(), engine_id.end());
+				header.insert(header.end(), digest.begin(), digest.end());
+				return header;
+			}
+
+			/**
+			 * --------------------------------------------------
+			 * Compile a script or a module, using the bytecode cache when it is valid
+			 * @param ctx: JS context
+			 * @param source_data: script source, zero terminated
+			 * @param source_file: script path, the cache is stored beside it
+			 * @param flag: JS_EVAL_TYPE_GLOBAL or JS_EVAL_TYPE_MODULE, with JS_EVAL_FLAG_STRICT when wanted
+			 * @return: function or module to evaluate, JS_EXCEPTION on failure
+			 * --------------------------------------------------
+			*/
+
+			inline static auto compile(
+				JSContext* ctx,
+				const std::string & source_data,
+				std::string_view source_file,
+				int flag
+			) -> JSValue
+			{
+				auto cache_file = fmt::format("{}{}", source_file, bytecode_extension);
+				auto header = make_bytecode_header(source_data, flag);
+				try {
+					auto cache = FileSystem::read_binary<std::uint8_t>(cache_file);
+					if (cache.size() > header.size() && std::equal(header.begin(), header.end(), cache.begin())) {
+						auto function = JS_ReadObject(ctx, cache.data() + header.size(), cache.size() - header.size(), JS_READ_OBJ_BYTECODE);
+						if (!JS_IsException(function)) {
+							return function;
+						}
+						JS_FreeValue(ctx, JS_GetException(ctx));
+					}
+				}
+				catch (...) {
+					// no usable cache, compile from the source
+				}
+				auto source_name = std::string{source_file.data(), source_file.size()};
+				auto function = JS_Eval(ctx, source_data.data(), source_data.size(), source_name.data(), flag | JS_EVAL_FLAG_COMPILE_ONLY);
+				if (JS_IsException(function)) {
+					return function;
+				}
+				auto size = std::size_t{};
+				auto bytecode = JS_WriteObject(ctx, &size, function, JS_WRITE_OBJ_BYTECODE);
+				if (bytecode != nullptr) {
+					header.insert(header.end(), bytecode, bytecode + size);
+					js_free(ctx, bytecode);
+					// write beside then rename, so a concurrent run never read a partial cache
+					auto temporary_file = fmt::format("{}.{}", cache_file, std::random_device{}());
+					try {
+						FileSystem::write_binary<unsigned char>(temporary_file, header);
+						Path::Script::rename(temporary_file, cache_file);
+					}
+					catch (...) {
+						auto error = std::error_code{};
+						#if WINDOWS
+							std::filesystem::remove(std::filesystem::path{String::utf8_to_utf16(temporary_file)}, error);
+						#else
+							std::filesystem::remove(std::filesystem::path{temporary_file}, error);
+						#endif
+					}
+				}
+				return function;
 			}
 
 			/**
@@ -269,7 +391,7 @@ namespace Sen::Kernel::Definition::JavaScript
 			{
 				auto source = std::string{module_name, std::strlen(module_name)};
 				auto file = FileSystem::read_file(source);
-				auto module_val = JS_Eval(ctx, file.data(), file.size(), module_name, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY | JS_EVAL_FLAG_STRICT);
+				auto module_val = JS::compile(ctx, file, source, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_STRICT);
 				if (JS_IsException(module_val)) {
 					JS_FreeValue(ctx, module_val);
 					JS_ThrowInternalError(ctx, "Cannot read module: %s", module_name);
@@ -333,15 +455,28 @@ namespace Sen::Kernel::Definition::JavaScript
 				std::string_view source_file
 			) -> JSValue
 			{
-				thiz.mutex.lock();
+				auto lock = std::lock_guard<std::mutex>(thiz.mutex);
 				auto eval_result = JS_Eval(thiz.ctx.get(), source_data.data(), source_data.size(), source_file.data(), JS_EVAL_FLAG_STRICT | thiz.evaluate_flag());
 				if(JS_IsException(eval_result)){
 					throw Exception(thiz.exception(), std::source_location::current(), "evaluate");
 				}
-				thiz.mutex.unlock();
 				return eval_result;
 			}
 
+			/**
+			 * Evaluate and discard the result
+			 * Used when the same runtime evaluate many times
+			*/
+
+			inline auto execute(
+				std::string_view source_data,
+				std::string_view source_file
+			) -> void
+			{
+				thiz.free_value(thiz.evaluate(source_data, source_file));
+				return;
+			}
+
 			/**
 			 * --------------------------------------
 			 * Add C method to JS
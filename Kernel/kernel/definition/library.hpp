@@ -30,6 +30,11 @@
 #include <set>
 #include <bitset>
 #include <condition_variable>
+#include <atomic>
+#include <queue>
+#include <random>
+#include <list>
+#include <unordered_set>
 #include "kernel/definition/assert.hpp"
 #include "kernel/definition/basic/language.hpp"
 #include "kernel/definition/range.hpp"
@@ -13,6 +13,8 @@
 #include "kernel/definition/basic/image.hpp"
 #include "kernel/definition/basic/json.hpp"
 #include "kernel/definition/basic/json_writer.hpp"
+#include "kernel/definition/basic/json_reader.hpp"
+#include "kernel/definition/basic/string_table.hpp"
 #include "kernel/definition/basic/buffer.hpp"
 #include "kernel/definition/basic/collections.hpp"
 #include "kernel/definition/basic/system.hpp"
@@ -158,6 +158,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::FileSystem::read_directory_only_directory, "Sen"_sv, "Kernel"_sv, "FileSystem"_sv, "read_directory_only_directory"_sv);
 					// read_directory
 					javascript->add_proxy(Script::FileSystem::read_directory, "Sen"_sv, "Kernel"_sv, "FileSystem"_sv, "read_directory"_sv);
+					// walk_directory
+					javascript->add_proxy(Script::FileSystem::walk_directory, "Sen"_sv, "Kernel"_sv, "FileSystem"_sv, "walk_directory"_sv);
 					// is file
 					javascript->add_proxy(Script::FileSystem::is_file, "Sen"_sv, "Kernel"_sv, "FileSystem"_sv, "is_file"_sv);
 					// is directory
@@ -220,6 +222,10 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Process::run, "Sen"_sv, "Kernel"_sv, "Process"_sv, "run"_sv);
 					// execute
 					javascript->add_proxy(Script::Process::execute, "Sen"_sv, "Kernel"_sv, "Process"_sv, "execute"_sv);
+					// spawn
+					javascript->add_proxy(Script::Process::spawn, "Sen"_sv, "Kernel"_sv, "Process"_sv, "spawn"_sv);
+					// spawn_all
+					javascript->add_proxy(Script::Process::spawn_all, "Sen"_sv, "Kernel"_sv, "Process"_sv, "spawn_all"_sv);
 					// is_exists_in_path_environment
 					javascript->add_proxy(Script::Process::is_exists_in_path_environment, "Sen"_sv, "Kernel"_sv, "Process"_sv, "is_exists_in_path_environment"_sv);
 					// get_path_environment
@@ -286,6 +292,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Encryption::MD5::hash, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "MD5"_sv, "hash"_sv);
 					// hash file method
 					javascript->add_proxy(Script::Encryption::MD5::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "MD5"_sv, "hash_fs"_sv);
+					// hash multiple files method
+					javascript->add_proxy(Script::Encryption::MD5::hash_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "MD5"_sv, "hash_fs_as_multiple_threads"_sv);
 				}
 				// rijndael
 				{
@@ -307,13 +315,17 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Encryption::SHA224::hash, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA224"_sv, "hash"_sv);
 					// hash file method
 					javascript->add_proxy(Script::Encryption::SHA224::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA224"_sv, "hash_fs"_sv);
+					// hash multiple files method
+					javascript->add_proxy(Script::Encryption::SHA224::hash_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA224"_sv, "hash_fs_as_multiple_threads"_sv);
 				}
 				// sha256
 				{
 					// hash method
 					javascript->add_proxy(Script::Encryption::SHA256::hash, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash"_sv);
 					// hash file method
-					javascript->add_proxy(Script::Encryption::SHA224::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash_fs"_sv);
+					javascript->add_proxy(Script::Encryption::SHA256::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash_fs"_sv);
+					// hash multiple files method
+					javascript->add_proxy(Script::Encryption::SHA256::hash_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA256"_sv, "hash_fs_as_multiple_threads"_sv);
 				}
 				// sha384
 				{
@@ -321,6 +333,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Encryption::SHA384::hash, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA384"_sv, "hash"_sv);
 					// hash file method
 					javascript->add_proxy(Script::Encryption::SHA384::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA384"_sv, "hash_fs"_sv);
+					// hash multiple files method
+					javascript->add_proxy(Script::Encryption::SHA384::hash_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA384"_sv, "hash_fs_as_multiple_threads"_sv);
 				}
 				// sha512
 				{
@@ -328,6 +342,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Encryption::SHA512::hash, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA512"_sv, "hash"_sv);
 					// hash file method
 					javascript->add_proxy(Script::Encryption::SHA512::hash_fs, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA512"_sv, "hash_fs"_sv);
+					// hash multiple files method
+					javascript->add_proxy(Script::Encryption::SHA512::hash_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Encryption"_sv, "SHA512"_sv, "hash_fs_as_multiple_threads"_sv);
 				}
 				// xor
 				{
@@ -438,6 +454,10 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Support::PopCap::RTON::encode_and_encrypt_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "RTON"_sv, "encode_and_encrypt_fs"_sv);
 					// encode_fs_as_multiple_threads
 					javascript->add_proxy(Script::Support::PopCap::RTON::encode_fs_as_multiple_threads, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "RTON"_sv, "encode_fs_as_multiple_threads"_sv);
+					// decode_directory
+					javascript->add_proxy(Script::Support::PopCap::RTON::decode_directory, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "RTON"_sv, "decode_directory"_sv);
+					// encode_directory
+					javascript->add_proxy(Script::Support::PopCap::RTON::encode_directory, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "RTON"_sv, "encode_directory"_sv);
 				}
 				// zlib
 				{
@@ -499,6 +519,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Support::PopCap::PlayerInfo::decode_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "PlayerInfo"_sv, "decode_fs"_sv);
 					// encode fs
 					javascript->add_proxy(Script::Support::PopCap::PlayerInfo::encode_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "PlayerInfo"_sv, "encode_fs"_sv);
+					javascript->add_proxy(Script::Support::PopCap::PlayerInfo::decode_directory, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "PlayerInfo"_sv, "decode_directory"_sv);
+					javascript->add_proxy(Script::Support::PopCap::PlayerInfo::encode_directory, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "PlayerInfo"_sv, "encode_directory"_sv);
 				}
 				// rsb
 				{
@@ -512,6 +534,14 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Support::PopCap::RSB::pack, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "RSB"_sv, "pack"_sv);
 					// unpack_cipher
 					javascript->add_proxy(Script::Support::PopCap::RSB::unpack_cipher, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "unpack_cipher"_sv);
+					// read_resource_fs
+					javascript->add_proxy(Script::Support::PopCap::RSB::read_resource_fs, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "read_resource_fs"_sv);
+					// resource_list
+					javascript->add_proxy(Script::Support::PopCap::RSB::resource_list, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "resource_list"_sv);
+					// close_reader
+					javascript->add_proxy(Script::Support::PopCap::RSB::close_reader, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "close_reader"_sv);
+					// clear_reader
+					javascript->add_proxy(Script::Support::PopCap::RSB::clear_reader, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "clear_reader"_sv);
 					// unpack_resource
 					javascript->add_proxy(Script::Support::PopCap::RSB::unpack_resource, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv,"RSB"_sv, "unpack_resource"_sv);
 					// pack_resource
@@ -557,6 +587,8 @@ namespace Sen::Kernel::Interface {
 					javascript->add_proxy(Script::Support::PopCap::Animation::Miscellaneous::dump_document, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "Animation"_sv, "Miscellaneous"_sv, "dump_document"_sv);
 					// generate_document
 					javascript->add_proxy(Script::Support::PopCap::Animation::Miscellaneous::generate_document, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "Animation"_sv, "Miscellaneous"_sv, "generate_document"_sv);
+					// render
+					javascript->add_proxy(Script::Support::PopCap::Animation::Miscellaneous::render, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "Animation"_sv, "Miscellaneous"_sv, "render"_sv);
 					// generate_image
 					javascript->add_proxy(Script::Support::PopCap::Animation::Miscellaneous::generate_image, "Sen"_sv, "Kernel"_sv, "Support"_sv, "PopCap"_sv, "Animation"_sv, "Miscellaneous"_sv, "generate_image"_sv);
 					// generate_sprite
@@ -735,7 +767,41 @@ namespace Sen::Kernel::Interface {
 			) -> void
 			{
 				// call main
-				javascript->evaluate("Sen.Script.main()"_sv, std::source_location::current().file_name());
+				javascript->execute("Sen.Script.main()"_sv, std::source_location::current().file_name());
+				// Execute other Promise
+				while (javascript->has_promise()) {
+					javascript->execute_pending_job();
+				}
+				return;
+			}
+
+			/**
+			 * Host mode: load the modules and the setting once, after prepare
+			*/
+
+			inline auto initialize(
+
+			) -> void
+			{
+				javascript->execute("Sen.Script.initialize()"_sv, std::source_location::current().file_name());
+				while (javascript->has_promise()) {
+					javascript->execute_pending_job();
+				}
+				return;
+			}
+
+			/**
+			 * Host mode: run one job, the bundle is not evaluated again
+			*/
+
+			inline auto run_job(
+
+			) -> void
+			{
+				javascript->execute("Sen.Script.run_job()"_sv, std::source_location::current().file_name());
+				while (javascript->has_promise()) {
+					javascript->execute_pending_job();
+				}
 				return;
 			}
 	};
@@ -2,6 +2,20 @@
 
 using namespace Sen::Kernel;
 
+/**
+ * Kernel kept alive between jobs when the Shell run as a host
+ * Bindings and the evaluated script stay warm until finalize
+*/
+
+static auto host = std::unique_ptr<Interface::Callback>{nullptr};
+
+static auto display_exception(
+) -> void
+{
+    Interface::Shell::callback(Interface::construct_string_list(std::vector{std::string{"display"}, fmt::format("Runtime Exception found: {}", parse_exception().what()), std::string{""}, std::string{"red"}}).get(), nullptr);
+    return;
+}
+
 M_EXPORT_API
 auto execute(
     Interface::StringView* script,
@@ -22,8 +36,73 @@ auto execute(
     }
     catch(...)
     {
-        Interface::Shell::callback(Interface::construct_string_list(std::vector{std::string{"display"}, fmt::format("Runtime Exception found: {}", parse_exception().what()), std::string{""}, std::string{"red"}}).get(), nullptr);
+        display_exception();
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Create the host runtime, register every binding, evaluate the script and load the modules once
+ * Each job is then started with run, the host is destroyed by finalize
+*/
+
+M_EXPORT_API
+auto initialize(
+    Interface::StringView* script,
+    Interface::StringList* argument,
+    Interface::ShellCallback m_callback
+) -> int
+{
+    try
+    {
+        std::setlocale(LC_ALL, "C");
+        auto script_path = Interface::make_standard_string(script);
+        auto arguments = Interface::destruct_string_list(argument);
+        Interface::Shell::callback = m_callback;
+        Interface::Additional::assign(script_path, arguments);
+        host = std::make_unique<Interface::Callback>(m_callback);
+        host->prepare();
+        host->initialize();
+    }
+    catch(...)
+    {
+        host.reset();
+        display_exception();
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Run one job on the host runtime with new arguments
+ * A failed job is reported and the host stay usable for the next one
+*/
+
+M_EXPORT_API
+auto run(
+    Interface::StringList* argument
+) -> int
+{
+    try
+    {
+        assert_conditional(host != nullptr, "Kernel host is not initialized", "run");
+        auto arguments = Interface::destruct_string_list(argument);
+        Interface::Additional::arguments = std::make_unique<std::vector<std::string>>(arguments);
+        host->run_job();
+    }
+    catch(...)
+    {
+        display_exception();
         return 1;
     }
     return 0;
-}
\ No newline at end of file
+}
+
+M_EXPORT_API
+auto finalize(
+) -> int
+{
+    host.reset();
+    return 0;
+}
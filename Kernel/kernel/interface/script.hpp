@@ -431,8 +431,8 @@ namespace Sen::Kernel::Interface::Script
 			M_JS_PROXY_WRAPPER(context, {
 				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
 				assert_conditional(JS_IsString(argv[0]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 0, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_string")), "get");
-				auto result = Sen::Kernel::Language::get(JS::Converter::get_string(context, argv[0]));
-				return JS::Converter::to_string(context, result.data()); }, "get"_sv);
+				auto key = JS::Converter::get_string(context, argv[0]);
+				return JS::Converter::to_string(context, Sen::Kernel::Language::get(key)); }, "get"_sv);
 		}
 
 	}
@@ -2430,11 +2430,408 @@ namespace Sen::Kernel::Interface::Script
 					return JS_UNDEFINED; }, "close"_sv);
 			}
 
+#pragma region number
+
+			/**
+			 * Number fast path for byte level script loops
+			 * The value is returned as Number instead of BigInt, only types that always fit in 53 bits are exposed,
+			 * 64-bit values stay on the BigInt methods. Arguments are not formatted unless the call fails
+			 */
+
+			enum class NumberType : std::uint8_t
+			{
+				uint8,
+				uint16,
+				uint24,
+				uint32,
+				int8,
+				int16,
+				int24,
+				int32,
+				varint32,
+				varuint32,
+				zigzag32,
+				float32,
+				float64,
+			};
+
+			template <auto T, auto type>
+				requires BooleanConstraint
+			inline static auto read_number_of(
+				JSContext *ctx,
+				Data<T> *s) -> JSElement::number
+			{
+				if constexpr (type == NumberType::uint8) {
+					return JS_NewInt32(ctx, s->readUint8());
+				}
+				else if constexpr (type == NumberType::uint16) {
+					return JS_NewInt32(ctx, s->readUint16());
+				}
+				else if constexpr (type == NumberType::uint24) {
+					return JS_NewInt32(ctx, static_cast<std::int32_t>(s->readUint24()));
+				}
+				else if constexpr (type == NumberType::uint32) {
+					return JS_NewUint32(ctx, s->readUint32());
+				}
+				else if constexpr (type == NumberType::int8) {
+					return JS_NewInt32(ctx, s->readInt8());
+				}
+				else if constexpr (type == NumberType::int16) {
+					return JS_NewInt32(ctx, s->readInt16());
+				}
+				else if constexpr (type == NumberType::int24) {
+					return JS_NewInt32(ctx, s->readInt24());
+				}
+				else if constexpr (type == NumberType::int32) {
+					return JS_NewInt32(ctx, s->readInt32());
+				}
+				else if constexpr (type == NumberType::varint32) {
+					return JS_NewInt32(ctx, s->readVarInt32());
+				}
+				else if constexpr (type == NumberType::varuint32) {
+					return JS_NewUint32(ctx, s->readVarUint32());
+				}
+				else if constexpr (type == NumberType::zigzag32) {
+					return JS_NewInt32(ctx, s->readZigZag32());
+				}
+				else if constexpr (type == NumberType::float32) {
+					return JS_NewFloat64(ctx, static_cast<double>(s->readFloat()));
+				}
+				else {
+					static_assert(type == NumberType::float64);
+					return JS_NewFloat64(ctx, s->readDouble());
+				}
+			}
+
+			template <auto T, auto type>
+				requires BooleanConstraint
+			inline static auto write_number_of(
+				JSContext *ctx,
+				Data<T> *s,
+				JSValueConst value) -> bool
+			{
+				if constexpr (type == NumberType::float32 || type == NumberType::float64) {
+					auto v = double{};
+					if (JS_ToFloat64(ctx, &v, value)) {
+						return false;
+					}
+					if constexpr (type == NumberType::float32) {
+						s->writeFloat(static_cast<float>(v));
+					}
+					else {
+						s->writeDouble(v);
+					}
+				}
+				else {
+					auto v = std::int32_t{};
+					if (JS_ToInt32(ctx, &v, value)) {
+						return false;
+					}
+					if constexpr (type == NumberType::uint8) {
+						s->writeUint8(static_cast<std::uint8_t>(v));
+					}
+					else if constexpr (type == NumberType::uint16) {
+						s->writeUint16(static_cast<std::uint16_t>(v));
+					}
+					else if constexpr (type == NumberType::uint24) {
+						s->writeUint24(static_cast<std::uint32_t>(v));
+					}
+					else if constexpr (type == NumberType::uint32) {
+						s->writeUint32(static_cast<std::uint32_t>(v));
+					}
+					else if constexpr (type == NumberType::int8) {
+						s->writeInt8(static_cast<std::int8_t>(v));
+					}
+					else if constexpr (type == NumberType::int16) {
+						s->writeInt16(static_cast<std::int16_t>(v));
+					}
+					else if constexpr (type == NumberType::int24) {
+						s->writeInt24(v);
+					}
+					else if constexpr (type == NumberType::int32) {
+						s->writeInt32(v);
+					}
+					else if constexpr (type == NumberType::varint32 || type == NumberType::varuint32) {
+						s->writeVarInt32(v);
+					}
+					else {
+						static_assert(type == NumberType::zigzag32);
+						s->writeZigZag32(v);
+					}
+				}
+				return true;
+			}
+
+			template <auto T, auto type>
+				requires BooleanConstraint
+			inline static auto read_number(
+				JSContext *ctx,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSElement::number
+			{
+				static_assert(T == true or T == false, "T must be true or false");
+				auto s = static_cast<Data<T> *>(JS_GetOpaque2(ctx, this_val, ClassID<T>::value));
+				if (s == nullptr) {
+					return JS_EXCEPTION;
+				}
+				M_JS_PROXY_WRAPPER(ctx, {
+					return (read_number_of<T, type>)(ctx, s); }, "read_number"_sv);
+			}
+
+			template <auto T, auto type>
+				requires BooleanConstraint
+			inline static auto write_number(
+				JSContext *ctx,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSElement::undefined
+			{
+				static_assert(T == true or T == false, "T must be true or false");
+				auto s = static_cast<Data<T> *>(JS_GetOpaque2(ctx, this_val, ClassID<T>::value));
+				if (s == nullptr) {
+					return JS_EXCEPTION;
+				}
+				M_JS_PROXY_WRAPPER(ctx, {
+					if (argc != 1) {
+						throw Exception(fmt::format("argument expected 1, received: {}", argc), std::source_location::current(), "write_number");
+					}
+					if (!(write_number_of<T, type>)(ctx, s, argv[0])) {
+						return JS_EXCEPTION;
+					}
+					return JS_UNDEFINED; }, "write_number"_sv);
+			}
+
+			template <auto T>
+				requires BooleanConstraint
+			inline static auto offset_getter(
+				JSContext *ctx,
+				JSValueConst this_val,
+				int magic) -> JSElement::number
+			{
+				static_assert(T == true or T == false, "T must be true or false");
+				auto s = static_cast<Data<T> *>(JS_GetOpaque2(ctx, this_val, ClassID<T>::value));
+				if (s == nullptr)
+				{
+					return JS_EXCEPTION;
+				}
+				if (magic == 0)
+				{
+					return JS_NewInt64(ctx, static_cast<std::int64_t>(s->read_pos));
+				}
+				else
+				{
+					return JS_NewInt64(ctx, static_cast<std::int64_t>(s->write_pos));
+				}
+			}
+
+			template <auto T>
+				requires BooleanConstraint
+			inline static auto offset_setter(
+				JSContext *ctx,
+				JSValueConst this_val,
+				JSValueConst val,
+				int magic) -> JSElement::undefined
+			{
+				static_assert(T == true or T == false, "T must be true or false");
+				auto s = static_cast<Data<T> *>(JS_GetOpaque2(ctx, this_val, ClassID<T>::value));
+				auto v = std::uint64_t{};
+				if (s == nullptr)
+				{
+					return JS_EXCEPTION;
+				}
+				if (JS_ToIndex(ctx, &v, val))
+				{
+					return JS_EXCEPTION;
+				}
+				if (magic == 0)
+				{
+					s->read_pos = static_cast<std::size_t>(v);
+				}
+				else
+				{
+					s->write_pos = static_cast<std::size_t>(v);
+				}
+				return JS_UNDEFINED;
+			}
+
+#pragma endregion
+
+#pragma region typed array
+
+			/**
+			 * Bulk typed array exchange, the whole block is bounds checked once
+			 * and the element endian follow the stream
+			 */
+
+			template <typename Value>
+			inline static auto constexpr typed_array_name = std::string_view{};
+
+			template <>
+			inline auto constexpr typed_array_name<std::uint8_t> = "Uint8Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<std::int8_t> = "Int8Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<std::uint16_t> = "Uint16Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<std::int16_t> = "Int16Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<std::uint32_t> = "Uint32Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<std::int32_t> = "Int32Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<float> = "Float32Array"_sv;
+
+			template <>
+			inline auto constexpr typed_array_name<double> = "Float64Array"_sv;
+
+			template <typename Value>
+			inline static auto to_typed_array(
+				JSContext *ctx,
+				const std::uint8_t *data,
+				std::size_t size) -> JSElement::any
+			{
+				auto array_buffer = JS_NewArrayBufferCopy(ctx, data, size);
+				if (JS_IsException(array_buffer)) {
+					return array_buffer;
+				}
+				auto global_obj = JS_GetGlobalObject(ctx);
+				auto typed_array_ctor = JS_GetPropertyStr(ctx, global_obj, typed_array_name<Value>.data());
+				JSValue args[] = {array_buffer};
+				auto typed_array = JS_CallConstructor(ctx, typed_array_ctor, 1, args);
+				JS_FreeValue(ctx, array_buffer);
+				JS_FreeValue(ctx, global_obj);
+				JS_FreeValue(ctx, typed_array_ctor);
+				return typed_array;
+			}
+
+			// value is an instance of the typed array matching Value, -1 when the check threw
+
+			template <typename Value>
+			inline static auto is_typed_array_of(
+				JSContext *ctx,
+				JSValueConst value) -> int
+			{
+				auto global_obj = JS_GetGlobalObject(ctx);
+				auto typed_array_ctor = JS_GetPropertyStr(ctx, global_obj, typed_array_name<Value>.data());
+				auto result = JS_IsInstanceOf(ctx, value, typed_array_ctor);
+				JS_FreeValue(ctx, global_obj);
+				JS_FreeValue(ctx, typed_array_ctor);
+				return result;
+			}
+
+			template <auto T, typename Value>
+				requires BooleanConstraint
+			inline static auto read_typed_array(
+				JSContext *ctx,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSElement::any
+			{
+				static_assert(T == true or T == false, "T must be true or false");
+				auto s = static_cast<Data<T> *>(JS_GetOpaque2(ctx, this_val, ClassID<T>::value));
+				if (s == nullptr) {
+					return JS_EXCEPTION;
+				}
+				M_JS_PROXY_WRAPPER(ctx, {
+					if (argc != 1) {
+						throw Exception(fmt::format("argument expected 1, received: {}", argc), std::source_location::current(), "read_typed_array");
+					}
+					auto count = std::uint64_t{};
+					if (JS_ToIndex(ctx, &count, argv[0])) {
+						return JS_EXCEPTION;
+					}
+					if (count > s->size()) {
+						throw Exception(fmt::format("{}, {}: {} <= {}", Kernel::Language::get("offset_outside_bounds_of_data_stream"), Kernel::Language::get("but_received"), count, s->size()), std::source_location::current(), "read_typed_array");
+					}
+					auto size = static_cast<std::size_t>(count) * sizeof(Value);
+					auto source = s->read_block(size);
+					if constexpr (T && sizeof(Value) > 1) {
+						auto data = std::vector<Value>(static_cast<std::size_t>(count));
+						std::memcpy(data.data(), source, size);
+						for (auto & element : data) {
+							element = Data<T>::reverse_endian(element);
+						}
+						return to_typed_array<Value>(ctx, reinterpret_cast<const std::uint8_t *>(data.data()), size);
+					}
+					else {
+						return to_typed_array<Value>(ctx, source, size);
+					}
+				}, "read_typed_array"_sv);
+			}
+
+			template <auto T, typename Value>
+				requires BooleanConstraint
+			inline static auto write_typed_array(
+				JSContext *ctx,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSElement::undefined
+			{
+				static_assert(T == true or T == false, "T must be true or false");
+				auto s = static_cast<Data<T> *>(JS_GetOpaque2(ctx, this_val, ClassID<T>::value));
+				if (s == nullptr) {
+					return JS_EXCEPTION;
+				}
+				M_JS_PROXY_WRAPPER(ctx, {
+					if (argc != 1) {
+						throw Exception(fmt::format("argument expected 1, received: {}", argc), std::source_location::current(), "write_typed_array");
+					}
+					// Int32Array and Float32Array share the element size, so the type itself is checked
+					auto is_matched = is_typed_array_of<Value>(ctx, argv[0]);
+					if (is_matched < 0) {
+						return JS_EXCEPTION;
+					}
+					if (is_matched == 0) {
+						throw Exception(fmt::format("{} {}", Kernel::Language::get("js.typed_array_element_size_mismatch"), typed_array_name<Value>), std::source_location::current(), "write_typed_array");
+					}
+					auto byte_offset = std::size_t{};
+					auto byte_length = std::size_t{};
+					auto bytes_per_element = std::size_t{};
+					auto array_buffer = JS_GetTypedArrayBuffer(ctx, argv[0], &byte_offset, &byte_length, &bytes_per_element);
+					if (JS_IsException(array_buffer)) {
+						return JS_EXCEPTION;
+					}
+					auto buffer_size = std::size_t{};
+					auto buffer = JS_GetArrayBuffer(ctx, &buffer_size, array_buffer);
+					JS_FreeValue(ctx, array_buffer);
+					if (buffer == nullptr) {
+						return JS_EXCEPTION;
+					}
+					if (bytes_per_element != sizeof(Value)) {
+						throw Exception(fmt::format("{} {}", Kernel::Language::get("js.typed_array_element_size_mismatch"), typed_array_name<Value>), std::source_location::current(), "write_typed_array");
+					}
+					auto source = buffer + byte_offset;
+					if constexpr (T && sizeof(Value) > 1) {
+						auto data = std::vector<Value>(byte_length / sizeof(Value));
+						std::memcpy(data.data(), source, byte_length);
+						for (auto & element : data) {
+							element = Data<T>::reverse_endian(element);
+						}
+						s->write_block(reinterpret_cast<const std::uint8_t *>(data.data()), byte_length);
+					}
+					else {
+						s->write_block(source, byte_length);
+					}
+					return JS_UNDEFINED;
+				}, "write_typed_array"_sv);
+			}
+
+#pragma endregion
+
 			template <auto T>
 				requires BooleanConstraint
 			inline static const JSCFunctionListEntry proto_functions[] = {
 				JS_CPPGETSET_MAGIC_DEF("read_position", getter<T>, setter<T>, 0),
 				JS_CPPGETSET_MAGIC_DEF("write_position", getter<T>, setter<T>, 1),
+				JS_CPPGETSET_MAGIC_DEF("read_offset", offset_getter<T>, offset_setter<T>, 0),
+				JS_CPPGETSET_MAGIC_DEF("write_offset", offset_getter<T>, offset_setter<T>, 1),
 				JS_CPPFUNC_DEF("size", 0, size<T>),
 				JS_CPPFUNC_DEF("fromString", 1, fromString<T>),
 				JS_CPPFUNC_DEF("capacity", 0, capacity<T>),
@@ -2503,6 +2900,47 @@ namespace Sen::Kernel::Interface::Script
 				JS_CPPFUNC_DEF("readDouble", 1, readDouble<T>),
 				JS_CPPFUNC_DEF("close", 0, close<T>),
 				JS_CPPFUNC_DEF("allocate", 1, allocate<T>),
+				JS_CPPFUNC_DEF("readUint8AsNumber", 0, (read_number<T, NumberType::uint8>)),
+				JS_CPPFUNC_DEF("readUint16AsNumber", 0, (read_number<T, NumberType::uint16>)),
+				JS_CPPFUNC_DEF("readUint24AsNumber", 0, (read_number<T, NumberType::uint24>)),
+				JS_CPPFUNC_DEF("readUint32AsNumber", 0, (read_number<T, NumberType::uint32>)),
+				JS_CPPFUNC_DEF("readInt8AsNumber", 0, (read_number<T, NumberType::int8>)),
+				JS_CPPFUNC_DEF("readInt16AsNumber", 0, (read_number<T, NumberType::int16>)),
+				JS_CPPFUNC_DEF("readInt24AsNumber", 0, (read_number<T, NumberType::int24>)),
+				JS_CPPFUNC_DEF("readInt32AsNumber", 0, (read_number<T, NumberType::int32>)),
+				JS_CPPFUNC_DEF("readVarInt32AsNumber", 0, (read_number<T, NumberType::varint32>)),
+				JS_CPPFUNC_DEF("readVarUint32AsNumber", 0, (read_number<T, NumberType::varuint32>)),
+				JS_CPPFUNC_DEF("readZigZag32AsNumber", 0, (read_number<T, NumberType::zigzag32>)),
+				JS_CPPFUNC_DEF("readFloatAsNumber", 0, (read_number<T, NumberType::float32>)),
+				JS_CPPFUNC_DEF("readDoubleAsNumber", 0, (read_number<T, NumberType::float64>)),
+				JS_CPPFUNC_DEF("writeUint8AsNumber", 1, (write_number<T, NumberType::uint8>)),
+				JS_CPPFUNC_DEF("writeUint16AsNumber", 1, (write_number<T, NumberType::uint16>)),
+				JS_CPPFUNC_DEF("writeUint24AsNumber", 1, (write_number<T, NumberType::uint24>)),
+				JS_CPPFUNC_DEF("writeUint32AsNumber", 1, (write_number<T, NumberType::uint32>)),
+				JS_CPPFUNC_DEF("writeInt8AsNumber", 1, (write_number<T, NumberType::int8>)),
+				JS_CPPFUNC_DEF("writeInt16AsNumber", 1, (write_number<T, NumberType::int16>)),
+				JS_CPPFUNC_DEF("writeInt24AsNumber", 1, (write_number<T, NumberType::int24>)),
+				JS_CPPFUNC_DEF("writeInt32AsNumber", 1, (write_number<T, NumberType::int32>)),
+				JS_CPPFUNC_DEF("writeVarInt32AsNumber", 1, (write_number<T, NumberType::varint32>)),
+				JS_CPPFUNC_DEF("writeVarUint32AsNumber", 1, (write_number<T, NumberType::varuint32>)),
+				JS_CPPFUNC_DEF("writeZigZag32AsNumber", 1, (write_number<T, NumberType::zigzag32>)),
+				JS_CPPFUNC_DEF("writeFloatAsNumber", 1, (write_number<T, NumberType::float32>)),
+				JS_CPPFUNC_DEF("writeDoubleAsNumber", 1, (write_number<T, NumberType::float64>)),
+				JS_CPPFUNC_DEF("readUint8Array", 1, (read_typed_array<T, std::uint8_t>)),
+				JS_CPPFUNC_DEF("readInt8Array", 1, (read_typed_array<T, std::int8_t>)),
+				JS_CPPFUNC_DEF("readUint16Array", 1, (read_typed_array<T, std::uint16_t>)),
+				JS_CPPFUNC_DEF("readInt16Array", 1, (read_typed_array<T, std::int16_t>)),
+				JS_CPPFUNC_DEF("readUint32Array", 1, (read_typed_array<T, std::uint32_t>)),
+				JS_CPPFUNC_DEF("readInt32Array", 1, (read_typed_array<T, std::int32_t>)),
+				JS_CPPFUNC_DEF("readFloat32Array", 1, (read_typed_array<T, float>)),
+				JS_CPPFUNC_DEF("readFloat64Array", 1, (read_typed_array<T, double>)),
+				JS_CPPFUNC_DEF("writeInt8Array", 1, (write_typed_array<T, std::int8_t>)),
+				JS_CPPFUNC_DEF("writeUint16Array", 1, (write_typed_array<T, std::uint16_t>)),
+				JS_CPPFUNC_DEF("writeInt16Array", 1, (write_typed_array<T, std::int16_t>)),
+				JS_CPPFUNC_DEF("writeUint32Array", 1, (write_typed_array<T, std::uint32_t>)),
+				JS_CPPFUNC_DEF("writeInt32Array", 1, (write_typed_array<T, std::int32_t>)),
+				JS_CPPFUNC_DEF("writeFloat32Array", 1, (write_typed_array<T, float>)),
+				JS_CPPFUNC_DEF("writeFloat64Array", 1, (write_typed_array<T, double>)),
 			};
 
 			template <auto use_big_endian>
@@ -7783,6 +8221,75 @@ namespace Sen::Kernel::Interface::Script
 				return JS::Converter::to_string(context, result); }, "evaluate"_sv);
 		}
 
+		inline static auto exchange_process_result(
+			Sen::Kernel::ProcessResult const &result) -> nlohmann::ordered_json
+		{
+			return nlohmann::ordered_json{
+				{"exit_code", result.exit_code},
+				{"output", result.output},
+				{"error", result.error}};
+		}
+
+		/**
+		 * ----------------------------------------
+		 * JavaScript Spawn Process without shell
+		 * @param argv[0]: program followed by its arguments
+		 * @return: exit code, stdout and stderr
+		 * ----------------------------------------
+		 */
+
+		inline static auto spawn(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSElement::Object
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				assert_conditional(JS_IsArray(context, argv[0]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 0, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_array")), "spawn");
+				auto result = Sen::Kernel::Process::spawn(JS::Converter::get_vector<std::string>(context, argv[0]));
+				return JSON::json_to_js_value(context, exchange_process_result(result)); }, "spawn"_sv);
+		}
+
+		/**
+		 * ----------------------------------------
+		 * JavaScript Spawn every Process, bounded parallelism
+		 * @param argv[0]: list of program followed by its arguments
+		 * @param argv[1]: concurrent process limit, optional
+		 * @return: result of each command, same order
+		 * ----------------------------------------
+		 */
+
+		inline static auto spawn_all(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSElement::Array
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1 || argc == 2, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				assert_conditional(JS_IsArray(context, argv[0]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 0, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_array")), "spawn_all");
+				auto length_value = JS_GetPropertyStr(context, argv[0], "length");
+				auto length = JS::Converter::get_int32(context, length_value);
+				JS_FreeValue(context, length_value);
+				auto command_list = std::vector<std::vector<std::string>>{};
+				command_list.reserve(static_cast<std::size_t>(length));
+				for (auto i : Range<int>(length))
+				{
+					auto element = JS_GetPropertyUint32(context, argv[0], i);
+					command_list.emplace_back(JS::Converter::get_vector<std::string>(context, element));
+					JS_FreeValue(context, element);
+				}
+				auto limit = argc == 2 ? static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[1])) : ThreadPool::hardware_concurrency();
+				auto result = Sen::Kernel::Process::spawn_all(command_list, limit);
+				auto json = nlohmann::ordered_json::array();
+				for (auto &element : result)
+				{
+					json.emplace_back(exchange_process_result(element));
+				}
+				return JSON::json_to_js_value(context, json); }, "spawn_all"_sv);
+		}
+
 	}
 
 	/**
@@ -8342,6 +8849,52 @@ namespace Sen::Kernel::Interface::Script
 				return JS::Converter::to_array(context, result); }, "read_directory"_sv);
 		}
 
+		/**
+		 * ----------------------------------------
+		 * JS walk directory method
+		 * @param argv[0]: source directory
+		 * @param argv[1]: accepted extensions, empty array accept every file
+		 * @param argv[2]: glob pattern relative to source, empty string accept every file
+		 * @param argv[3]: callback receiving each batch of file paths
+		 * @return: undefined
+		 * ----------------------------------------
+		 */
+
+		inline static auto walk_directory(
+			JSContext *context,
+			JSValueConst this_val,
+			int argc,
+			JSValueConst *argv) -> JSElement::undefined
+		{
+			M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 4, fmt::format("{} 4, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+				assert_conditional(JS_IsString(argv[0]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 0, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_string")), "walk_directory");
+				assert_conditional(JS_IsArray(context, argv[1]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 1, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_array")), "walk_directory");
+				assert_conditional(JS_IsString(argv[2]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 2, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_string")), "walk_directory");
+				assert_conditional(JS_IsFunction(context, argv[3]), fmt::format("{} {} {} {}", Kernel::Language::get("kernel.expected_argument"), 3, Kernel::Language::get("is"), Kernel::Language::get("kernel.tuple.js_function")), "walk_directory");
+				auto source = JS::Converter::get_string(context, argv[0]);
+				auto filter = Sen::Kernel::FileSystem::DirectoryFilter{};
+				filter.extension = JS::Converter::get_vector<std::string>(context, argv[1]);
+				filter.pattern = JS::Converter::get_string(context, argv[2]);
+				// a script exception stop the walk and is forwarded untouched
+				struct Interrupt {};
+				try {
+					Sen::Kernel::FileSystem::walk_directory(source, filter, [&](std::vector<std::string> && files) {
+						auto batch = JS::Converter::to_array(context, files);
+						auto result = JS_Call(context, argv[3], JS_UNDEFINED, 1, &batch);
+						JS_FreeValue(context, batch);
+						if (JS_IsException(result)) {
+							throw Interrupt{};
+						}
+						JS_FreeValue(context, result);
+					});
+				}
+				catch (Interrupt &) {
+					return JS_EXCEPTION;
+				}
+				return JS::Converter::get_undefined(); }, "walk_directory"_sv);
+		}
+
 		/**
 		 * ----------------------------------------
 		 * JS create directory
@@ -9301,8 +9854,12 @@ namespace Sen::Kernel::Interface::Script
 				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
 				auto source = JS::Converter::get_string(context, argv[0]);
 				auto js_source = Sen::Kernel::FileSystem::read_file(source);
-				auto m_value = JS_Eval(context, js_source.data(), js_source.size(), source.data(), JS_EVAL_TYPE_GLOBAL);
-				return m_value; }, "evaluate_fs"_sv);
+				// through the bytecode cache, every module of the bundle is loaded here
+				auto function = JS::Runtime::compile(context, js_source, source, JS_EVAL_TYPE_GLOBAL);
+				if (JS_IsException(function)) {
+					return function;
+				}
+				return JS_EvalFunction(context, function); }, "evaluate_fs"_sv);
 		}
 	}
 
@@ -9502,6 +10059,27 @@ namespace Sen::Kernel::Interface::Script
 					auto result = Sen::Kernel::Definition::Encryption::MD5::hash_fs(source);
 					return JS::Converter::to_string(context, result); }, "hash_fs"_sv);
 			}
+
+			/**
+			 * ----------------------------------------
+			 * JavaScript MD5 Hash multiple files
+			 * @param argv[0]: source files
+			 * @returns: hashed string of every file
+			 * ----------------------------------------
+			 */
+
+			inline static auto hash_fs_as_multiple_threads(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+					auto result = Sen::Kernel::Definition::Encryption::MD5::hash_fs_as_multiple_thread(source);
+					return JS::Converter::to_array(context, result); }, "hash_fs_as_multiple_threads"_sv);
+			}
 		}
 
 		/**
@@ -9696,6 +10274,27 @@ namespace Sen::Kernel::Interface::Script
 					return JS::Converter::to_string(context, result); }, "hash_fs"_sv);
 			}
 
+			/**
+			 * ----------------------------------------
+			 * JavaScript SHA224 Hash multiple files
+			 * @param argv[0]: source files
+			 * @returns: hashed string of every file
+			 * ----------------------------------------
+			 */
+
+			inline static auto hash_fs_as_multiple_threads(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+					auto result = Sen::Kernel::Definition::Encryption::Sha224::hash_fs_as_multiple_thread(source);
+					return JS::Converter::to_array(context, result); }, "hash_fs_as_multiple_threads"_sv);
+			}
+
 		}
 
 		/**
@@ -9745,6 +10344,27 @@ namespace Sen::Kernel::Interface::Script
 					auto result = Sen::Kernel::Definition::Encryption::SHA256::hash_fs(source);
 					return JS::Converter::to_string(context, result); }, "hash_fs"_sv);
 			}
+
+			/**
+			 * ----------------------------------------
+			 * JavaScript SHA256 Hash multiple files
+			 * @param argv[0]: source files
+			 * @returns: hashed string of every file
+			 * ----------------------------------------
+			 */
+
+			inline static auto hash_fs_as_multiple_threads(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+					auto result = Sen::Kernel::Definition::Encryption::SHA256::hash_fs_as_multiple_thread(source);
+					return JS::Converter::to_array(context, result); }, "hash_fs_as_multiple_threads"_sv);
+			}
 		}
 
 		/**
@@ -9794,6 +10414,27 @@ namespace Sen::Kernel::Interface::Script
 					auto result = Sen::Kernel::Definition::Encryption::SHA384::hash_fs(source);
 					return JS::Converter::to_string(context, result); }, "hash_fs"_sv);
 			}
+
+			/**
+			 * ----------------------------------------
+			 * JavaScript SHA384 Hash multiple files
+			 * @param argv[0]: source files
+			 * @returns: hashed string of every file
+			 * ----------------------------------------
+			 */
+
+			inline static auto hash_fs_as_multiple_threads(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+					auto result = Sen::Kernel::Definition::Encryption::SHA384::hash_fs_as_multiple_thread(source);
+					return JS::Converter::to_array(context, result); }, "hash_fs_as_multiple_threads"_sv);
+			}
 		}
 
 		/**
@@ -9843,6 +10484,27 @@ namespace Sen::Kernel::Interface::Script
 					auto result = Sen::Kernel::Definition::Encryption::SHA512::hash_fs(source);
 					return JS::Converter::to_string(context, result); }, "hash_fs"_sv);
 			}
+
+			/**
+			 * ----------------------------------------
+			 * JavaScript SHA512 Hash multiple files
+			 * @param argv[0]: source files
+			 * @returns: hashed string of every file
+			 * ----------------------------------------
+			 */
+
+			inline static auto hash_fs_as_multiple_threads(
+				JSContext *context,
+				JSValueConst this_val,
+				int argc,
+				JSValueConst *argv) -> JSValue
+			{
+				M_JS_PROXY_WRAPPER(context, {
+				try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_vector<std::string>(context, argv[0]);
+					auto result = Sen::Kernel::Definition::Encryption::SHA512::hash_fs_as_multiple_thread(source);
+					return JS::Converter::to_array(context, result); }, "hash_fs_as_multiple_threads"_sv);
+			}
 		}
 
 		/**
@@ -10393,6 +11055,25 @@ namespace Sen::Kernel::Interface::Script
 	namespace Support
 	{
 
+		/**
+		 * Result of the directory conversions, processed count and the files that failed
+		 */
+
+		inline static auto exchange_batch_result(
+			Sen::Kernel::Support::Miscellaneous::Batch::Result const &result) -> nlohmann::ordered_json
+		{
+			auto error = nlohmann::ordered_json::array();
+			for (auto &element : result.error)
+			{
+				error.emplace_back(nlohmann::ordered_json{
+					{"source", element.source},
+					{"message", element.message}});
+			}
+			return nlohmann::ordered_json{
+				{"processed", result.processed},
+				{"error", error}};
+		}
+
 		/**
 		 * JavaScript Texture Encode & Decode
 		 */
@@ -11211,6 +11892,56 @@ namespace Sen::Kernel::Interface::Script
 						return JS::Converter::get_undefined(); }, "encode_fs");
 				}
 
+				/**
+				 * ----------------------------------------
+				 * JavaScript PlayerInfo Decode Directory
+				 * @param argv[0]: source directory
+				 * @param argv[1]: destination directory
+				 * @param argv[2]: worker limit, optional
+				 * @returns: processed count and the profiles that failed
+				 * ----------------------------------------
+				 */
+
+				inline static auto decode_directory(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 2 || argc == 3, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto destination = JS::Converter::get_string(context, argv[1]);
+						auto limit = (argc == 3 ? static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[2])) : ThreadPool::hardware_concurrency());
+						auto result = Sen::Kernel::Support::PopCap::PlayerInfo::Batch::decode_directory(source, destination, limit);
+						return JSON::json_to_js_value(context, exchange_batch_result(result)); }, "decode_directory"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript PlayerInfo Encode Directory
+				 * @param argv[0]: source directory
+				 * @param argv[1]: destination directory
+				 * @param argv[2]: worker limit, optional
+				 * @returns: processed count and the profiles that failed
+				 * ----------------------------------------
+				 */
+
+				inline static auto encode_directory(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 2 || argc == 3, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto destination = JS::Converter::get_string(context, argv[1]);
+						auto limit = (argc == 3 ? static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[2])) : ThreadPool::hardware_concurrency());
+						auto result = Sen::Kernel::Support::PopCap::PlayerInfo::Batch::encode_directory(source, destination, limit);
+						return JSON::json_to_js_value(context, exchange_batch_result(result)); }, "encode_directory"_sv);
+				}
+
 			}
 
 			/**
@@ -11531,6 +12262,120 @@ namespace Sen::Kernel::Interface::Script
 						Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Instance::encode_and_encrypt_fs(source, destination, key, iv);
 						return JS::Converter::get_undefined(); }, "encode_and_encrypt_fs"_sv);
 				}
+
+				/**
+				 * Shared by the directory methods
+				 * argv[2]: rijndael { key, iv }, null when the files are not encrypted
+				 * argv[3]: progress callback receiving done and total, optional
+				 * argv[4]: worker limit, optional
+				 */
+
+				template <auto use_decode>
+				inline static auto process_directory(
+					JSContext *context,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					static_assert(use_decode == true or use_decode == false);
+					try_assert(argc >= 2 && argc <= 5, fmt::format("{} 2, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+					auto source = JS::Converter::get_string(context, argv[0]);
+					auto destination = JS::Converter::get_string(context, argv[1]);
+					auto setting = Sen::Kernel::Support::PopCap::ReflectionObjectNotation::BatchSetting{
+						.use_rijndael = false,
+						.limit = ThreadPool::hardware_concurrency(),
+					};
+					if (argc >= 3 && JS_IsObject(argv[2]))
+					{
+						auto key = JS_GetPropertyStr(context, argv[2], "key");
+						auto iv = JS_GetPropertyStr(context, argv[2], "iv");
+						setting.use_rijndael = true;
+						setting.key = JS::Converter::get_string(context, key);
+						setting.iv = JS::Converter::get_string(context, iv);
+						JS_FreeValue(context, key);
+						JS_FreeValue(context, iv);
+					}
+					auto has_progress = argc >= 4 && JS_IsFunction(context, argv[3]);
+					if (argc == 5)
+					{
+						setting.limit = static_cast<std::size_t>(JS::Converter::get_bigint64(context, argv[4]));
+					}
+					// a script exception stop the batch and is forwarded untouched
+					struct Interrupt {};
+					auto progress = [&](std::size_t done, std::size_t total) {
+						if (!has_progress) {
+							return;
+						}
+						JSValue argument[] = {JS::Converter::to_bigint<std::uint64_t>(context, done), JS::Converter::to_bigint<std::uint64_t>(context, total)};
+						auto result = JS_Call(context, argv[3], JS_UNDEFINED, 2, argument);
+						JS_FreeValue(context, argument[0]);
+						JS_FreeValue(context, argument[1]);
+						if (JS_IsException(result)) {
+							throw Interrupt{};
+						}
+						JS_FreeValue(context, result);
+					};
+					try
+					{
+						if constexpr (use_decode)
+						{
+							auto result = Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Batch::decode_directory(source, destination, setting, progress);
+							return JSON::json_to_js_value(context, exchange_batch_result(result));
+						}
+						else
+						{
+							auto result = Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Batch::encode_directory(source, destination, setting, progress);
+							return JSON::json_to_js_value(context, exchange_batch_result(result));
+						}
+					}
+					catch (Interrupt &)
+					{
+						return JS_EXCEPTION;
+					}
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RTON Decode Directory
+				 * @param argv[0]: source directory
+				 * @param argv[1]: destination directory
+				 * @param argv[2]: rijndael key and iv, null if not encrypted
+				 * @param argv[3]: progress callback, optional
+				 * @param argv[4]: worker limit, optional
+				 * @returns: processed count and the files that failed
+				 * ----------------------------------------
+				 */
+
+				inline static auto decode_directory(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSElement::Object
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						return (process_directory<true>(context, argc, argv)); }, "decode_directory"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RTON Encode Directory
+				 * @param argv[0]: source directory
+				 * @param argv[1]: destination directory
+				 * @param argv[2]: rijndael key and iv, null if not encrypted
+				 * @param argv[3]: progress callback, optional
+				 * @param argv[4]: worker limit, optional
+				 * @returns: processed count and the files that failed
+				 * ----------------------------------------
+				 */
+
+				inline static auto encode_directory(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSElement::Object
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						return (process_directory<false>(context, argc, argv)); }, "encode_directory"_sv);
+				}
 			}
 
 			/**
@@ -11681,6 +12526,91 @@ namespace Sen::Kernel::Interface::Script
 						return JS::Converter::get_undefined(); }, "unpack_cipher"_sv);
 				}
 
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Read Single Resource
+				 * @param argv[0]: source file
+				 * @param argv[1]: resource path
+				 * @param argv[2]: destination file
+				 * @returns: Extracted resource
+				 * ----------------------------------------
+				 */
+
+				inline static auto read_resource_fs(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 3, fmt::format("{} 3, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						auto resource_path = JS::Converter::get_string(context, argv[1]);
+						auto destination = JS::Converter::get_string(context, argv[2]);
+						Kernel::Support::PopCap::ResourceStreamBundle::Reader::open(source)->read_fs(resource_path, destination);
+						return JS::Converter::get_undefined(); }, "read_resource_fs"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Resource List
+				 * @param argv[0]: source file
+				 * @returns: Every resource path inside the bundle
+				 * ----------------------------------------
+				 */
+
+				inline static auto resource_list(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						return JS::Converter::to_array(context, Kernel::Support::PopCap::ResourceStreamBundle::Reader::open(source)->list()); }, "resource_list"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Close Reader
+				 * @param argv[0]: source file
+				 * @returns: The opened reader of the bundle is released
+				 * ----------------------------------------
+				 */
+
+				inline static auto close_reader(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 1, fmt::format("{} 1, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						auto source = JS::Converter::get_string(context, argv[0]);
+						Kernel::Support::PopCap::ResourceStreamBundle::Reader::close(source);
+						return JS::Converter::get_undefined(); }, "close_reader"_sv);
+				}
+
+				/**
+				 * ----------------------------------------
+				 * JavaScript RSB Clear Readers
+				 * @returns: Every opened reader is released
+				 * ----------------------------------------
+				 */
+
+				inline static auto clear_reader(
+					JSContext *context,
+					JSValueConst this_val,
+					int argc,
+					JSValueConst *argv) -> JSValue
+				{
+					M_JS_PROXY_WRAPPER(context, {
+						try_assert(argc == 0, fmt::format("{} 0, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+						Kernel::Support::PopCap::ResourceStreamBundle::Reader::clear();
+						return JS::Converter::get_undefined(); }, "clear_reader"_sv);
+				}
+
 				/**
 				 * ----------------------------------------
 				 * JavaScript RSB Unpack File
@@ -12077,6 +13007,35 @@ namespace Sen::Kernel::Interface::Script
 						}, "dump_document"_sv);
 					}
 
+					/**
+					 * ----------------------------------------
+					 * JavaScript Render Animation
+					 * @param argv[0]: animation json
+					 * @param argv[1]: media directory
+					 * @param argv[2]: destination directory
+					 * @param argv[3]: render setting
+					 * @returns: rendered dimension
+					 * ----------------------------------------
+					 */
+
+					inline static auto render(
+						JSContext *context,
+						JSValueConst this_val,
+						int argc,
+						JSValueConst *argv) -> JSElement::Object
+					{
+						M_JS_PROXY_WRAPPER(context, {
+							try_assert(argc == 4, fmt::format("{} 4, {}: {}", Kernel::Language::get("kernel.argument_expected"), Kernel::Language::get("kernel.argument_received"), argc));
+							auto animation = JSON::js_object_to_json(context, argv[0]).get<Sen::Kernel::Support::PopCap::Animation::SexyAnimation>();
+							auto media = JS::Converter::get_string(context, argv[1]);
+							auto destination = JS::Converter::get_string(context, argv[2]);
+							try_assert(JS_IsObject(argv[3]), fmt::format("{}", Kernel::Language::get("popcap.animation.miscellaneous.argument_must_be_object")));
+							auto setting = JSON::js_object_to_json(context, argv[3]).get<Sen::Kernel::Support::PopCap::Animation::Miscellaneous::RenderSetting>();
+							Sen::Kernel::Support::PopCap::Animation::Miscellaneous::Render::process(animation, media, destination, setting);
+							return JSON::json_to_js_value(context, nlohmann::ordered_json{{"width", setting.width}, {"height", setting.height}});
+						}, "render"_sv);
+					}
+
 					inline static auto generate_image(
 						JSContext *context,
 						JSValueConst this_val,
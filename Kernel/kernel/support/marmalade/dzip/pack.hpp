@@ -45,6 +45,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
             information_structure.resource_information.resize(definition.resource.size());
             auto global_chunk_index = k_begin_index;
             auto chunk_information = DataStreamView{};
+            chunk_information.spill_next_to(stream);
             for (auto resource_index : Range(definition.resource.size()))
             {
                 auto &resource_definition = definition.resource[resource_index];
@@ -174,7 +175,7 @@ namespace Sen::Kernel::Support::Marmalade::DZip
             {
                 // exchange_archive_resource_information(stream, element);
             }
-            stream.writeBytes(chunk_information.toBytes());
+            stream.append(std::move(chunk_information));
             return;
         }
 
@@ -194,8 +195,9 @@ namespace Sen::Kernel::Support::Marmalade::DZip
         {
             auto stream = DataStreamView{};
             auto definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
+            stream.spill(destination);
             process_whole(stream, definition, source);
-            stream.out_file(destination);
+            stream.commit();
             return;
         }
     };
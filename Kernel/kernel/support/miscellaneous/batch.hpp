@@ -0,0 +1,110 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+
+namespace Sen::Kernel::Support::Miscellaneous::Batch
+{
+    using namespace Definition;
+
+    // A file that could not be converted, the rest of the batch is not affected
+
+    struct Error
+    {
+        std::string source;
+
+        std::string message;
+    };
+
+    struct Result
+    {
+        std::size_t processed;
+
+        std::vector<Error> error;
+    };
+
+    struct Job
+    {
+        std::string source;
+
+        std::string destination;
+    };
+
+    /**
+     * Pair every file below source with its path below destination, the extension is swapped
+     * Jobs are sorted so errors are reported in the same order on every run
+     */
+
+    inline auto make_job_list(
+        std::string_view source,
+        std::string_view destination,
+        std::string_view source_extension,
+        std::string_view destination_extension) -> std::vector<Job>
+    {
+        auto root = Path::normalize(std::string{source.data(), source.size()});
+        auto destination_root = String::to_posix_style(std::string{destination.data(), destination.size()});
+        if (!destination_root.empty() && destination_root.back() != '/')
+        {
+            destination_root += '/';
+        }
+        auto result = std::vector<Job>{};
+        auto filter = FileSystem::DirectoryFilter{.extension = {std::string{source_extension}}};
+        FileSystem::walk_directory(source, filter, [&](std::vector<std::string> &&files)
+                                   {
+            for (auto &file : files) {
+                auto relative = String::to_posix_style(file.substr(std::min(file.size(), root.size())));
+                while (!relative.empty() && relative.front() == '/') {
+                    relative.erase(0, 1);
+                }
+                relative.resize(relative.size() - source_extension.size());
+                result.emplace_back(Job{
+                    .source = std::move(file),
+                    .destination = fmt::format("{}{}{}", destination_root, relative, destination_extension),
+                });
+            } });
+        std::sort(result.begin(), result.end(), [](const Job &lhs, const Job &rhs)
+                  { return lhs.source < rhs.source; });
+        return result;
+    }
+
+    /**
+     * Run convert on one job, whatever it throws becomes the error of the job
+     */
+
+    template <typename Convert>
+    inline auto try_convert(
+        const Job &job,
+        const Convert &convert) -> std::optional<Error>
+    {
+        try
+        {
+            convert(job);
+        }
+        catch (std::exception &e)
+        {
+            return Error{.source = job.source, .message = e.what()};
+        }
+        catch (...)
+        {
+            return Error{.source = job.source, .message = std::string{Language::get("batch.unknown_error")}};
+        }
+        return std::nullopt;
+    }
+
+    // error_list: one slot per job, in job order
+
+    inline auto make_result(
+        std::vector<std::optional<Error>> &error_list) -> Result
+    {
+        auto result = Result{.processed = 0_size};
+        for (auto &error : error_list)
+        {
+            if (error.has_value())
+            {
+                result.error.emplace_back(std::move(error.value()));
+            }
+        }
+        result.processed = error_list.size() - result.error.size();
+        return result;
+    }
+
+}
@@ -91,11 +91,11 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
                         {
                             auto encrypted_stream = DataStreamView{};
                             Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Instance::encrypt(resource_stream, encrypted_stream, packages_setting.key, packages_setting.iv);
-                            resource_data_section_view_stored[path] = std::move(encrypted_stream.toBytes());
+                            resource_data_section_view_stored[path] = encrypted_stream.release();
                         }
                         else
                         {
-                            resource_data_section_view_stored[path] = std::move(resource_stream.toBytes());
+                            resource_data_section_view_stored[path] = resource_stream.release();
                         }
                         push_definition(path);
                         --json_count;
@@ -122,7 +122,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
             assert_conditional(rton_count == k_none_size, fmt::format("{}", Language::get("popcap.rsb.project.rton_count_mismatch")), "exchange_packages");
             auto packet_stream = DataStreamView{};
             Sen::Kernel::Support::PopCap::ResourceStreamGroup::Pack::process_whole(packet_stream, packet_definition, resource_data_section_view_stored);
-            packet_data_section_view_stored[packages_string] = std::move(packet_stream.toBytes());
+            packet_data_section_view_stored[packages_string] = packet_stream.release();
             bundle.group[packages_string].subgroup[packages_string] = Sen::Kernel::Support::PopCap::ResourceStreamBundle::SubgroupInformation{
                 .compression = k_highest_compression_method,
                 .resource = packet_definition.resource};
@@ -240,7 +240,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
                 auto encode = Sen::Kernel::Support::PopCap::NewTypeObjectNotation::Encode(result);
                 encode.process();
                 auto newton_path = fmt::format("PROPERTIES\\{}.NEWTON", resources_name);
-                resource_data_section_view_stored[newton_path] = std::move(encode.sen->toBytes());
+                resource_data_section_view_stored[newton_path] = encode.sen->release();
                 packet_definition.resource.emplace_back(Resource{
                     .path = String::to_posix_style(newton_path)});
             }
@@ -249,14 +249,14 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::ResourceStreamBundle
                 auto data_stream = DataStreamView{};
                 Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Encode::process_whole(data_stream, result.dump());
                 auto rton_path = fmt::format("PROPERTIES\\{}.RTON", resources_name);
-                resource_data_section_view_stored[rton_path] = std::move(data_stream.toBytes());
+                resource_data_section_view_stored[rton_path] = data_stream.release();
                 packet_definition.resource.emplace_back(Resource{
                     .path = String::to_posix_style(rton_path)});
             }
             auto packet_stream = DataStreamView{};
             Sen::Kernel::Support::PopCap::ResourceStreamGroup::Pack::process_whole(packet_stream, packet_definition, resource_data_section_view_stored);
             auto manifest_name = toupper_back(fmt::format("__MANIFESTGROUP__{}", manifest_info.resource_additional_name));
-            packet_data_section_view_stored[manifest_name] = std::move(packet_stream.toBytes());
+            packet_data_section_view_stored[manifest_name] = packet_stream.release();
             bundle.group[manifest_name].subgroup[manifest_name] = Sen::Kernel::Support::PopCap::ResourceStreamBundle::SubgroupInformation{
                 .compression = k_highest_compression_method,
                 .resource = packet_definition.resource};
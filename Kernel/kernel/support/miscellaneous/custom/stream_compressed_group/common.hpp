@@ -1055,6 +1055,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             PacketOriginalInformation const &packet_information) -> void
         {
             auto resource_packet_view_stored = DataStreamView{};
+            resource_packet_view_stored.spill_next_to(stream);
             auto subgroup_information_list = std::vector<SubgroupInformation>{};
             for (auto &[subgroup_id, subgroup_value] : packet_information.subgroup)
             {
@@ -1100,7 +1101,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             }
             exchange_list(stream, subgroup_information_list, &exchange_from_subgroup);
             header_information.information_section_size = information_section_size;
-            stream.writeBytes(resource_packet_view_stored.toBytes());
+            stream.append(std::move(resource_packet_view_stored));
             exchange_head_information(header_information, stream);
             return;
         }
@@ -16,14 +16,20 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             std::map<std::string, SubgroupRawContent> const &subgroup_content_map,
             std::map<std::string, PacketInformation> &packet_information) -> void
         {
+            // every packet is unpacked on its own, the map entries are created first
+            auto packet_list = std::vector<std::pair<SubgroupRawContent const *, PacketInformation *>>{};
+            packet_list.reserve(subgroup_content_map.size());
             for (auto &[subgroup_id, subgroup_value] : subgroup_content_map)
             {
-                auto &packet_info = packet_information[subgroup_id];
-                packet_info.is_image = subgroup_value.is_image;
-                auto packet_stream = DataStreamView{subgroup_value.packet_data};
-                Sen::Kernel::Support::PopCap::ResourceStreamGroup::Unpack::process_whole(packet_stream, packet_info.packet_structure, packet_info.resource_data_section_view_stored);
-                packet_info.subgroup_content_information = subgroup_value.info;
+                packet_list.emplace_back(&subgroup_value, &packet_information[subgroup_id]);
             }
+            parallel_for(packet_list.size(), [&](size_t index)
+                         {
+                auto &[subgroup_value, packet_info] = packet_list[index];
+                packet_info->is_image = subgroup_value->is_image;
+                auto packet_stream = DataStreamView{subgroup_value->packet_data};
+                Sen::Kernel::Support::PopCap::ResourceStreamGroup::Unpack::process_whole(packet_stream, packet_info->packet_structure, packet_info->resource_data_section_view_stored);
+                packet_info->subgroup_content_information = subgroup_value->info; });
             return;
         }
 
@@ -81,6 +87,21 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             return;
         }
 
+        struct AtlasDecodeInfo
+        {
+            std::string const *resource_path;
+            std::vector<uint8_t> const *resource_data;
+            TexturePacketCompressedInfo const *packet_info;
+            std::string destination;
+        };
+
+        inline static auto decode_atlas(
+            AtlasDecodeInfo const &atlas,
+            TextureFormatCategory const &texture_format_category) -> Definition::Image<int>
+        {
+            return Sen::Kernel::Support::Texture::InvokeMethod::decode_whole(*atlas.resource_data, atlas.packet_info->dimension.width, atlas.packet_info->dimension.height, exchange_image_format(texture_format_category, atlas.packet_info->additional.format));
+        }
+
         inline static auto exchange_texture_simple(
             std::map<std::string, PacketInformation> &general_information,
             std::map<std::string, PacketInformation> &packet_information,
@@ -103,6 +124,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     auto image_index = k_begin_index;
                     auto image_information = SubgroupCompressedInfo{};
                     image_information.texture.resolution = packet_value.subgroup_content_information.texture.resolution;
+                    // atlases are decoded and written in parallel once the layout is known, one atlas per thread is held in memory
+                    auto atlas_list = std::vector<AtlasDecodeInfo>{};
                     for (auto &[packet_id, packet_info] : packet_value.subgroup_content_information.texture.packet)
                     {
                         auto image_id_index = exchange_image_id_index(subgroup_id, image_index);
@@ -127,14 +150,24 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                                         image_info.data[data_id].texture_info.ah = packet_info.dimension.height - texture_info.ay;
                                     }
                                 }
-                                auto image = Sen::Kernel::Support::Texture::InvokeMethod::decode_whole(resource_data, packet_info.dimension.width, packet_info.dimension.height, exchange_image_format(definition.texture_format_category, packet_info.additional.format));
-                                write_image(fmt::format("{}/{}.png", resource_destination, image_info.path), image);
-                                packet_value.resource_data_section_view_stored.erase(resource_path);
+                                atlas_list.emplace_back(AtlasDecodeInfo{
+                                    .resource_path = &resource_path,
+                                    .resource_data = &resource_data,
+                                    .packet_info = &packet_info,
+                                    .destination = fmt::format("{}/{}.png", resource_destination, image_info.path)});
                                 ++image_index;
                                 break;
                             }
                         }
                     }
+                    parallel_for(atlas_list.size(), [&](size_t index)
+                                 {
+                        auto &atlas = atlas_list[index];
+                        write_image(atlas.destination, decode_atlas(atlas, definition.texture_format_category)); });
+                    for (auto &atlas : atlas_list)
+                    {
+                        packet_value.resource_data_section_view_stored.erase(*atlas.resource_path);
+                    }
                     auto result = nlohmann::ordered_json{};
                     exchange_subgroup_compression_info(image_information, result);
                     write_json(fmt::format("{}/{}/{}.json", resource_destination, k_atlases_folder_string, subgroup_id), result); // atlases
@@ -230,6 +263,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             Sen::Kernel::Support::PopCap::Animation::Convert::ExtraInfo &extra,
             std::string const &destination) -> void
         {
+            auto media_list = std::vector<std::pair<std::string, Definition::Image<int> const *>>{};
             for (auto &[image_name, image_value] : extra.image)
             {
                 if (texture_sprite_view_stored.contains(image_value.id))
@@ -255,7 +289,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                         }
                         Sen::Kernel::Support::PopCap::Animation::Convert::Common::fix_media_image(fmt::format("{}/library/image/{}.xml", destination, image_name), image_path);
                     }
-                    write_image(fmt::format("{}/library/media/{}.png", destination, image_path), image_info.data);
+                    media_list.emplace_back(fmt::format("{}/library/media/{}.png", destination, image_path), &image_info.data);
                     extra.image[image_name].additional = image_info.additional;
                     extra.image[image_name].use_image_additional = true;
                     image_info.is_use = true;
@@ -270,6 +304,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 }
                 */
             }
+            parallel_for(media_list.size(), [&](size_t index)
+                         { write_image(media_list[index].first, *media_list[index].second); });
             return;
         }
 
@@ -294,6 +330,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     {
                         continue;
                     }
+                    // every atlas is decoded and cut on its own thread, the sprites are then merged in atlas order
+                    auto atlas_list = std::vector<AtlasDecodeInfo>{};
                     for (auto &[packet_id, packet_info] : packet_value.subgroup_content_information.texture.packet)
                     {
                         definition.category.format = packet_info.additional.format;
@@ -301,13 +339,26 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                         {
                             if (compare_string(String::to_posix_style(resource_path), fmt::format("{}.ptx", packet_info.path)))
                             {
-                                auto image = Sen::Kernel::Support::Texture::InvokeMethod::decode_whole(resource_data, packet_info.dimension.width, packet_info.dimension.height, exchange_image_format(definition.texture_format_category, packet_info.additional.format));
-                                exchange_image_split(texture_sprite_view_stored, image, subgroup_id, packet_info);
-                                packet_value.resource_data_section_view_stored.erase(resource_path);
+                                atlas_list.emplace_back(AtlasDecodeInfo{
+                                    .resource_path = &resource_path,
+                                    .resource_data = &resource_data,
+                                    .packet_info = &packet_info});
                                 break;
                             }
                         }
                     }
+                    auto sprite_list = std::vector<std::map<string, ImageSpriteInfo>>(atlas_list.size());
+                    parallel_for(atlas_list.size(), [&](size_t index)
+                                 { exchange_image_split(sprite_list[index], decode_atlas(atlas_list[index], definition.texture_format_category), subgroup_id, *atlas_list[index].packet_info); });
+                    for (auto index : Range(atlas_list.size()))
+                    {
+                        for (auto &[data_id, image_info] : sprite_list[index])
+                        {
+                            texture_sprite_view_stored.erase(data_id);
+                            texture_sprite_view_stored.emplace(data_id, std::move(image_info));
+                        }
+                        packet_value.resource_data_section_view_stored.erase(*atlas_list[index].resource_path);
+                    }
                 }
             }
             for (auto &[id, packet_value] : packet_information)
@@ -369,11 +420,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     }
                 }
             }
+            auto unused_sprite_list = std::vector<ImageSpriteInfo const *>{};
             for (auto &[image_id, image_value] : texture_sprite_view_stored)
             {
                 if (!image_value.is_use)
                 {
-                    write_image(fmt::format("{}/{}.png", resource_destination, image_value.path), image_value.data);
+                    unused_sprite_list.emplace_back(&image_value);
                     definition.subgroup[image_value.subgroup_id].resource[image_id] = ResourceInformation{
                         .type = DataType::Image, // always image
                         .path = fmt::format("{}.png", image_value.path),
@@ -385,6 +437,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     }
                 }
             }
+            parallel_for(unused_sprite_list.size(), [&](size_t index)
+                         { write_image(fmt::format("{}/{}.png", resource_destination, unused_sprite_list[index]->path), unused_sprite_list[index]->data); });
             for (auto &subgroup_id : common_subgroup_id_list)
             {
                 auto &subgroup_value = definition.subgroup[subgroup_id];
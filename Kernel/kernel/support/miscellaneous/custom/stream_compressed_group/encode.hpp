@@ -31,15 +31,21 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             std::map<std::string, PacketInformation> &packet_information,
             std::map<std::string, SubgroupRawContent> &subgroup_content_map) -> void
         {
+            // every packet is packed and compressed on its own, the map entries are created first so the layout stay in order
+            auto packet_list = std::vector<std::pair<PacketInformation *, SubgroupRawContent *>>{};
+            packet_list.reserve(packet_information.size());
             for (auto &[subgroup_id, subgroup_value] : packet_information)
             {
-                auto &subgroup_info = subgroup_content_map[subgroup_id];
-                subgroup_info.is_image = subgroup_value.is_image;
-                auto packet_stream = DataStreamView{};
-                Sen::Kernel::Support::PopCap::ResourceStreamGroup::Pack::process_whole(packet_stream, subgroup_value.packet_structure, subgroup_value.resource_data_section_view_stored);
-                subgroup_info.info = subgroup_value.subgroup_content_information;
-                subgroup_info.packet_data = std::move(packet_stream.toBytes());
+                packet_list.emplace_back(&subgroup_value, &subgroup_content_map[subgroup_id]);
             }
+            parallel_for(packet_list.size(), [&](size_t index)
+                         {
+                auto &[subgroup_value, subgroup_info] = packet_list[index];
+                subgroup_info->is_image = subgroup_value->is_image;
+                auto packet_stream = DataStreamView{};
+                Sen::Kernel::Support::PopCap::ResourceStreamGroup::Pack::process_whole(packet_stream, subgroup_value->packet_structure, subgroup_value->resource_data_section_view_stored);
+                subgroup_info->info = subgroup_value->subgroup_content_information;
+                subgroup_info->packet_data = packet_stream.release(); });
             return;
         }
 
@@ -78,13 +84,19 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             auto resolution_resize_ratio = static_cast<float>(after_resolution) / static_cast<float>(before_resolution);
             if (resolution_resize_ratio != static_cast<float>(1))
             {
+                auto sprite_list = std::vector<ImageSpriteInfo *>{};
+                sprite_list.reserve(texture_sprite_view_stored.size());
                 for (auto &[data_id, image_info] : texture_sprite_view_stored)
                 {
+                    sprite_list.emplace_back(&image_info);
+                }
+                parallel_for(sprite_list.size(), [&](size_t index)
+                             {
+                    auto &image_info = *sprite_list[index];
                     auto resized_image = Definition::Image<int>::resize(image_info.data, resolution_resize_ratio);
                     image_info.data.width = resized_image.width;
                     image_info.data.height = resized_image.height;
-                    image_info.data.set_data(resized_image.data());
-                }
+                    image_info.data.set_data(resized_image.data()); });
             }
             for (auto &[data_id, image_info] : texture_sprite_view_stored)
             {
@@ -99,6 +111,10 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 .padding = 3}; // safe padding.
             auto max_rects_packer = MaxRectsAlgorithm::MaxRectsPacker(image_width, image_height, option);
             max_rects_packer.addArray(rectangle_list);
+            // the atlas layout is written in bin order, only the composition and the texture encoding run in parallel
+            auto image_format = exchange_image_format(texture_format_category, format);
+            auto texture_data_list = std::vector<std::vector<uint8_t> *>{};
+            auto image_packet_list = std::vector<TexturePacketCompressedInfo *>{};
             for (auto i : Range(max_rects_packer.bins.size()))
             {
                 auto &max_rects_bin = max_rects_packer.bins[i];
@@ -110,11 +126,8 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 image_packet.dimension.height = max_rects_bin.height;
                 image_packet.additional.format = format;
                 image_packet.additional.index = i;
-                auto image_list = std::vector<Definition::Image<int>>{};
-                image_list.resize(max_rects_bin.rects.size());
-                for (auto i : Range(max_rects_bin.rects.size()))
+                for (auto &rect : max_rects_bin.rects)
                 {
-                    auto &rect = max_rects_bin.rects[i];
                     auto &image_info = texture_sprite_view_stored.at(rect.source);
                     image_packet.data[rect.source] = DataCompressedInfo{
                         .type = DataType::Image,
@@ -134,6 +147,20 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                             .y = image_info.additional.y,
                             .cols = image_info.additional.cols,
                             .rows = image_info.additional.rows}};
+                }
+                auto texture_path = fmt::format("atlases/{}.ptx", image_id_index);
+                texture_data_list.emplace_back(&packet_info.resource_data_section_view_stored[toupper_back(String::to_windows_style(texture_path))]);
+                image_packet_list.emplace_back(&image_packet);
+            }
+            parallel_for(max_rects_packer.bins.size(), [&](size_t index)
+                         {
+                auto &max_rects_bin = max_rects_packer.bins[index];
+                auto image_list = std::vector<Definition::Image<int>>{};
+                image_list.resize(max_rects_bin.rects.size());
+                for (auto i : Range(max_rects_bin.rects.size()))
+                {
+                    auto &rect = max_rects_bin.rects[i];
+                    auto const &image_info = texture_sprite_view_stored.at(rect.source);
                     image_list[i].x = rect.x;
                     image_list[i].y = rect.y;
                     image_list[i].width = image_info.data.width;
@@ -142,13 +169,13 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 }
                 auto atlas_image = Definition::Image<int>::transparent(Definition::Dimension{max_rects_bin.width, max_rects_bin.height});
                 Definition::Image<int>::join_extend(atlas_image, image_list);
-                auto texture_path = fmt::format("atlases/{}.ptx", image_id_index);
-                auto &texture_data = packet_info.resource_data_section_view_stored[toupper_back(String::to_windows_style(texture_path))];
-                auto image_format = exchange_image_format(texture_format_category, format);
-                texture_data = Sen::Kernel::Support::Texture::InvokeMethod::encode_whole(atlas_image, image_format);
-                exchange_image_additional(image_format, texture_data.size(), image_packet);
+                *texture_data_list[index] = Sen::Kernel::Support::Texture::InvokeMethod::encode_whole(atlas_image, image_format); });
+            for (auto i : Range(max_rects_packer.bins.size()))
+            {
+                auto &max_rects_bin = max_rects_packer.bins[i];
+                exchange_image_additional(image_format, texture_data_list[i]->size(), *image_packet_list[i]);
                 auto resource_info = Sen::Kernel::Support::PopCap::ResourceStreamGroup::Resource{
-                    .path = toupper_back(texture_path),
+                    .path = toupper_back(fmt::format("atlases/{}.ptx", exchange_image_id_index(subgroup_id, i))),
                     .use_texture_additional_instead = true,
                 };
                 resource_info.texture_additional.value.dimension = Sen::Kernel::Support::PopCap::ResourceStreamGroup::TextureDimension{
@@ -174,8 +201,23 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                 return static_cast<int>(data * k_media_scale_ratio);
             };
             */
+            // every media is read in parallel, then checked and stored in order
+            auto image_list = std::vector<std::pair<std::string const *, Sen::Kernel::Support::PopCap::Animation::Convert::ImageInfo const *>>{};
+            image_list.reserve(extra.image.size());
             for (auto &[image_name, image_value] : extra.image)
             {
+                image_list.emplace_back(&image_name, &image_value);
+            }
+            auto image_data_list = std::vector<std::optional<Definition::Image<int>>>(image_list.size());
+            parallel_for(image_list.size(), [&](size_t index)
+                         {
+                auto &[image_name, image_value] = image_list[index];
+                auto image_path = (!image_value->path.empty() ? image_value->path : *image_name);
+                image_data_list[index].emplace(ImageIO::read_png(fmt::format("{}/{}/library/media/{}.png", resource_source, path, image_path))); });
+            for (auto index : Range(image_list.size()))
+            {
+                auto &image_name = *image_list[index].first;
+                auto &image_value = *image_list[index].second;
                 auto image_path = (!image_value.path.empty() ? image_value.path : image_name);
                 /*
                 while (image_path.starts_with("../"_sv)) {
@@ -183,7 +225,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                         image_path = image_path.substr("../"_sv.size(), image_path.size() - "../"_sv.size());
                 }
                 */
-                auto image = ImageIO::read_png(fmt::format("{}/{}/library/media/{}.png", resource_source, path, image_path));
+                auto &image = *image_data_list[index];
                 if (texture_sprite_view_stored.contains(toupper_back(image_value.id)))
                 {
                     auto &before_image = texture_sprite_view_stored[toupper_back(image_value.id)];
@@ -253,7 +295,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             }
             Sen::Kernel::Support::PopCap::Animation::Encode::process_whole(stream, animation);
             data_info.path = restore_animation_path(data_info.path, resolution);
-            resource_data = std::move(stream.toBytes());
+            resource_data = stream.release();
             return;
         }
 
@@ -273,6 +315,19 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     continue;
                 }
                 auto texture_sprite_view_stored = std::map<string, ImageSpriteInfo>{};
+                // sprite images are read in parallel before the resources are walked in order
+                auto sprite_path_list = std::vector<std::string const *>{};
+                for (auto &[resource_id, resource_info] : packet_value.resource)
+                {
+                    if (resource_info.type == DataType::Image && !is_program_path(resource_info.path))
+                    {
+                        sprite_path_list.emplace_back(&resource_info.path);
+                    }
+                }
+                auto sprite_image_list = std::vector<std::optional<Definition::Image<int>>>(sprite_path_list.size());
+                parallel_for(sprite_path_list.size(), [&](size_t index)
+                             { sprite_image_list[index].emplace(ImageIO::read_png(fmt::format("{}/{}", resource_source, *sprite_path_list[index]))); });
+                auto sprite_index = k_begin_index;
                 for (auto &[resource_id, resource_info] : packet_value.resource)
                 {
                     switch (resource_info.type)
@@ -286,7 +341,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                                 .path = resource_info.path};
                             break;
                         }
-                        auto image = ImageIO::read_png(fmt::format("{}/{}", resource_source, resource_info.path));
+                        auto image = std::move(*sprite_image_list[sprite_index++]);
                         auto &image_info = texture_sprite_view_stored[toupper_back(resource_id)];
                         image_info.path = resource_info.path;
                         exchange_path(image_info.path, ".png"_sv, ""_sv);
@@ -406,16 +461,41 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                         exchange_subgroup_compression_info(*FileSystem::read_json(fmt::format("{}/{}", resource_source, resource_info.path)), image_information);
                         auto image_index = k_begin_index;
                         auto texture_sprite_view_stored = std::map<string, ImageSpriteInfo>{};
+                        // atlases are read, encoded and split in parallel, the packet layout and the sprites are then merged in order
+                        auto image_format = exchange_image_format(definition.texture_format_category, definition.category.format);
+                        auto atlas_list = std::vector<std::pair<std::string const *, TexturePacketCompressedInfo const *>>{};
                         for (auto &[image_id, image_info] : image_information.texture.packet)
                         {
-                            auto image = ImageIO::read_png(fmt::format("{}/{}.png", resource_source, image_info.path));
+                            atlas_list.emplace_back(&image_id, &image_info);
+                        }
+                        auto atlas_data_list = std::vector<std::vector<uint8_t>>(atlas_list.size());
+                        auto atlas_packet_list = std::vector<TexturePacketCompressedInfo>(atlas_list.size());
+                        auto atlas_sprite_list = std::vector<std::map<string, ImageSpriteInfo>>(atlas_list.size());
+                        parallel_for(atlas_list.size(), [&](size_t index)
+                                     {
+                            auto &[image_id, image_info] = atlas_list[index];
+                            auto image = ImageIO::read_png(fmt::format("{}/{}.png", resource_source, image_info->path));
+                            Sen::Kernel::Support::PopCap::ResourceStreamBundle::Common::compare_conditional(image.width, image_info->dimension.width, *image_id, "pvz2.scg.mismatch_image_width");
+                            Sen::Kernel::Support::PopCap::ResourceStreamBundle::Common::compare_conditional(image.height, image_info->dimension.height, *image_id, "pvz2.scg.mismatch_image_height");
+                            atlas_data_list[index] = Sen::Kernel::Support::Texture::InvokeMethod::encode_whole(image, image_format);
+                            auto &atlas_packet = atlas_packet_list[index];
+                            atlas_packet.dimension = image_info->dimension;
+                            for (auto &[data_id, data_value] : image_info->data)
+                            {
+                                atlas_packet.data[toupper_back(data_id)] = data_value;
+                                atlas_packet.data[toupper_back(data_id)].path = restore_image_path(data_value.path, highest_resolution);
+                            }
+                            if (resolution_list.size() != k_none_size)
+                            {
+                                exchange_image_split(atlas_sprite_list[index], image, subgroup_id, atlas_packet);
+                            } });
+                        for (auto atlas_index : Range(atlas_list.size()))
+                        {
+                            auto &image_info = *atlas_list[atlas_index].second;
                             auto image_id_index = exchange_image_id_index(subgroup_id_with_resolution, image_index);
-                            Sen::Kernel::Support::PopCap::ResourceStreamBundle::Common::compare_conditional(image.width, image_info.dimension.width, image_id, "pvz2.scg.mismatch_image_width");
-                            Sen::Kernel::Support::PopCap::ResourceStreamBundle::Common::compare_conditional(image.height, image_info.dimension.height, image_id, "pvz2.scg.mismatch_image_height");
                             auto texture_path = fmt::format("atlases/{}.ptx", image_id_index);
                             auto &texture_data = packet_info.resource_data_section_view_stored[toupper_back(String::to_windows_style(texture_path))];
-                            auto image_format = exchange_image_format(definition.texture_format_category, definition.category.format);
-                            texture_data = std::move(Sen::Kernel::Support::Texture::InvokeMethod::encode_whole(image, image_format));
+                            texture_data = std::move(atlas_data_list[atlas_index]);
                             auto &image_texture = packet_info.subgroup_content_information.texture;
                             image_texture.resolution = highest_resolution;
                             auto &image_packet = image_texture.packet[toupper_back(fmt::format("{}_{}", k_default_texture_packet_id, image_id_index))];
@@ -424,11 +504,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                             image_packet.additional.format = definition.category.format;
                             image_packet.additional.index = image_index;
                             exchange_image_additional(image_format, texture_data.size(), image_packet);
-                            for (auto &[data_id, data_value] : image_info.data)
-                            {
-                                image_packet.data[toupper_back(data_id)] = data_value;
-                                image_packet.data[toupper_back(data_id)].path = restore_image_path(data_value.path, highest_resolution);
-                            }
+                            image_packet.data = std::move(atlas_packet_list[atlas_index].data);
                             auto resource_info = Sen::Kernel::Support::PopCap::ResourceStreamGroup::Resource{
                                 .path = toupper_back(texture_path),
                                 .use_texture_additional_instead = true,
@@ -438,9 +514,12 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                                 .height = image_packet.dimension.height};
                             resource_info.texture_additional.value.index = static_cast<int>(image_index);
                             packet_info.packet_structure.resource.emplace_back(resource_info);
-                            if (resolution_list.size() != k_none_size)
+                            auto &atlas_sprite = atlas_sprite_list[atlas_index];
+                            while (!atlas_sprite.empty())
                             {
-                                exchange_image_split(texture_sprite_view_stored, image, subgroup_id, image_packet);
+                                auto sprite = atlas_sprite.extract(atlas_sprite.begin());
+                                texture_sprite_view_stored.erase(sprite.key());
+                                texture_sprite_view_stored.insert(std::move(sprite));
                             }
                             ++image_index;
                         }
@@ -543,7 +622,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     Sen::Kernel::Support::PopCap::ReflectionObjectNotation::Encode::process_whole(stream, FileSystem::read_file(fmt::format("{}/{}", resource_source, data_information.path)));
                     data_information.type = DataType::File;
                     exchange_path(data_information.path, ".json"_sv, ".rton"_sv);
-                    resource_data = std::move(stream.toBytes());
+                    resource_data = stream.release();
                     break;
                 }
                 case DataType::SoundBank:
@@ -555,7 +634,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     auto soundbank_definition = *FileSystem::read_json(fmt::format("{}/data.json", soundbank_source));
                     Sen::Kernel::Support::WWise::SoundBank::Encode::process_whole(stream, soundbank_definition, soundbank_source);
                     exchange_path(data_information.path, ""_sv, ".bnk"_sv);
-                    resource_data = std::move(stream.toBytes());
+                    resource_data = stream.release();
                     break;
                 }
                 case DataType::PopAnim:
@@ -569,7 +648,7 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
                     {
                         exchange_path(data_information.path, Kernel::Path::getExtension(data_information.path), ".pam"_sv);
                     }
-                    resource_data = std::move(stream.toBytes());
+                    resource_data = stream.release();
                     break;
                 }
                 default:
@@ -684,8 +763,9 @@ namespace Sen::Kernel::Support::Miscellaneous::Custom::StreamCompressedGroup
             {
                 definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
             }
+            stream.spill(destination);
             process_whole(stream, definition, source, setting);
-            stream.out_file(destination);
+            stream.commit();
             return;
         }
     };
@@ -302,65 +302,28 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
             std::string const &range_1,
             std::string const &range_2) -> size_t
         {
-            auto maximum_common_size = range_1.size() >= range_2.size() ? range_1.size() : range_2.size();
-            for (auto index : Range(maximum_common_size))
-            {
-                if (range_1[index] != range_2[index])
-                {
-                    return index;
-                }
-            }
-            return maximum_common_size;
+            auto minimum_size = range_1.size() <= range_2.size() ? range_1.size() : range_2.size();
+            return static_cast<size_t>(std::mismatch(range_1.begin(), range_1.begin() + minimum_size, range_2.begin()).first - range_1.begin());
         }
 
+        /*
+            Keys are visited in sorted order, so a key always branch out of the tree at its common prefix with the previous key.
+            It become the child of the last key whose block chain cover that depth, which is what the tree built by
+            matching every key against every later key converge to, so the output is unchanged but built in one pass.
+        */
+
         inline auto compute_ripe_size(
             std::map<std::string, Common::ResourceInformation> const &value) -> size_t
         {
-            struct WorkOption
-            {
-                size_t inherit_length;
-                bool has;
-            };
-            auto string_list = std::vector<std::string>{};
-            for (auto &element : value)
-            {
-                string_list.emplace_back(element.first);
-            }
-            auto work_option = std::vector<WorkOption>(string_list.size());
-            if (!string_list.empty())
-            {
-                work_option[0].inherit_length = k_none_size;
-                work_option[0].has = true;
-            }
             auto block_count = k_none_size;
-            for (auto index : Range(string_list.size()))
+            auto previous_key = static_cast<std::string const *>(nullptr);
+            for (auto &[element_key, element_value] : value)
             {
-                auto &element_key = string_list[index];
-                auto a_string_has_child = std::vector<bool>(element_key.size() + 1);
-                for (auto index_1 : Range(static_cast<size_t>(index + 1), string_list.size(), size_t{1}))
-                {
-                    if (!work_option[index_1].has)
-                    {
-                        auto common_size = get_common_size(element_key, string_list[index_1]);
-                        if (!a_string_has_child.at(common_size) && common_size >= work_option[index].inherit_length)
-                        {
-                            a_string_has_child[common_size] = true;
-                            work_option[index_1] = WorkOption{
-                                .inherit_length = common_size,
-                                .has = true};
-                        }
-                    }
-                }
-                auto character_index = k_none_size;
-                if (work_option[index].has)
-                {
-                    character_index += work_option[index].inherit_length;
-                    work_option[index].inherit_length = k_none_size;
-                    work_option[index].has = false;
-                }
-                block_count += element_key.size() - character_index + size_t{1};
-                auto additional_size = value.at(element_key).read_texture_additional ? Common::information_resource_texture_additional_section_size : Common::information_resource_general_additional_section_size;
+                auto inherit_length = previous_key == nullptr ? k_none_size : get_common_size(*previous_key, element_key);
+                block_count += element_key.size() - inherit_length + size_t{1};
+                auto additional_size = element_value.read_texture_additional ? Common::information_resource_texture_additional_section_size : Common::information_resource_general_additional_section_size;
                 block_count += (additional_size / k_block_size);
+                previous_key = &element_key;
             }
             return block_count * k_block_size;
         }
@@ -373,66 +336,37 @@ namespace Sen::Kernel::Support::Miscellaneous::Shared
             std::map<std::string, ResourceType> const &value,
             Exchanger const &exchanger) -> void
         {
-            struct WorkOption
-            {
-                size_t inherit_length;
-                size_t parent_offset;
-                bool has;
-            };
             auto resource_information_section_offset = stream.write_pos;
-            auto string_list = std::vector<std::string>{};
-            for (auto &element : value)
-            {
-                string_list.emplace_back(element.first);
-            }
-            auto work_option = std::vector<WorkOption>(string_list.size());
-            if (!string_list.empty())
+            // block that hold the child offset for every depth of the current key
+            auto depth_block = std::vector<size_t>{};
+            auto previous_key = static_cast<std::string const *>(nullptr);
+            for (auto &[element_key, element_value] : value)
             {
-                work_option[0] = WorkOption{
-                    .inherit_length = k_none_size,
-                    .parent_offset = k_begin_index,
-                    .has = true};
-                for (auto index : Range(string_list.size()))
+                auto character_index = k_none_size;
+                auto current_postion = stream.write_pos;
+                if (previous_key != nullptr)
                 {
-                    auto &element_key = string_list[index];
-                    auto current_string_has_child = std::vector<bool>(element_key.size() + 1);
-                    for (auto index_1 : Range(static_cast<size_t>(index + 1), string_list.size(), size_t{1}))
-                    {
-                        if (!work_option[index_1].has)
-                        {
-                            auto common_size = get_common_size(element_key, string_list[index_1]);
-                            if (!current_string_has_child.at(common_size) && common_size >= work_option[index].inherit_length)
-                            {
-                                current_string_has_child[common_size] = true;
-                                work_option[index_1] = WorkOption{
-                                    .inherit_length = common_size,
-                                    .parent_offset = (stream.write_pos / k_block_size + (common_size - work_option[index].inherit_length)),
-                                    .has = true};
-                            }
-                        }
-                    }
-                    auto character_index = k_none_size;
-                    if (work_option[index].has)
-                    {
-                        character_index += work_option[index].inherit_length;
-                        auto current_postion = stream.write_pos;
-                        auto parent_position = work_option[index].parent_offset * k_block_size;
-                        auto composite_value = stream.readUint32(parent_position) | ((current_postion - resource_information_section_offset) / k_block_size) << 8;
-                        stream.writeUint32(composite_value, parent_position);
-                        stream.write_pos = current_postion;
-                        work_option[index] = WorkOption{};
-                    }
-                    while (character_index < element_key.size())
-                    {
-                        stream.writeUint8(static_cast<uint8_t>(element_key[character_index]));
-                        stream.write_pos += 3;
-                        ++character_index;
-                    }
-                    stream.writeNull(k_block_size);
-                    exchanger(stream, value.at(element_key));
+                    character_index = get_common_size(*previous_key, element_key);
+                    auto parent_position = depth_block[character_index] * k_block_size;
+                    auto composite_value = stream.readUint32(parent_position) | ((current_postion - resource_information_section_offset) / k_block_size) << 8;
+                    stream.writeUint32(composite_value, parent_position);
+                    stream.write_pos = current_postion;
+                }
+                depth_block.resize(element_key.size() + 1);
+                for (auto depth : Range(character_index, element_key.size() + 1, size_t{1}))
+                {
+                    depth_block[depth] = current_postion / k_block_size + (depth - character_index);
+                }
+                while (character_index < element_key.size())
+                {
+                    stream.writeUint8(static_cast<uint8_t>(element_key[character_index]));
+                    stream.write_pos += 3;
+                    ++character_index;
                 }
+                stream.writeNull(k_block_size);
+                exchanger(stream, element_value);
+                previous_key = &element_key;
             }
-            // stream.write_pos = before_postion;
             return;
         }
 
@@ -0,0 +1,641 @@
+#pragma once
+
+#include "kernel/support/popcap/animation/definition.hpp"
+#include "kernel/support/popcap/animation/miscellaneous/common.hpp"
+
+namespace Sen::Kernel::Support::PopCap::Animation::Miscellaneous {
+
+	/**
+	 * Render setting, same shape as the script GenerateAnimation setting
+	 * sprite_disable: index of sprite that will not be drawn
+	 * background_color: rgba in [0, 255]
+	 * width, height: 0 mean the area is computed from every frame
+	 * scale: applied on top of every transform
+	 * x, y: offset added to every transform
+	 * frame_rate: 0 mean use the animation frame rate
+	 * loop: apng loop count, 0 mean infinity
+	*/
+
+	struct RenderSetting {
+
+		bool image_id;
+
+		std::string frame_name;
+
+		std::vector<int> sprite_disable;
+
+		std::array<int, 4> background_color;
+
+		int width;
+
+		int height;
+
+		double scale;
+
+		double x;
+
+		double y;
+
+		bool make_apng;
+
+		bool split_label;
+
+		int frame_rate;
+
+		int loop;
+
+	};
+
+	inline static auto from_json(
+		const nlohmann::ordered_json &json,
+		RenderSetting &setting
+	) -> void
+	{
+		json.at("image_id").get_to(setting.image_id);
+		json.at("frame_name").get_to(setting.frame_name);
+		json.at("sprite_disable").get_to(setting.sprite_disable);
+		json.at("background_color").get_to(setting.background_color);
+		json.at("rendering_size").at("width").get_to(setting.width);
+		json.at("rendering_size").at("height").get_to(setting.height);
+		json.at("rendering_size").at("scale").get_to(setting.scale);
+		json.at("position_additional").at("x").get_to(setting.x);
+		json.at("position_additional").at("y").get_to(setting.y);
+		json.at("apng_setting").at("make_apng").get_to(setting.make_apng);
+		json.at("apng_setting").at("split_label").get_to(setting.split_label);
+		json.at("apng_setting").at("frame_rate").get_to(setting.frame_rate);
+		json.at("apng_setting").at("loop").get_to(setting.loop);
+		return;
+	}
+
+	/**
+	 * Native PopAnim renderer
+	 * Every frame of the main sprite is composited with affine transform and color multiply,
+	 * frames are independent so they are rendered in parallel and written as png sequence,
+	 * then optionally joined as apng
+	*/
+
+	class Render {
+
+		protected:
+
+			// image layer has no sprite frame
+
+			struct VisualLayer {
+				int resource;
+				Matrix matrix;
+				Color color;
+				std::optional<std::size_t> sprite_frame;
+			};
+
+			using VisualFrame = std::map<int, VisualLayer>;
+
+			using VisualSprite = std::vector<VisualFrame>;
+
+			// premultiplied rgba in [0, 1]
+
+			struct Media {
+				int width;
+				int height;
+				AnimationSize size;
+				Matrix matrix;
+				std::vector<float> data;
+			};
+
+			struct Area {
+				double left;
+				double top;
+				double right;
+				double bottom;
+			};
+
+			inline static constexpr auto k_initial_matrix = Matrix{1.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+
+			inline static constexpr auto k_initial_color = Color{1.0, 1.0, 1.0, 1.0};
+
+			inline static auto variant_to_matrix(
+				const std::vector<double> &transform
+			) -> Matrix
+			{
+				switch (transform.size()) {
+					case 2: {
+						return Matrix{1.0, 0.0, 0.0, 1.0, transform[0], transform[1]};
+					}
+					case 3: {
+						auto cos = std::cos(transform[0]);
+						auto sin = std::sin(transform[0]);
+						return Matrix{cos, sin, -sin, cos, transform[1], transform[2]};
+					}
+					case 6: {
+						return Matrix{transform[0], transform[1], transform[2], transform[3], transform[4], transform[5]};
+					}
+					default: {
+						throw Exception(Kernel::String::format(fmt::format("{}", Language::get("popcap.animation.invalid_transform_size")), std::to_string(transform.size())), std::source_location::current(), "variant_to_matrix");
+					}
+				}
+			}
+
+			// apply source first, then change
+
+			inline static auto mix_matrix(
+				const Matrix &source,
+				const Matrix &change
+			) -> Matrix
+			{
+				return Matrix{
+					change[0] * source[0] + change[2] * source[1],
+					change[1] * source[0] + change[3] * source[1],
+					change[0] * source[2] + change[2] * source[3],
+					change[1] * source[2] + change[3] * source[3],
+					change[0] * source[4] + change[2] * source[5] + change[4],
+					change[1] * source[4] + change[3] * source[5] + change[5],
+				};
+			}
+
+			inline static auto mix_color(
+				const Color &source,
+				const Color &change
+			) -> Color
+			{
+				return Color{change[0] * source[0], change[1] * source[1], change[2] * source[2], change[3] * source[3]};
+			}
+
+			/**
+			 * Decode png into premultiplied float rgba
+			 * Only 8-bit gray, gray alpha, rgb and rgba are produced by the game tools
+			*/
+
+			inline static auto load_image(
+				std::string_view source,
+				Media &media
+			) -> void
+			{
+				auto image = Definition::ImageIO::read_png(source);
+				if (image.bit_depth != 8 || image.channels < 1 || image.channels > 4 || image.color_type == 3) {
+					throw Exception(Kernel::String::format(fmt::format("{}", Language::get("popcap.animation.miscellaneous.render.unsupported_image")), Kernel::String::to_posix_style(std::string{source})), std::source_location::current(), "load_image");
+				}
+				auto const &data = image.data();
+				auto channels = static_cast<std::size_t>(image.channels);
+				auto pixel_count = static_cast<std::size_t>(image.width) * static_cast<std::size_t>(image.height);
+				media.width = image.width;
+				media.height = image.height;
+				media.data.resize(pixel_count * 4_size);
+				for (auto i : Range<std::size_t>(pixel_count)) {
+					auto pixel = data.data() + i * channels;
+					auto red = pixel[0];
+					auto green = channels >= 3_size ? pixel[1] : pixel[0];
+					auto blue = channels >= 3_size ? pixel[2] : pixel[0];
+					auto alpha = channels == 4_size ? pixel[3] : channels == 2_size ? pixel[1] : std::uint8_t{0xFF};
+					auto a = static_cast<float>(alpha) / 255.0f;
+					media.data[i * 4_size] = static_cast<float>(red) / 255.0f * a;
+					media.data[i * 4_size + 1_size] = static_cast<float>(green) / 255.0f * a;
+					media.data[i * 4_size + 2_size] = static_cast<float>(blue) / 255.0f * a;
+					media.data[i * 4_size + 3_size] = a;
+				}
+				return;
+			}
+
+			inline static auto load_media(
+				const SexyAnimation &animation,
+				std::string_view media_source,
+				const RenderSetting &setting
+			) -> std::vector<Media>
+			{
+				auto media_list = std::vector<Media>(animation.image.size());
+				parallel_for(animation.image.size(), [&](std::size_t index) {
+					auto const &image = animation.image[index];
+					auto &media = media_list[index];
+					media.size = AnimationSize{static_cast<double>(image.dimension.width), static_cast<double>(image.dimension.height)};
+					media.matrix = variant_to_matrix(image.transform);
+					load_image(fmt::format("{}/{}.png", media_source, setting.image_id ? image.id : image.path), media);
+				});
+				return media_list;
+			}
+
+			inline static auto visualize_sprite(
+				const AnimationSprite &sprite,
+				const RenderSetting &setting
+			) -> VisualSprite
+			{
+				auto result = VisualSprite{};
+				result.reserve(sprite.frame.size());
+				auto layer_list = VisualFrame{};
+				for (auto const &frame : sprite.frame) {
+					for (auto const &remove : frame.remove) {
+						layer_list.erase(remove);
+					}
+					for (auto const &append : frame.append) {
+						if (append.sprite && std::find(setting.sprite_disable.begin(), setting.sprite_disable.end(), static_cast<int>(append.resource)) != setting.sprite_disable.end()) {
+							continue;
+						}
+						layer_list[append.index] = VisualLayer{
+							.resource = static_cast<int>(append.resource),
+							.matrix = k_initial_matrix,
+							.color = k_initial_color,
+							.sprite_frame = append.sprite ? std::optional<std::size_t>{0_size} : std::nullopt,
+						};
+					}
+					for (auto &[index, layer] : layer_list) {
+						if (layer.sprite_frame.has_value()) {
+							++layer.sprite_frame.value();
+						}
+					}
+					for (auto const &change : frame.change) {
+						auto layer = layer_list.find(change.index);
+						if (layer == layer_list.end()) {
+							continue;
+						}
+						if (layer->second.sprite_frame.has_value()) {
+							layer->second.sprite_frame = 0_size;
+						}
+						layer->second.matrix = variant_to_matrix(change.transform);
+						// all zero color is how the decoder keep a null color
+						if (!(change.color[0] == 0.0 && change.color[1] == 0.0 && change.color[2] == 0.0 && change.color[3] == 0.0)) {
+							layer->second.color = change.color;
+						}
+					}
+					result.emplace_back(layer_list);
+				}
+				return result;
+			}
+
+			/**
+			 * Walk a layer down to its images
+			 * callback: (media index, matrix from media space to canvas, color)
+			*/
+
+			template <typename Callback>
+			inline static auto for_each_image(
+				const VisualLayer &layer,
+				const std::vector<VisualSprite> &sprite_list,
+				const std::vector<Media> &media_list,
+				const RenderSetting &setting,
+				const Callback &callback
+			) -> void
+			{
+				if (layer.sprite_frame.has_value()) {
+					auto const &sprite = sprite_list[static_cast<std::size_t>(layer.resource)];
+					if (sprite.empty()) {
+						return;
+					}
+					for (auto const &[index, child] : sprite[layer.sprite_frame.value() % sprite.size()]) {
+						auto visual_layer = child;
+						visual_layer.matrix = mix_matrix(child.matrix, layer.matrix);
+						visual_layer.color = mix_color(child.color, layer.color);
+						for_each_image(visual_layer, sprite_list, media_list, setting, callback);
+					}
+				}
+				else {
+					auto const &media = media_list[static_cast<std::size_t>(layer.resource)];
+					auto matrix = mix_matrix(mix_matrix(media.matrix, layer.matrix), Matrix{setting.scale, 0.0, 0.0, setting.scale, 0.0, 0.0});
+					matrix[4] += setting.x;
+					matrix[5] += setting.y;
+					callback(media, matrix, layer.color);
+				}
+				return;
+			}
+
+			// bounding box of every transformed image corner over every frame
+
+			inline static auto exchange_area(
+				const VisualSprite &main_sprite,
+				const std::vector<VisualSprite> &sprite_list,
+				const std::vector<Media> &media_list,
+				RenderSetting &setting
+			) -> void
+			{
+				auto area = Area{
+					.left = std::numeric_limits<double>::max(),
+					.top = std::numeric_limits<double>::max(),
+					.right = std::numeric_limits<double>::lowest(),
+					.bottom = std::numeric_limits<double>::lowest(),
+				};
+				auto callback = [&](const Media &media, const Matrix &matrix, const Color &color) {
+					for (auto [x, y] : std::array<std::pair<double, double>, 4>{std::pair{0.0, 0.0}, std::pair{media.size.width, 0.0}, std::pair{0.0, media.size.height}, std::pair{media.size.width, media.size.height}}) {
+						auto canvas_x = matrix[0] * x + matrix[2] * y + matrix[4];
+						auto canvas_y = matrix[1] * x + matrix[3] * y + matrix[5];
+						area.left = std::min(area.left, canvas_x);
+						area.top = std::min(area.top, canvas_y);
+						area.right = std::max(area.right, canvas_x);
+						area.bottom = std::max(area.bottom, canvas_y);
+					}
+				};
+				for (auto const &frame : main_sprite) {
+					for (auto const &[index, layer] : frame) {
+						for_each_image(layer, sprite_list, media_list, setting, callback);
+					}
+				}
+				if (area.left > area.right) {
+					setting.width = 1;
+					setting.height = 1;
+					return;
+				}
+				setting.x -= area.left;
+				setting.y -= area.top;
+				setting.width = std::max(static_cast<int>(std::ceil(area.right - area.left)), 1);
+				setting.height = std::max(static_cast<int>(std::ceil(area.bottom - area.top)), 1);
+				return;
+			}
+
+			inline static auto fetch(
+				const Media &media,
+				int x,
+				int y,
+				std::size_t channel
+			) -> float
+			{
+				if (x < 0 || y < 0 || x >= media.width || y >= media.height) {
+					return 0.0f;
+				}
+				return media.data[(static_cast<std::size_t>(y) * static_cast<std::size_t>(media.width) + static_cast<std::size_t>(x)) * 4_size + channel];
+			}
+
+			/**
+			 * Draw one image with source over, sampled bilinearly through the inverse matrix
+			 * canvas: premultiplied rgba of width * height
+			*/
+
+			inline static auto draw_image(
+				std::vector<float> &canvas,
+				int width,
+				int height,
+				const Media &media,
+				const Matrix &matrix,
+				const Color &color
+			) -> void
+			{
+				if (media.width == 0 || media.height == 0) {
+					return;
+				}
+				// media pixel space to canvas
+				auto scale_x = media.size.width / static_cast<double>(media.width);
+				auto scale_y = media.size.height / static_cast<double>(media.height);
+				auto a = matrix[0] * scale_x;
+				auto b = matrix[1] * scale_x;
+				auto c = matrix[2] * scale_y;
+				auto d = matrix[3] * scale_y;
+				auto e = matrix[4];
+				auto f = matrix[5];
+				auto determinant = a * d - b * c;
+				if (std::abs(determinant) < 1e-12) {
+					return;
+				}
+				auto left = std::numeric_limits<double>::max();
+				auto top = std::numeric_limits<double>::max();
+				auto right = std::numeric_limits<double>::lowest();
+				auto bottom = std::numeric_limits<double>::lowest();
+				for (auto [x, y] : std::array<std::pair<double, double>, 4>{std::pair{0.0, 0.0}, std::pair{static_cast<double>(media.width), 0.0}, std::pair{0.0, static_cast<double>(media.height)}, std::pair{static_cast<double>(media.width), static_cast<double>(media.height)}}) {
+					left = std::min(left, a * x + c * y + e);
+					top = std::min(top, b * x + d * y + f);
+					right = std::max(right, a * x + c * y + e);
+					bottom = std::max(bottom, b * x + d * y + f);
+				}
+				auto begin_x = std::clamp(static_cast<int>(std::floor(left)), 0, width);
+				auto end_x = std::clamp(static_cast<int>(std::ceil(right)), 0, width);
+				auto begin_y = std::clamp(static_cast<int>(std::floor(top)), 0, height);
+				auto end_y = std::clamp(static_cast<int>(std::ceil(bottom)), 0, height);
+				auto inverse = 1.0 / determinant;
+				auto step_u = d * inverse;
+				auto step_v = -b * inverse;
+				auto red = static_cast<float>(std::clamp(color[0], 0.0, 1.0));
+				auto green = static_cast<float>(std::clamp(color[1], 0.0, 1.0));
+				auto blue = static_cast<float>(std::clamp(color[2], 0.0, 1.0));
+				auto alpha = static_cast<float>(std::clamp(color[3], 0.0, 1.0));
+				auto media_width = static_cast<double>(media.width);
+				auto media_height = static_cast<double>(media.height);
+				for (auto y = begin_y; y < end_y; ++y) {
+					auto delta_x = static_cast<double>(begin_x) + 0.5 - e;
+					auto delta_y = static_cast<double>(y) + 0.5 - f;
+					auto u = (d * delta_x - c * delta_y) * inverse;
+					auto v = (-b * delta_x + a * delta_y) * inverse;
+					for (auto x = begin_x; x < end_x; ++x, u += step_u, v += step_v) {
+						if (u <= -0.5 || v <= -0.5 || u >= media_width + 0.5 || v >= media_height + 0.5) {
+							continue;
+						}
+						auto sample_x = u - 0.5;
+						auto sample_y = v - 0.5;
+						auto x0 = static_cast<int>(std::floor(sample_x));
+						auto y0 = static_cast<int>(std::floor(sample_y));
+						auto tx = static_cast<float>(sample_x - x0);
+						auto ty = static_cast<float>(sample_y - y0);
+						auto sample = std::array<float, 4>{};
+						for (auto channel : Range<std::size_t>(4_size)) {
+							auto top_value = fetch(media, x0, y0, channel) * (1.0f - tx) + fetch(media, x0 + 1, y0, channel) * tx;
+							auto bottom_value = fetch(media, x0, y0 + 1, channel) * (1.0f - tx) + fetch(media, x0 + 1, y0 + 1, channel) * tx;
+							sample[channel] = top_value * (1.0f - ty) + bottom_value * ty;
+						}
+						auto source_alpha = sample[3] * alpha;
+						if (source_alpha <= 0.0f) {
+							continue;
+						}
+						auto pixel = canvas.data() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(width) + static_cast<std::size_t>(x)) * 4_size;
+						auto remain = 1.0f - source_alpha;
+						pixel[0] = sample[0] * red * alpha + pixel[0] * remain;
+						pixel[1] = sample[1] * green * alpha + pixel[1] * remain;
+						pixel[2] = sample[2] * blue * alpha + pixel[2] * remain;
+						pixel[3] = source_alpha + pixel[3] * remain;
+					}
+				}
+				return;
+			}
+
+			inline static auto render_frame(
+				const VisualFrame &frame,
+				const std::vector<VisualSprite> &sprite_list,
+				const std::vector<Media> &media_list,
+				const RenderSetting &setting
+			) -> std::vector<std::uint8_t>
+			{
+				auto pixel_count = static_cast<std::size_t>(setting.width) * static_cast<std::size_t>(setting.height);
+				auto canvas = std::vector<float>(pixel_count * 4_size);
+				auto background_alpha = static_cast<float>(std::clamp(setting.background_color[3], 0, 255)) / 255.0f;
+				auto background = std::array<float, 4>{
+					static_cast<float>(std::clamp(setting.background_color[0], 0, 255)) / 255.0f * background_alpha,
+					static_cast<float>(std::clamp(setting.background_color[1], 0, 255)) / 255.0f * background_alpha,
+					static_cast<float>(std::clamp(setting.background_color[2], 0, 255)) / 255.0f * background_alpha,
+					background_alpha,
+				};
+				if (background_alpha > 0.0f) {
+					for (auto i : Range<std::size_t>(pixel_count)) {
+						std::memcpy(canvas.data() + i * 4_size, background.data(), sizeof(float) * 4_size);
+					}
+				}
+				for (auto const &[index, layer] : frame) {
+					for_each_image(layer, sprite_list, media_list, setting, [&](const Media &media, const Matrix &matrix, const Color &color) {
+						draw_image(canvas, setting.width, setting.height, media, matrix, color);
+					});
+				}
+				auto result = std::vector<std::uint8_t>(pixel_count * 4_size);
+				for (auto i : Range<std::size_t>(pixel_count)) {
+					auto pixel = canvas.data() + i * 4_size;
+					auto alpha = std::clamp(pixel[3], 0.0f, 1.0f);
+					if (alpha <= 0.0f) {
+						continue;
+					}
+					for (auto channel : Range<std::size_t>(3_size)) {
+						result[i * 4_size + channel] = static_cast<std::uint8_t>(std::lround(std::clamp(pixel[channel] / alpha, 0.0f, 1.0f) * 255.0f));
+					}
+					result[i * 4_size + 3_size] = static_cast<std::uint8_t>(std::lround(alpha * 255.0f));
+				}
+				return result;
+			}
+
+			// label name to [frame_start, frame_end], 1-based like the frame file names
+
+			inline static auto exchange_label(
+				const AnimationSprite &sprite
+			) -> std::vector<std::pair<std::string, std::pair<std::size_t, std::size_t>>>
+			{
+				auto result = std::vector<std::pair<std::string, std::pair<std::size_t, std::size_t>>>{};
+				for (auto i : Range<std::size_t>(sprite.frame.size())) {
+					if (sprite.frame[i].label != "" || result.empty()) {
+						result.emplace_back(sprite.frame[i].label == "" ? std::string{"animation"} : sprite.frame[i].label, std::pair{i + 1_size, i + 1_size});
+					}
+					else {
+						++result.back().second.second;
+					}
+				}
+				return result;
+			}
+
+			inline static auto make_apng_setting(
+				const RenderSetting &setting,
+				std::size_t frame_count,
+				std::uint32_t delay
+			) -> Definition::APNGMakerSetting
+			{
+				return Definition::APNGMakerSetting{
+					std::vector<std::uint32_t>(frame_count, delay),
+					static_cast<std::uint32_t>(setting.loop),
+					static_cast<std::uint32_t>(setting.width),
+					static_cast<std::uint32_t>(setting.height),
+					false,
+				};
+			}
+
+		public:
+
+			explicit Render(
+
+			) = default;
+
+			~Render(
+
+			) = default;
+
+			auto operator=(
+				Render &&that
+			) -> Render & = delete;
+
+			Render(
+				Render &&that
+			) = delete;
+
+			/**
+			 * animation: decoded animation
+			 * media_source: directory of the animation images
+			 * destination: output directory, receive frames/, data.json and the apng
+			 * setting: render setting, width and height are updated when they are computed
+			*/
+
+			inline static auto process(
+				const SexyAnimation &animation,
+				std::string_view media_source,
+				std::string_view destination,
+				RenderSetting &setting
+			) -> void
+			{
+				if (setting.scale <= 0.0) {
+					setting.scale = 1.0;
+				}
+				auto media_list = load_media(animation, media_source, setting);
+				auto sprite_list = std::vector<VisualSprite>{};
+				sprite_list.reserve(animation.sprite.size());
+				for (auto const &sprite : animation.sprite) {
+					sprite_list.emplace_back(visualize_sprite(sprite, setting));
+				}
+				auto main_sprite = visualize_sprite(animation.main_sprite, setting);
+				if (setting.width <= 0 && setting.height <= 0) {
+					exchange_area(main_sprite, sprite_list, media_list, setting);
+				}
+				assert_conditional(setting.width > 0 && setting.height > 0, fmt::format("{}", Language::get("popcap.animation.miscellaneous.render.invalid_size")), "process");
+				auto frame_directory = fmt::format("{}/frames", destination);
+				FileSystem::create_directory(frame_directory);
+				auto frame_rate = setting.frame_rate <= 0 ? static_cast<int>(animation.frame_rate) : setting.frame_rate;
+				auto label_list = exchange_label(animation.main_sprite);
+				auto delay = static_cast<std::uint32_t>(std::lround(1000.0 / static_cast<double>(std::max(frame_rate, 1))));
+				// every frame is rendered once, then written as png and fed to the apng writers
+				auto animation_writer = std::unique_ptr<Definition::APNGMaker::Writer>{};
+				auto label_writer = std::unique_ptr<Definition::APNGMaker::Writer>{};
+				auto label_index = 0_size;
+				if (setting.make_apng && !main_sprite.empty()) {
+					if (setting.split_label) {
+						FileSystem::create_directory(fmt::format("{}/label", destination));
+					}
+					animation_writer = std::make_unique<Definition::APNGMaker::Writer>(fmt::format("{}/animation.apng", destination), main_sprite.size(), make_apng_setting(setting, main_sprite.size(), delay));
+				}
+				auto window = ThreadPool::hardware_concurrency();
+				for (auto begin = 0_size; begin < main_sprite.size(); begin += window) {
+					auto count = std::min(window, main_sprite.size() - begin);
+					auto frame_list = std::vector<std::vector<std::uint8_t>>(count);
+					parallel_for(count, [&](std::size_t index) {
+						frame_list[index] = render_frame(main_sprite[begin + index], sprite_list, media_list, setting);
+						Definition::ImageIO::write_png(fmt::format("{}/{}_{}.png", frame_directory, setting.frame_name, begin + index + 1_size), Definition::Image<int>{0, 0, setting.width, setting.height, frame_list[index]});
+					});
+					if (animation_writer == nullptr) {
+						continue;
+					}
+					animation_writer->append(frame_list);
+					if (!setting.split_label) {
+						continue;
+					}
+					// labels cover every frame in order, a window may end several of them
+					for (auto offset = 0_size; offset < count;) {
+						auto const &[label_name, range] = label_list[label_index];
+						if (label_writer == nullptr) {
+							auto label_frame_count = range.second - range.first + 1_size;
+							label_writer = std::make_unique<Definition::APNGMaker::Writer>(fmt::format("{}/label/{}.apng", destination, label_name), label_frame_count, make_apng_setting(setting, label_frame_count, delay));
+						}
+						auto length = std::min(count - offset, range.second - (begin + offset));
+						label_writer->append(std::span<const std::vector<std::uint8_t>>{frame_list}.subspan(offset, length));
+						offset += length;
+						if (begin + offset == range.second) {
+							label_writer->commit();
+							label_writer.reset();
+							++label_index;
+						}
+					}
+				}
+				if (animation_writer != nullptr) {
+					animation_writer->commit();
+				}
+				auto definition = nlohmann::ordered_json{
+					{"frame_rate", frame_rate},
+					{"frame_name", setting.frame_name},
+					{"dimension", nlohmann::ordered_json{{"width", setting.width}, {"height", setting.height}}},
+					{"label", nlohmann::ordered_json::object()},
+				};
+				for (auto const &[label_name, range] : label_list) {
+					definition["label"][label_name] = nlohmann::ordered_json{{"frame_start", range.first}, {"frame_end", range.second}};
+				}
+				FileSystem::write_json(fmt::format("{}/data.json", destination), definition);
+				return;
+			}
+
+			/**
+			 * source: decoded animation json
+			*/
+
+			inline static auto process_fs(
+				std::string_view source,
+				std::string_view media_source,
+				std::string_view destination,
+				RenderSetting &setting
+			) -> void
+			{
+				auto animation = FileSystem::read_json(source)->get<SexyAnimation>();
+				process(animation, media_source, destination, setting);
+				return;
+			}
+	};
+
+}
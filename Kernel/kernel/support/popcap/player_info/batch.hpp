@@ -0,0 +1,70 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/miscellaneous/batch.hpp"
+#include "kernel/support/popcap/player_info/decode.hpp"
+#include "kernel/support/popcap/player_info/encode.hpp"
+
+namespace Sen::Kernel::Support::PopCap::PlayerInfo
+{
+    using namespace Definition;
+
+    using BatchError = Sen::Kernel::Support::Miscellaneous::Batch::Error;
+
+    using BatchResult = Sen::Kernel::Support::Miscellaneous::Batch::Result;
+
+    /**
+     * Convert every profile of a directory tree in parallel
+     * The profile version is thread local, so workers never see each other's version
+     */
+
+    struct Batch
+    {
+    protected:
+        using Job = Sen::Kernel::Support::Miscellaneous::Batch::Job;
+
+        template <typename Convert>
+        inline static auto process(
+            std::vector<Job> const &job_list,
+            std::size_t limit,
+            const Convert &convert) -> BatchResult
+        {
+            auto error_list = std::vector<std::optional<BatchError>>(job_list.size());
+            parallel_for(job_list.size(), [&](std::size_t index)
+                         { error_list[index] = Sen::Kernel::Support::Miscellaneous::Batch::try_convert(job_list[index], convert); }, limit);
+            return Sen::Kernel::Support::Miscellaneous::Batch::make_result(error_list);
+        }
+
+    public:
+        /**
+         * source: directory of profiles, every .dat file is decoded
+         * destination: directory receiving the json files, the tree is mirrored
+         * limit: maximum worker count
+         */
+
+        inline static auto decode_directory(
+            std::string_view source,
+            std::string_view destination,
+            std::size_t limit) -> BatchResult
+        {
+            return process(Sen::Kernel::Support::Miscellaneous::Batch::make_job_list(source, destination, ".dat"_sv, ".json"_sv), limit, [](Job const &job)
+                           { Decode::process_fs(job.source, job.destination); });
+        }
+
+        /**
+         * source: directory of json profiles
+         * destination: directory receiving the .dat files, the tree is mirrored
+         * limit: maximum worker count
+         */
+
+        inline static auto encode_directory(
+            std::string_view source,
+            std::string_view destination,
+            std::size_t limit) -> BatchResult
+        {
+            return process(Sen::Kernel::Support::Miscellaneous::Batch::make_job_list(source, destination, ".json"_sv, ".dat"_sv), limit, [](Job const &job)
+                           { Encode::process_fs(job.source, job.destination); });
+        }
+    };
+
+}
@@ -1,11 +1,502 @@
 #pragma once
 
 #include "kernel/definition/utility.hpp"
+#include "kernel/support/miscellaneous/shared.hpp"
+#include "kernel/support/popcap/player_info/definition.hpp"
+#include "kernel/support/popcap/player_info/layout.hpp"
 
 namespace Sen::Kernel::Support::PopCap::PlayerInfo
 {
     using namespace Definition;
 
+    using namespace Sen::Kernel::Support::Miscellaneous::Shared;
+
+    // position of each game mode in the challenge record list, version 11 to 29 share one order
+
+    inline constexpr auto k_game_mode_index_10 = std::array<std::pair<std::uint8_t, GameMode>, 70>{
+        std::pair(0, GameMode::adventure),
+        std::pair(1, GameMode::survival_normal_stage_1),
+        std::pair(2, GameMode::survival_normal_stage_2),
+        std::pair(3, GameMode::survival_normal_stage_3),
+        std::pair(4, GameMode::survival_normal_stage_4),
+        std::pair(5, GameMode::survival_normal_stage_5),
+        std::pair(6, GameMode::survival_hard_stage_1),
+        std::pair(7, GameMode::survival_hard_stage_2),
+        std::pair(8, GameMode::survival_hard_stage_3),
+        std::pair(9, GameMode::survival_hard_stage_4),
+        std::pair(10, GameMode::survival_hard_stage_5),
+        std::pair(11, GameMode::survival_endless_stage_1),
+        std::pair(12, GameMode::survival_endless_stage_2),
+        std::pair(13, GameMode::survival_endless_stage_3),
+        std::pair(14, GameMode::survival_endless_stage_4),
+        std::pair(15, GameMode::survival_endless_stage_5),
+        std::pair(16, GameMode::challenge_war_and_peas),
+        std::pair(17, GameMode::challenge_beghouled),
+        std::pair(18, GameMode::challenge_slot_machine),
+        std::pair(19, GameMode::challenge_raining_seeds),
+        std::pair(20, GameMode::challenge_wallnut_bowling),
+        std::pair(21, GameMode::challenge_invisighoul),
+        std::pair(22, GameMode::challenge_seeing_stars),
+        std::pair(23, GameMode::challenge_zombiquarium),
+        std::pair(24, GameMode::challenge_beghouled_twist),
+        std::pair(25, GameMode::challenge_little_trouble),
+        std::pair(26, GameMode::challenge_portal_combat),
+        std::pair(27, GameMode::challenge_column),
+        std::pair(28, GameMode::challenge_bobsled_bonanza),
+        std::pair(29, GameMode::challenge_speed),
+        std::pair(30, GameMode::challenge_whack_a_zombie),
+        std::pair(31, GameMode::challenge_pogo_party),
+        std::pair(32, GameMode::challenge_war_and_peas_2),
+        std::pair(33, GameMode::challenge_wallnut_bowling_2),
+        std::pair(34, GameMode::challenge_last_stand),
+        std::pair(35, GameMode::challenge_final_boss),
+        std::pair(36, GameMode::challenge_art_challenge_wallnut),
+        std::pair(37, GameMode::challenge_sunny_day),
+        std::pair(38, GameMode::challenge_resodded),
+        std::pair(39, GameMode::challenge_big_time),
+        std::pair(40, GameMode::challenge_art_challenge_sunflower),
+        std::pair(41, GameMode::challenge_air_raid),
+        std::pair(42, GameMode::challenge_ice),
+        std::pair(43, GameMode::challenge_zen_garden),
+        std::pair(44, GameMode::challenge_high_gravity),
+        std::pair(45, GameMode::challenge_grave_danger),
+        std::pair(46, GameMode::challenge_shovel),
+        std::pair(47, GameMode::challenge_stormy_night),
+        std::pair(48, GameMode::challenge_bungee_blitz),
+        std::pair(49, GameMode::challenge_squirrel),
+        std::pair(50, GameMode::scary_potter_1),
+        std::pair(51, GameMode::scary_potter_2),
+        std::pair(52, GameMode::scary_potter_3),
+        std::pair(53, GameMode::scary_potter_4),
+        std::pair(54, GameMode::scary_potter_5),
+        std::pair(55, GameMode::scary_potter_6),
+        std::pair(56, GameMode::scary_potter_7),
+        std::pair(57, GameMode::scary_potter_8),
+        std::pair(58, GameMode::scary_potter_9),
+        std::pair(59, GameMode::scary_potter_endless),
+        std::pair(60, GameMode::puzzle_i_zombie_1),
+        std::pair(61, GameMode::puzzle_i_zombie_2),
+        std::pair(62, GameMode::puzzle_i_zombie_3),
+        std::pair(63, GameMode::puzzle_i_zombie_4),
+        std::pair(64, GameMode::puzzle_i_zombie_5),
+        std::pair(65, GameMode::puzzle_i_zombie_6),
+        std::pair(66, GameMode::puzzle_i_zombie_7),
+        std::pair(67, GameMode::puzzle_i_zombie_8),
+        std::pair(68, GameMode::puzzle_i_zombie_9),
+        std::pair(69, GameMode::puzzle_i_zombie_endless)};
+
+    inline constexpr auto k_game_mode_index_11 = std::array<std::pair<std::uint8_t, GameMode>, 72>{
+        std::pair(0, GameMode::survival_normal_stage_1),
+        std::pair(1, GameMode::survival_normal_stage_2),
+        std::pair(2, GameMode::survival_normal_stage_3),
+        std::pair(3, GameMode::survival_normal_stage_4),
+        std::pair(4, GameMode::survival_normal_stage_5),
+        std::pair(5, GameMode::survival_hard_stage_1),
+        std::pair(6, GameMode::survival_hard_stage_2),
+        std::pair(7, GameMode::survival_hard_stage_3),
+        std::pair(8, GameMode::survival_hard_stage_4),
+        std::pair(9, GameMode::survival_hard_stage_5),
+        std::pair(10, GameMode::survival_endless_stage_1),
+        std::pair(11, GameMode::survival_endless_stage_2),
+        std::pair(12, GameMode::survival_endless_stage_3),
+        std::pair(13, GameMode::survival_endless_stage_4),
+        std::pair(14, GameMode::survival_endless_stage_5),
+        std::pair(15, GameMode::challenge_war_and_peas),
+        std::pair(16, GameMode::challenge_wallnut_bowling),
+        std::pair(17, GameMode::challenge_slot_machine),
+        std::pair(18, GameMode::challenge_raining_seeds),
+        std::pair(19, GameMode::challenge_beghouled),
+        std::pair(20, GameMode::challenge_invisighoul),
+        std::pair(21, GameMode::challenge_seeing_stars),
+        std::pair(22, GameMode::challenge_zombiquarium),
+        std::pair(23, GameMode::challenge_beghouled_twist),
+        std::pair(24, GameMode::challenge_little_trouble),
+        std::pair(25, GameMode::challenge_portal_combat),
+        std::pair(26, GameMode::challenge_column),
+        std::pair(27, GameMode::challenge_bobsled_bonanza),
+        std::pair(28, GameMode::challenge_speed),
+        std::pair(29, GameMode::challenge_whack_a_zombie),
+        std::pair(30, GameMode::challenge_last_stand),
+        std::pair(31, GameMode::challenge_war_and_peas_2),
+        std::pair(32, GameMode::challenge_wallnut_bowling_2),
+        std::pair(33, GameMode::challenge_pogo_party),
+        std::pair(34, GameMode::challenge_final_boss),
+        std::pair(35, GameMode::challenge_art_challenge_wallnut),
+        std::pair(36, GameMode::challenge_sunny_day),
+        std::pair(37, GameMode::challenge_resodded),
+        std::pair(38, GameMode::challenge_big_time),
+        std::pair(39, GameMode::challenge_art_challenge_sunflower),
+        std::pair(40, GameMode::challenge_air_raid),
+        std::pair(41, GameMode::challenge_ice),
+        std::pair(42, GameMode::challenge_zen_garden),
+        std::pair(43, GameMode::challenge_high_gravity),
+        std::pair(44, GameMode::challenge_grave_danger),
+        std::pair(45, GameMode::challenge_shovel),
+        std::pair(46, GameMode::challenge_stormy_night),
+        std::pair(47, GameMode::challenge_bungee_blitz),
+        std::pair(48, GameMode::challenge_squirrel),
+        std::pair(49, GameMode::tree_of_wisdom),
+        std::pair(50, GameMode::scary_potter_1),
+        std::pair(51, GameMode::scary_potter_2),
+        std::pair(52, GameMode::scary_potter_3),
+        std::pair(53, GameMode::scary_potter_4),
+        std::pair(54, GameMode::scary_potter_5),
+        std::pair(55, GameMode::scary_potter_6),
+        std::pair(56, GameMode::scary_potter_7),
+        std::pair(57, GameMode::scary_potter_8),
+        std::pair(58, GameMode::scary_potter_9),
+        std::pair(59, GameMode::scary_potter_endless),
+        std::pair(60, GameMode::puzzle_i_zombie_1),
+        std::pair(61, GameMode::puzzle_i_zombie_2),
+        std::pair(62, GameMode::puzzle_i_zombie_3),
+        std::pair(63, GameMode::puzzle_i_zombie_4),
+        std::pair(64, GameMode::puzzle_i_zombie_5),
+        std::pair(65, GameMode::puzzle_i_zombie_6),
+        std::pair(66, GameMode::puzzle_i_zombie_7),
+        std::pair(67, GameMode::puzzle_i_zombie_8),
+        std::pair(68, GameMode::puzzle_i_zombie_9),
+        std::pair(69, GameMode::puzzle_i_zombie_endless),
+        std::pair(70, GameMode::upsell),
+        std::pair(71, GameMode::intro)};
+
+    inline constexpr auto k_game_mode_index_30 = std::array<std::pair<std::uint8_t, GameMode>, 81>{
+        std::pair(0, GameMode::survival_normal_stage_1),
+        std::pair(1, GameMode::survival_normal_stage_2),
+        std::pair(2, GameMode::survival_normal_stage_3),
+        std::pair(3, GameMode::survival_normal_stage_4),
+        std::pair(4, GameMode::survival_normal_stage_5),
+        std::pair(5, GameMode::survival_hard_stage_1),
+        std::pair(6, GameMode::survival_hard_stage_2),
+        std::pair(7, GameMode::survival_hard_stage_3),
+        std::pair(8, GameMode::survival_hard_stage_4),
+        std::pair(9, GameMode::survival_hard_stage_5),
+        std::pair(10, GameMode::survival_endless_stage_1),
+        std::pair(11, GameMode::survival_endless_stage_2),
+        std::pair(12, GameMode::survival_endless_stage_3),
+        std::pair(13, GameMode::survival_endless_stage_4),
+        std::pair(14, GameMode::survival_endless_stage_5),
+        std::pair(15, GameMode::challenge_war_and_peas),
+        std::pair(16, GameMode::challenge_wallnut_bowling),
+        std::pair(17, GameMode::challenge_slot_machine),
+        std::pair(18, GameMode::challenge_raining_seeds),
+        std::pair(19, GameMode::challenge_beghouled),
+        std::pair(20, GameMode::challenge_invisighoul),
+        std::pair(21, GameMode::challenge_seeing_stars),
+        std::pair(22, GameMode::challenge_zombiquarium),
+        std::pair(23, GameMode::challenge_beghouled_twist),
+        std::pair(24, GameMode::challenge_little_trouble),
+        std::pair(25, GameMode::challenge_portal_combat),
+        std::pair(26, GameMode::challenge_column),
+        std::pair(27, GameMode::challenge_bobsled_bonanza),
+        std::pair(28, GameMode::challenge_speed),
+        std::pair(29, GameMode::challenge_whack_a_zombie),
+        std::pair(30, GameMode::challenge_last_stand),
+        std::pair(31, GameMode::challenge_war_and_peas_2),
+        std::pair(32, GameMode::challenge_wallnut_bowling_2),
+        std::pair(33, GameMode::challenge_pogo_party),
+        std::pair(34, GameMode::challenge_final_boss),
+        std::pair(35, GameMode::challenge_art_challenge_wallnut),
+        std::pair(36, GameMode::challenge_sunny_day),
+        std::pair(37, GameMode::challenge_resodded),
+        std::pair(38, GameMode::challenge_big_time),
+        std::pair(39, GameMode::challenge_art_challenge_sunflower),
+        std::pair(40, GameMode::challenge_air_raid),
+        std::pair(41, GameMode::challenge_ice),
+        std::pair(42, GameMode::challenge_zen_garden),
+        std::pair(43, GameMode::challenge_high_gravity),
+        std::pair(44, GameMode::challenge_grave_danger),
+        std::pair(45, GameMode::challenge_shovel),
+        std::pair(46, GameMode::challenge_stormy_night),
+        std::pair(47, GameMode::challenge_bungee_blitz),
+        std::pair(48, GameMode::challenge_squirrel),
+        std::pair(49, GameMode::scary_potter_1),
+        std::pair(50, GameMode::scary_potter_2),
+        std::pair(51, GameMode::scary_potter_3),
+        std::pair(52, GameMode::scary_potter_4),
+        std::pair(53, GameMode::scary_potter_5),
+        std::pair(54, GameMode::scary_potter_6),
+        std::pair(55, GameMode::scary_potter_7),
+        std::pair(56, GameMode::scary_potter_8),
+        std::pair(57, GameMode::scary_potter_9),
+        std::pair(58, GameMode::scary_potter_endless),
+        std::pair(59, GameMode::puzzle_i_zombie_1),
+        std::pair(60, GameMode::puzzle_i_zombie_2),
+        std::pair(61, GameMode::puzzle_i_zombie_3),
+        std::pair(62, GameMode::puzzle_i_zombie_4),
+        std::pair(63, GameMode::puzzle_i_zombie_5),
+        std::pair(64, GameMode::puzzle_i_zombie_6),
+        std::pair(65, GameMode::puzzle_i_zombie_7),
+        std::pair(66, GameMode::puzzle_i_zombie_8),
+        std::pair(67, GameMode::puzzle_i_zombie_9),
+        std::pair(68, GameMode::puzzle_i_zombie_endless),
+        std::pair(121, GameMode::last_stand_stage_1),
+        std::pair(122, GameMode::last_stand_stage_2),
+        std::pair(123, GameMode::last_stand_stage_3),
+        std::pair(124, GameMode::last_stand_stage_4),
+        std::pair(125, GameMode::last_stand_stage_5),
+        std::pair(126, GameMode::last_stand_endless),
+        std::pair(139, GameMode::unknown),
+        std::pair(195, GameMode::unknown),
+        std::pair(196, GameMode::unknown),
+        std::pair(197, GameMode::unknown),
+        std::pair(198, GameMode::unknown),
+        std::pair(199, GameMode::unknown)};
+
+    template <>
+    struct KeyTable<GameMode>
+    {
+        inline static constexpr auto value = std::array{
+            KeyLayout<GameMode>{until(11), 101_size, 70_size, k_game_mode_index_10},
+            KeyLayout<GameMode>{between(11, 13), 100_size, 72_size, k_game_mode_index_11},
+            KeyLayout<GameMode>{between(13, 30), 200_size, 72_size, k_game_mode_index_11},
+            KeyLayout<GameMode>{since(30), 200_size, 200_size, k_game_mode_index_30}};
+    };
+
+    // position of each store item in the purchase list
+
+    inline constexpr auto k_store_item_index_10 = std::array<std::pair<std::uint8_t, StoreItem>, 27>{
+        std::pair(0, StoreItem::plant_gatlingpea),
+        std::pair(1, StoreItem::plant_twinsunflower),
+        std::pair(2, StoreItem::plant_gloomshroom),
+        std::pair(3, StoreItem::plant_cattail),
+        std::pair(4, StoreItem::plant_wintermelon),
+        std::pair(5, StoreItem::plant_gold_magnet),
+        std::pair(6, StoreItem::plant_spikerock),
+        std::pair(7, StoreItem::plant_cobcannon),
+        std::pair(8, StoreItem::plant_imitater),
+        std::pair(9, StoreItem::bonus_lawn_mower),
+        std::pair(10, StoreItem::potted_marigold_1),
+        std::pair(11, StoreItem::potted_marigold_2),
+        std::pair(12, StoreItem::potted_marigold_3),
+        std::pair(13, StoreItem::gold_wateringcan),
+        std::pair(14, StoreItem::fertilizer),
+        std::pair(15, StoreItem::bug_spray),
+        std::pair(16, StoreItem::phonograph),
+        std::pair(17, StoreItem::gardening_glove),
+        std::pair(18, StoreItem::mushroom_garden),
+        std::pair(19, StoreItem::wheel_barrow),
+        std::pair(20, StoreItem::stinky_the_snail),
+        std::pair(21, StoreItem::packet_upgrade),
+        std::pair(22, StoreItem::pool_cleaner),
+        std::pair(23, StoreItem::roof_cleaner),
+        std::pair(24, StoreItem::rake),
+        std::pair(25, StoreItem::aquarium_garden),
+        std::pair(26, StoreItem::chocolate)};
+
+    inline constexpr auto k_store_item_index_11 = std::array<std::pair<std::uint8_t, StoreItem>, 31>{
+        std::pair(0, StoreItem::plant_gatlingpea),
+        std::pair(1, StoreItem::plant_twinsunflower),
+        std::pair(2, StoreItem::plant_gloomshroom),
+        std::pair(3, StoreItem::plant_cattail),
+        std::pair(4, StoreItem::plant_wintermelon),
+        std::pair(5, StoreItem::plant_gold_magnet),
+        std::pair(6, StoreItem::plant_spikerock),
+        std::pair(7, StoreItem::plant_cobcannon),
+        std::pair(8, StoreItem::plant_imitater),
+        std::pair(9, StoreItem::bonus_lawn_mower),
+        std::pair(10, StoreItem::potted_marigold_1),
+        std::pair(11, StoreItem::potted_marigold_2),
+        std::pair(12, StoreItem::potted_marigold_3),
+        std::pair(13, StoreItem::gold_wateringcan),
+        std::pair(14, StoreItem::fertilizer),
+        std::pair(15, StoreItem::bug_spray),
+        std::pair(16, StoreItem::phonograph),
+        std::pair(17, StoreItem::gardening_glove),
+        std::pair(18, StoreItem::mushroom_garden),
+        std::pair(19, StoreItem::wheel_barrow),
+        std::pair(20, StoreItem::stinky_the_snail),
+        std::pair(21, StoreItem::packet_upgrade),
+        std::pair(22, StoreItem::pool_cleaner),
+        std::pair(23, StoreItem::roof_cleaner),
+        std::pair(24, StoreItem::rake),
+        std::pair(25, StoreItem::aquarium_garden),
+        std::pair(26, StoreItem::chocolate),
+        std::pair(27, StoreItem::tree_of_wisdom),
+        std::pair(28, StoreItem::tree_food),
+        std::pair(29, StoreItem::firstaid),
+        std::pair(30, StoreItem::pvz)};
+
+    inline constexpr auto k_store_item_index_13 = std::array<std::pair<std::uint8_t, StoreItem>, 15>{
+        std::pair(0, StoreItem::plant_gatlingpea),
+        std::pair(1, StoreItem::plant_twinsunflower),
+        std::pair(2, StoreItem::plant_gloomshroom),
+        std::pair(3, StoreItem::plant_cattail),
+        std::pair(4, StoreItem::plant_wintermelon),
+        std::pair(5, StoreItem::plant_gold_magnet),
+        std::pair(6, StoreItem::plant_spikerock),
+        std::pair(7, StoreItem::plant_cobcannon),
+        std::pair(8, StoreItem::plant_imitater),
+        std::pair(13, StoreItem::packet_upgrade),
+        std::pair(14, StoreItem::pool_cleaner),
+        std::pair(15, StoreItem::roof_cleaner),
+        std::pair(16, StoreItem::rake),
+        std::pair(17, StoreItem::firstaid),
+        std::pair(18, StoreItem::pvz)};
+
+    inline constexpr auto k_store_item_index_30 = std::array<std::pair<std::uint8_t, StoreItem>, 44>{
+        std::pair(0, StoreItem::plant_gatlingpea),
+        std::pair(1, StoreItem::plant_twinsunflower),
+        std::pair(2, StoreItem::plant_gloomshroom),
+        std::pair(3, StoreItem::plant_cattail),
+        std::pair(4, StoreItem::plant_wintermelon),
+        std::pair(5, StoreItem::plant_gold_magnet),
+        std::pair(6, StoreItem::plant_spikerock),
+        std::pair(7, StoreItem::plant_cobcannon),
+        std::pair(8, StoreItem::plant_imitater),
+        std::pair(9, StoreItem::bonus_lawn_mower),
+        std::pair(10, StoreItem::potted_marigold_1),
+        std::pair(11, StoreItem::potted_marigold_2),
+        std::pair(12, StoreItem::potted_marigold_3),
+        std::pair(13, StoreItem::packet_upgrade),
+        std::pair(14, StoreItem::pool_cleaner),
+        std::pair(15, StoreItem::roof_cleaner),
+        std::pair(16, StoreItem::rake),
+        std::pair(17, StoreItem::firstaid),
+        std::pair(18, StoreItem::gold_wateringcan),
+        std::pair(19, StoreItem::fertilizer),
+        std::pair(20, StoreItem::bug_spray),
+        std::pair(21, StoreItem::phonograph),
+        std::pair(22, StoreItem::gardening_glove),
+        std::pair(23, StoreItem::mushroom_garden),
+        std::pair(24, StoreItem::wheel_barrow),
+        std::pair(25, StoreItem::stinky_the_snail),
+        std::pair(26, StoreItem::aquarium_garden),
+        std::pair(27, StoreItem::chocolate),
+        std::pair(28, StoreItem::basic_giftbox),
+        std::pair(29, StoreItem::zombotany),
+        std::pair(30, StoreItem::minigame_pack_1),
+        std::pair(31, StoreItem::minigame_pack_2),
+        std::pair(32, StoreItem::minigame_pack_3),
+        std::pair(33, StoreItem::minigame_pack_4),
+        std::pair(34, StoreItem::minigame_pack_5),
+        std::pair(35, StoreItem::i_zombie_pack),
+        std::pair(36, StoreItem::scary_potter_pack),
+        std::pair(37, StoreItem::bronze_giftbox),
+        std::pair(38, StoreItem::silver_giftbox),
+        std::pair(39, StoreItem::gold_giftbox),
+        std::pair(40, StoreItem::bacon),
+        std::pair(41, StoreItem::gold_giftbox),
+        std::pair(42, StoreItem::last_stand_pack),
+        std::pair(43, StoreItem::hammer)};
+
+    template <>
+    struct KeyTable<StoreItem>
+    {
+        inline static constexpr auto value = std::array{
+            KeyLayout<StoreItem>{until(11), 80_size, 27_size, k_store_item_index_10},
+            KeyLayout<StoreItem>{between(11, 13), 80_size, 31_size, k_store_item_index_11},
+            KeyLayout<StoreItem>{between(13, 30), 102_size, 19_size, k_store_item_index_13},
+            KeyLayout<StoreItem>{since(30), 80_size, 44_size, k_store_item_index_30}};
+    };
+
+    // position of each achievement in the earned and shown lists, profiles older than 12 do not store them
+
+    inline constexpr auto k_achievement_index_12 = std::array<std::pair<std::uint8_t, AchievementId>, 20>{
+        std::pair(0, AchievementId::home_security),
+        std::pair(1, AchievementId::nobel_peas_prize),
+        std::pair(2, AchievementId::better_off_dead),
+        std::pair(3, AchievementId::china_shop),
+        std::pair(4, AchievementId::spudow),
+        std::pair(5, AchievementId::explodonator),
+        std::pair(6, AchievementId::morticulturalist),
+        std::pair(7, AchievementId::dont_pea),
+        std::pair(8, AchievementId::roll_some_heads),
+        std::pair(9, AchievementId::grounded),
+        std::pair(10, AchievementId::zombologist),
+        std::pair(11, AchievementId::penny_pincher),
+        std::pair(12, AchievementId::sunny_days),
+        std::pair(13, AchievementId::popcorn_party),
+        std::pair(14, AchievementId::good_morning),
+        std::pair(15, AchievementId::no_fungus_amongus),
+        std::pair(16, AchievementId::beyond_the_grave),
+        std::pair(17, AchievementId::immortal),
+        std::pair(18, AchievementId::towering_wisdom),
+        std::pair(19, AchievementId::mustache_mode)};
+
+    inline constexpr auto k_achievement_index_13 = std::array<std::pair<std::uint8_t, AchievementId>, 25>{
+        std::pair(0, AchievementId::home_security),
+        std::pair(1, AchievementId::spudow),
+        std::pair(2, AchievementId::explodonator),
+        std::pair(3, AchievementId::morticulturalist),
+        std::pair(4, AchievementId::dont_pea),
+        std::pair(5, AchievementId::roll_some_heads),
+        std::pair(6, AchievementId::grounded),
+        std::pair(7, AchievementId::zombologist),
+        std::pair(8, AchievementId::penny_pincher),
+        std::pair(9, AchievementId::sunny_days),
+        std::pair(10, AchievementId::popcorn_party),
+        std::pair(11, AchievementId::good_morning),
+        std::pair(12, AchievementId::no_fungus_amongus),
+        std::pair(13, AchievementId::last_mown_stading),
+        std::pair(14, AchievementId::below_zero),
+        std::pair(15, AchievementId::flower_power),
+        std::pair(16, AchievementId::pyromaniac),
+        std::pair(17, AchievementId::lawn_mowner_man),
+        std::pair(18, AchievementId::chill_out),
+        std::pair(19, AchievementId::defcorn_five),
+        std::pair(20, AchievementId::monster_mash),
+        std::pair(21, AchievementId::blind_faith),
+        std::pair(22, AchievementId::pool_closed),
+        std::pair(23, AchievementId::melony_lane),
+        std::pair(24, AchievementId::second_life)};
+
+    inline constexpr auto k_achievement_index_30 = std::array<std::pair<std::uint8_t, AchievementId>, 46>{
+        std::pair(0, AchievementId::home_security),
+        std::pair(1, AchievementId::spudow),
+        std::pair(2, AchievementId::explodonator),
+        std::pair(3, AchievementId::morticulturalist),
+        std::pair(4, AchievementId::dont_pea),
+        std::pair(5, AchievementId::roll_some_heads),
+        std::pair(6, AchievementId::grounded),
+        std::pair(7, AchievementId::zombologist),
+        std::pair(8, AchievementId::penny_pincher),
+        std::pair(9, AchievementId::sunny_days),
+        std::pair(10, AchievementId::good_morning),
+        std::pair(11, AchievementId::no_fungus_amongus),
+        std::pair(12, AchievementId::last_mown_stading),
+        std::pair(13, AchievementId::below_zero),
+        std::pair(14, AchievementId::flower_power),
+        std::pair(15, AchievementId::pyromaniac),
+        std::pair(16, AchievementId::lawn_mowner_man),
+        std::pair(17, AchievementId::chill_out),
+        std::pair(18, AchievementId::defcorn_five),
+        std::pair(19, AchievementId::monster_mash),
+        std::pair(20, AchievementId::blind_faith),
+        std::pair(21, AchievementId::pool_closed),
+        std::pair(22, AchievementId::melony_lane),
+        std::pair(23, AchievementId::second_life),
+        std::pair(24, AchievementId::lucky_spin),
+        std::pair(25, AchievementId::chilli_free),
+        std::pair(26, AchievementId::enlightened),
+        std::pair(27, AchievementId::diamond_beghouler),
+        std::pair(28, AchievementId::greenfingers),
+        std::pair(29, AchievementId::wallnot_attack),
+        std::pair(30, AchievementId::beyond_the_grave),
+        std::pair(31, AchievementId::peking_express),
+        std::pair(32, AchievementId::shooting_star),
+        std::pair(33, AchievementId::sol_invictus),
+        std::pair(34, AchievementId::sproing_sproing),
+        std::pair(35, AchievementId::better_off_dead),
+        std::pair(36, AchievementId::i_win),
+        std::pair(37, AchievementId::where_the_sun_dont_shine),
+        std::pair(38, AchievementId::undead_space),
+        std::pair(39, AchievementId::disco_is_undead),
+        std::pair(40, AchievementId::china_shop),
+        std::pair(41, AchievementId::smashing),
+        std::pair(42, AchievementId::gotcha),
+        std::pair(43, AchievementId::still_standing),
+        std::pair(44, AchievementId::the_stuff_of_legends),
+        std::pair(45, AchievementId::hammer_time)};
+
+    template <>
+    struct KeyTable<AchievementId>
+    {
+        inline static constexpr auto value = std::array{
+            KeyLayout<AchievementId>{between(12, 13), 20_size, 20_size, k_achievement_index_12},
+            KeyLayout<AchievementId>{between(13, 30), 25_size, 25_size, k_achievement_index_13},
+            KeyLayout<AchievementId>{since(30), 46_size, 46_size, k_achievement_index_30}};
+    };
+
     struct Common
     {
         inline constexpr static auto k_user_version_list = std::array<int, 4>{10, 11, 12, 13};
@@ -37,28 +528,52 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
             int backdrop_color;
         };
 
+        // every zombatar start with a 0xFFFFFFFF marker
+
+        using ZombatarRecord = Record<
+            &ZombatarStructure::skin_color,
+            &ZombatarStructure::clothes_type,
+            &ZombatarStructure::clothes_color,
+            &ZombatarStructure::tidbits_type,
+            &ZombatarStructure::tidbits_color,
+            &ZombatarStructure::accessories_type,
+            &ZombatarStructure::accessories_color,
+            &ZombatarStructure::facial_hair_type,
+            &ZombatarStructure::facial_hair_color,
+            &ZombatarStructure::hair_type,
+            &ZombatarStructure::hair_color,
+            &ZombatarStructure::eyewear_type,
+            &ZombatarStructure::eyewear_color,
+            &ZombatarStructure::hat_type,
+            &ZombatarStructure::hat_color,
+            &ZombatarStructure::backdrop_type,
+            &ZombatarStructure::backdrop_color>;
+
+        using ZombatarMapping = Mapping<
+            Link<&ZombatarStructure::skin_color, &ZombatarValue::skin_color>,
+            Link<&ZombatarStructure::clothes_type, &ZombatarValue::clothes, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::clothes_color, &ZombatarValue::clothes, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::tidbits_type, &ZombatarValue::tidbits, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::tidbits_color, &ZombatarValue::tidbits, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::accessories_type, &ZombatarValue::accessories, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::accessories_color, &ZombatarValue::accessories, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::facial_hair_type, &ZombatarValue::facial_hair, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::facial_hair_color, &ZombatarValue::facial_hair, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::hair_type, &ZombatarValue::hair, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::hair_color, &ZombatarValue::hair, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::eyewear_type, &ZombatarValue::eyewear, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::eyewear_color, &ZombatarValue::eyewear, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::hat_type, &ZombatarValue::hat, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::hat_color, &ZombatarValue::hat, &ZombatarArgument::color>,
+            Link<&ZombatarStructure::backdrop_type, &ZombatarValue::backdrop, &ZombatarArgument::type>,
+            Link<&ZombatarStructure::backdrop_color, &ZombatarValue::backdrop, &ZombatarArgument::color>>;
+
         inline static auto exchange_to_zombatar_struct(
             DataStreamView &data,
             ZombatarStructure &value) -> void
         {
             assert_conditional(data.readUint32() == 0xFFFFFFFF, fmt::format("{}", Language::get("popcap.player_info.invalid_section")), "exchange_to_zombatar_struct");
-            value.skin_color = data.readInt32();
-            value.clothes_type = data.readInt32();
-            value.clothes_color = data.readInt32();
-            value.tidbits_type = data.readInt32();
-            value.tidbits_color = data.readInt32();
-            value.accessories_type = data.readInt32();
-            value.accessories_color = data.readInt32();
-            value.facial_hair_type = data.readInt32();
-            value.facial_hair_color = data.readInt32();
-            value.hair_type = data.readInt32();
-            value.hair_color = data.readInt32();
-            value.eyewear_type = data.readInt32();
-            value.eyewear_color = data.readInt32();
-            value.hat_type = data.readInt32();
-            value.hat_color = data.readInt32();
-            value.backdrop_type = data.readInt32();
-            value.backdrop_color = data.readInt32();
+            ZombatarRecord::read(data, value);
             return;
         }
 
@@ -67,23 +582,7 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
             ZombatarStructure const &value) -> void
         {
             data.writeUint32(0xFFFFFFFF);
-            data.writeInt32(value.skin_color);
-            data.writeInt32(value.clothes_type);
-            data.writeInt32(value.clothes_color);
-            data.writeInt32(value.tidbits_type);
-            data.writeInt32(value.tidbits_color);
-            data.writeInt32(value.accessories_type);
-            data.writeInt32(value.accessories_color);
-            data.writeInt32(value.facial_hair_type);
-            data.writeInt32(value.facial_hair_color);
-            data.writeInt32(value.hair_type);
-            data.writeInt32(value.hair_color);
-            data.writeInt32(value.eyewear_type);
-            data.writeInt32(value.eyewear_color);
-            data.writeInt32(value.hat_type);
-            data.writeInt32(value.hat_color);
-            data.writeInt32(value.backdrop_type);
-            data.writeInt32(value.backdrop_color);
+            ZombatarRecord::write(data, value);
             return;
         }
 
@@ -106,48 +605,75 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
             int64_t future_attribute;
         };
 
+        // the game structure written as is, times are 64-bit
+
+        using PottedPlantRecord = Record<
+            &PottedPlantStructure::seed_type,
+            &PottedPlantStructure::which_zen_garden,
+            &PottedPlantStructure::m_x,
+            &PottedPlantStructure::m_y,
+            &PottedPlantStructure::facing,
+            Padding<4_size>{},
+            &PottedPlantStructure::last_watered_time,
+            &PottedPlantStructure::draw_variation,
+            &PottedPlantStructure::plant_age,
+            &PottedPlantStructure::times_fed,
+            &PottedPlantStructure::feedings_pergrow,
+            &PottedPlantStructure::plant_need,
+            Padding<4_size>{},
+            &PottedPlantStructure::last_need_fulfilled_time,
+            &PottedPlantStructure::last_fertilized_time,
+            &PottedPlantStructure::last_chocolate_time,
+            &PottedPlantStructure::future_attribute>;
+
+        // version 30 and later store times as 32-bit
+
+        using PottedPlantCompactRecord = Record<
+            &PottedPlantStructure::seed_type,
+            &PottedPlantStructure::which_zen_garden,
+            &PottedPlantStructure::m_x,
+            &PottedPlantStructure::m_y,
+            &PottedPlantStructure::facing,
+            As<&PottedPlantStructure::last_watered_time, std::int32_t>{},
+            &PottedPlantStructure::draw_variation,
+            &PottedPlantStructure::plant_age,
+            &PottedPlantStructure::times_fed,
+            &PottedPlantStructure::feedings_pergrow,
+            &PottedPlantStructure::plant_need,
+            Padding<4_size>{},
+            As<&PottedPlantStructure::last_need_fulfilled_time, std::int32_t>{},
+            As<&PottedPlantStructure::last_fertilized_time, std::int32_t>{},
+            As<&PottedPlantStructure::last_chocolate_time, std::int32_t>{},
+            As<&PottedPlantStructure::future_attribute, std::int32_t>{},
+            Padding<4_size>{}>;
+
+        using PottedPlantMapping = Mapping<
+            Link<&PottedPlantStructure::seed_type, &PottedPlant::seed_type>,
+            Link<&PottedPlantStructure::which_zen_garden, &PottedPlant::location>,
+            Link<&PottedPlantStructure::m_x, &PottedPlant::position, &Position::x>,
+            Link<&PottedPlantStructure::m_y, &PottedPlant::position, &Position::y>,
+            Link<&PottedPlantStructure::facing, &PottedPlant::plant_status, &PottedPlantInfo::orientation>,
+            Link<&PottedPlantStructure::draw_variation, &PottedPlant::plant_status, &PottedPlantInfo::color>,
+            Link<&PottedPlantStructure::plant_age, &PottedPlant::plant_status, &PottedPlantInfo::plant_age>,
+            Link<&PottedPlantStructure::plant_need, &PottedPlant::plant_status, &PottedPlantInfo::plant_need>,
+            Link<&PottedPlantStructure::times_fed, &PottedPlant::plant_status, &PottedPlantInfo::num_of_time_watered>,
+            Link<&PottedPlantStructure::feedings_pergrow, &PottedPlant::plant_status, &PottedPlantInfo::feeding_pre_grow>,
+            Link<&PottedPlantStructure::last_watered_time, &PottedPlant::plant_status, &PottedPlantInfo::time, &PottedPlantTime::last_watered_time>,
+            Link<&PottedPlantStructure::last_need_fulfilled_time, &PottedPlant::plant_status, &PottedPlantInfo::time, &PottedPlantTime::last_need_ful_filled_time>,
+            Link<&PottedPlantStructure::last_fertilized_time, &PottedPlant::plant_status, &PottedPlantInfo::time, &PottedPlantTime::last_fertilized_time>,
+            Link<&PottedPlantStructure::last_chocolate_time, &PottedPlant::plant_status, &PottedPlantInfo::time, &PottedPlantTime::last_chocolate_time>>;
+
         inline static auto exchange_to_potted_plants(
             DataStreamView &data,
             PottedPlantStructure &value) -> void
         {
             if (k_version < 30)
             {
-                value.seed_type = data.readInt32();
-                value.which_zen_garden = data.readInt32();
-                value.m_x = data.readInt32();
-                value.m_y = data.readInt32();
-                value.facing = data.readInt32();
-                data.read_pos += 4_size;
-                value.last_watered_time = data.readInt64();
-                value.draw_variation = data.readInt32();
-                value.plant_age = data.readUint32();
-                value.times_fed = data.readInt32();
-                value.feedings_pergrow = data.readInt32();
-                value.plant_need = data.readInt32();
-                data.read_pos += 4_size;
-                value.last_need_fulfilled_time = data.readInt64();
-                value.last_fertilized_time = data.readInt64();
-                value.last_chocolate_time = data.readInt64();
+                PottedPlantRecord::read(data, value);
             }
             else
             {
-                value.seed_type = data.readInt32();
-                value.which_zen_garden = data.readInt32();
-                value.m_x = data.readInt32();
-                value.m_y = data.readInt32();
-                value.facing = data.readInt32();
-                value.last_watered_time = data.readInt32();
-                value.draw_variation = data.readInt32();
-                value.plant_age = data.readUint32();
-                value.times_fed = data.readInt32();
-                value.feedings_pergrow = data.readInt32();
-                value.plant_need = data.readInt32();
-                data.read_pos += 4_size;
-                value.last_need_fulfilled_time = data.readInt32();
-                value.last_fertilized_time = data.readInt32();
-                value.last_chocolate_time = data.readInt32();
-                value.future_attribute = data.readInt32();
-                data.read_pos += 4_size;
+                PottedPlantCompactRecord::read(data, value);
             }
             return;
         }
@@ -158,43 +684,11 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         {
             if (k_version < 30)
             {
-                data.writeInt32(value.seed_type);
-                data.writeInt32(value.which_zen_garden);
-                data.writeInt32(value.m_x);
-                data.writeInt32(value.m_y);
-                data.writeInt32(value.facing);
-                data.writeNull(4_size);
-                data.writeInt64(value.last_watered_time);
-                data.writeInt32(value.draw_variation);
-                data.writeInt32(value.plant_age);
-                data.writeInt32(value.times_fed);
-                data.writeInt32(value.feedings_pergrow);
-                data.writeInt32(value.plant_need);
-                data.writeNull(4_size);
-                data.writeInt64(value.last_need_fulfilled_time);
-                data.writeInt64(value.last_fertilized_time);
-                data.writeInt64(value.last_chocolate_time);
-                data.writeInt64(value.future_attribute);
+                PottedPlantRecord::write(data, value);
             }
             else
             {
-                data.writeInt32(value.seed_type);
-                data.writeInt32(value.which_zen_garden);
-                data.writeInt32(value.m_x);
-                data.writeInt32(value.m_y);
-                data.writeInt32(value.facing);
-                data.writeInt32(value.last_watered_time);
-                data.writeInt32(value.draw_variation);
-                data.writeInt32(value.plant_age);
-                data.writeInt32(value.times_fed);
-                data.writeInt32(value.feedings_pergrow);
-                data.writeInt32(value.plant_need);
-                data.writeNull(4_size);
-                data.writeInt32(value.last_need_fulfilled_time);
-                data.writeInt32(value.last_fertilized_time);
-                data.writeInt32(value.last_chocolate_time);
-                data.writeInt32(value.future_attribute);
-                data.writeNull(4_size);
+                PottedPlantCompactRecord::write(data, value);
             }
             return;
         }
@@ -240,6 +734,220 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
             std::vector<uint8_t> expand;
         };
 
+        // player stats block, same layout in every version that store it
+
+        using PlayerStatsRecord = Record<
+            &DetailStructure::play_time_active_player,
+            &DetailStructure::play_time_inactive_player,
+            &DetailStructure::has_used_cheat_keys,
+            &DetailStructure::has_woken_stiky,
+            &DetailStructure::didnt_purchase_packet_upgrade,
+            &DetailStructure::last_stinky_chocolate_time,
+            &DetailStructure::stinky_pos_x,
+            &DetailStructure::stinky_pos_y,
+            &DetailStructure::has_unlocked_minigames,
+            &DetailStructure::has_unlocked_puzzle_mode,
+            &DetailStructure::has_new_minigame,
+            &DetailStructure::has_new_scary_potter,
+            &DetailStructure::has_new_i_zombie,
+            &DetailStructure::has_new_survival,
+            &DetailStructure::has_new_limbo_page,
+            &DetailStructure::need_message_on_game_seletor,
+            &DetailStructure::need_magic_taco_reward,
+            &DetailStructure::has_seen_stinky,
+            &DetailStructure::has_seen_upsell,
+            &DetailStructure::place_holder_player_stats>;
+
+        // coins are stored divided by k_coins_ratio, see exchange_detail_general
+
+        using GeneralMapping = Mapping<
+            Link<&DetailStructure::level, &General::adventure_level>,
+            Link<&DetailStructure::need_message_on_game_seletor, &General::adventure_compeled>,
+            Link<&DetailStructure::finished_adventure, &General::completed_adventure_time>,
+            Link<&DetailStructure::play_time_active_player, &General::player_time_active_player>,
+            Link<&DetailStructure::play_time_inactive_player, &General::player_time_inactive_player>,
+            Link<&DetailStructure::place_holder_player_stats, &General::place_holder_player_stats>,
+            Link<&DetailStructure::need_magic_taco_reward, &General::has_magic_taco_reward>>;
+
+        using UnlockedMapping = Mapping<
+            Link<&DetailStructure::has_unlocked_minigames, &Unlocked::minigame>,
+            Link<&DetailStructure::has_unlocked_puzzle_mode, &Unlocked::puzzle_mode>,
+            Link<&DetailStructure::has_new_minigame, &Unlocked::first_time_play_minigame>,
+            Link<&DetailStructure::has_new_scary_potter, &Unlocked::first_time_play_vasebreaker>,
+            Link<&DetailStructure::has_new_i_zombie, &Unlocked::first_time_play_i_zombie>,
+            Link<&DetailStructure::has_new_survival, &Unlocked::first_time_play_survival>>;
+
+        // potted plants are mapped by PottedPlantMapping
+
+        using ZenGardenMapping = Mapping<
+            Link<&DetailStructure::has_seen_stinky, &ZenGarden::stinky, &StinkyTheSnail::status, &StinkyInfo::sleeping>,
+            Link<&DetailStructure::last_stinky_chocolate_time, &ZenGarden::stinky, &StinkyTheSnail::status, &StinkyInfo::last_chocolate>,
+            Link<&DetailStructure::stinky_pos_x, &ZenGarden::stinky, &StinkyTheSnail::position, &Position::x>,
+            Link<&DetailStructure::stinky_pos_y, &ZenGarden::stinky, &StinkyTheSnail::position, &Position::y>>;
+
+        // zombatars are mapped by ZombatarMapping
+
+        using ZombatarLicenseMapping = Mapping<
+            Link<&DetailStructure::accepted_zombatar_license, &Zombatar::accepted_zombatar_license>,
+            Link<&DetailStructure::display_save_image_messenge, &Zombatar::display_save_image_messenge>>;
+
+        using ChallengeSlot = SlotList<
+            Slot<GameMode::adventure, AsNothing>,
+            Slot<GameMode::survival_normal_stage_1, AsLimit<0, 5>, &ChallengeRecord::survival, &SurvivalRecord::day_normal_flag>,
+            Slot<GameMode::survival_normal_stage_2, AsLimit<0, 5>, &ChallengeRecord::survival, &SurvivalRecord::night_normal_flag>,
+            Slot<GameMode::survival_normal_stage_3, AsLimit<0, 5>, &ChallengeRecord::survival, &SurvivalRecord::pool_normal_flag>,
+            Slot<GameMode::survival_normal_stage_4, AsLimit<0, 5>, &ChallengeRecord::survival, &SurvivalRecord::fog_normal_flag>,
+            Slot<GameMode::survival_normal_stage_5, AsLimit<0, 5>, &ChallengeRecord::survival, &SurvivalRecord::roof_normal_flag>,
+            Slot<GameMode::survival_hard_stage_1, AsLimit<0, 10>, &ChallengeRecord::survival, &SurvivalRecord::day_hard_flag>,
+            Slot<GameMode::survival_hard_stage_2, AsLimit<0, 10>, &ChallengeRecord::survival, &SurvivalRecord::night_hard_flag>,
+            Slot<GameMode::survival_hard_stage_3, AsLimit<0, 10>, &ChallengeRecord::survival, &SurvivalRecord::pool_hard_flag>,
+            Slot<GameMode::survival_hard_stage_4, AsLimit<0, 10>, &ChallengeRecord::survival, &SurvivalRecord::fog_hard_flag>,
+            Slot<GameMode::survival_hard_stage_5, AsLimit<0, 10>, &ChallengeRecord::survival, &SurvivalRecord::roof_hard_flag>,
+            Slot<GameMode::survival_endless_stage_1, AsValue, &ChallengeRecord::canceled_minigame, &LimboRecord::survival_day_endless_flag>,
+            Slot<GameMode::survival_endless_stage_2, AsValue, &ChallengeRecord::canceled_minigame, &LimboRecord::survival_night_endless_flag>,
+            Slot<GameMode::survival_endless_stage_3, AsValue, &ChallengeRecord::survival, &SurvivalRecord::survival_endless_flag>,
+            Slot<GameMode::survival_endless_stage_4, AsValue, &ChallengeRecord::canceled_minigame, &LimboRecord::survival_fog_endless_flag>,
+            Slot<GameMode::survival_endless_stage_5, AsValue, &ChallengeRecord::canceled_minigame, &LimboRecord::survival_roof_endless_flag>,
+            Slot<GameMode::challenge_war_and_peas, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::zombotany>,
+            Slot<GameMode::challenge_wallnut_bowling, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::wallnull_bowling>,
+            Slot<GameMode::challenge_slot_machine, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::slot_machine>,
+            Slot<GameMode::challenge_raining_seeds, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::raining_seeds>,
+            Slot<GameMode::challenge_beghouled, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::beghouled>,
+            Slot<GameMode::challenge_invisighoul, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::invisi_ghoul>,
+            Slot<GameMode::challenge_seeing_stars, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::seeing_stars>,
+            Slot<GameMode::challenge_zombiquarium, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::zombiquarium>,
+            Slot<GameMode::challenge_beghouled_twist, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::beghouled_twist>,
+            Slot<GameMode::challenge_little_trouble, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::little_trouble>,
+            Slot<GameMode::challenge_portal_combat, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::portal_combat>,
+            Slot<GameMode::challenge_column, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::column_like_see_you_em>,
+            Slot<GameMode::challenge_bobsled_bonanza, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::bobsled_bonanza>,
+            Slot<GameMode::challenge_speed, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::zombie_nimble_zombie_quick>,
+            Slot<GameMode::challenge_whack_a_zombie, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::whack_a_zombie>,
+            Slot<GameMode::challenge_last_stand, AsValue, &ChallengeRecord::minigame, &MiniGameRecord::last_stand>,
+            Slot<GameMode::challenge_war_and_peas_2, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::zombotany_2>,
+            Slot<GameMode::challenge_wallnut_bowling_2, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::wallnut_bowling_2>,
+            Slot<GameMode::challenge_pogo_party, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::pogo_party>,
+            Slot<GameMode::challenge_final_boss, AsFlag, &ChallengeRecord::minigame, &MiniGameRecord::dr_zomboss_revenge>,
+            Slot<GameMode::challenge_art_challenge_wallnut, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::art_challenge_wallnut>,
+            Slot<GameMode::challenge_sunny_day, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::sunny_day>,
+            Slot<GameMode::challenge_resodded, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::unsodded>,
+            Slot<GameMode::challenge_big_time, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::big_time>,
+            Slot<GameMode::challenge_art_challenge_sunflower, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::art_challenge_sunflower>,
+            Slot<GameMode::challenge_air_raid, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::air_raid>,
+            Slot<GameMode::challenge_ice, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::ice_level>,
+            Slot<GameMode::challenge_zen_garden, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::zen_garden>,
+            Slot<GameMode::challenge_high_gravity, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::high_gravity>,
+            Slot<GameMode::challenge_grave_danger, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::grave_danger>,
+            Slot<GameMode::challenge_shovel, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::can_you_dig_it>,
+            Slot<GameMode::challenge_stormy_night, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::dark_stormy_night>,
+            Slot<GameMode::challenge_bungee_blitz, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::bungee_blitz>,
+            Slot<GameMode::challenge_squirrel, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::squirrel>,
+            Slot<GameMode::tree_of_wisdom, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::tree_of_wisdom>,
+            Slot<GameMode::scary_potter_1, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_1>,
+            Slot<GameMode::scary_potter_2, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_2>,
+            Slot<GameMode::scary_potter_3, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_3>,
+            Slot<GameMode::scary_potter_4, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_4>,
+            Slot<GameMode::scary_potter_5, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_5>,
+            Slot<GameMode::scary_potter_6, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_6>,
+            Slot<GameMode::scary_potter_7, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_7>,
+            Slot<GameMode::scary_potter_8, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_8>,
+            Slot<GameMode::scary_potter_9, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_9>,
+            Slot<GameMode::scary_potter_endless, AsValue, &ChallengeRecord::puzzle, &PuzzleRecord::vasebreaker_endless_flag>,
+            Slot<GameMode::puzzle_i_zombie_1, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_1>,
+            Slot<GameMode::puzzle_i_zombie_2, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_2>,
+            Slot<GameMode::puzzle_i_zombie_3, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_3>,
+            Slot<GameMode::puzzle_i_zombie_4, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_4>,
+            Slot<GameMode::puzzle_i_zombie_5, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_5>,
+            Slot<GameMode::puzzle_i_zombie_6, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_6>,
+            Slot<GameMode::puzzle_i_zombie_7, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_7>,
+            Slot<GameMode::puzzle_i_zombie_8, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_8>,
+            Slot<GameMode::puzzle_i_zombie_9, AsFlag, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_9>,
+            Slot<GameMode::puzzle_i_zombie_endless, AsValue, &ChallengeRecord::puzzle, &PuzzleRecord::i_zombie_endless_flag>,
+            Slot<GameMode::upsell, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::upsell>,
+            Slot<GameMode::intro, AsFlag, &ChallengeRecord::canceled_minigame, &LimboRecord::intro>,
+            Slot<GameMode::last_stand_stage_1, AsValue, &ChallengeRecord::last_stand, &LastStandRecord::day_flag>,
+            Slot<GameMode::last_stand_stage_2, AsValue, &ChallengeRecord::last_stand, &LastStandRecord::night_flag>,
+            Slot<GameMode::last_stand_stage_3, AsValue, &ChallengeRecord::last_stand, &LastStandRecord::pool_flag>,
+            Slot<GameMode::last_stand_stage_4, AsValue, &ChallengeRecord::last_stand, &LastStandRecord::fog_flag>,
+            Slot<GameMode::last_stand_stage_5, AsValue, &ChallengeRecord::last_stand, &LastStandRecord::roof_flag>,
+            Slot<GameMode::last_stand_endless, AsValue, &ChallengeRecord::last_stand, &LastStandRecord::endless_flag>,
+            Slot<GameMode::unknown, AsNothing>>;
+
+        // stinky is bought when its slot is set, the slot hold the time it was last awoken
+
+        struct AsStinky
+        {
+            inline static auto read(
+                int value,
+                StinkyTheSnail &target) -> void
+            {
+                target.purchased = true;
+                target.status.last_awoken = value;
+                return;
+            }
+
+            inline static auto is_set(
+                StinkyTheSnail const &target) -> bool
+            {
+                return target.purchased;
+            }
+
+            inline static auto write(
+                StinkyTheSnail const &target) -> int
+            {
+                return target.status.last_awoken;
+            }
+        };
+
+        using PurchaseSlot = SlotList<
+            Slot<StoreItem::plant_gatlingpea, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_gatling_pea>,
+            Slot<StoreItem::plant_twinsunflower, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_twin_sunflower>,
+            Slot<StoreItem::plant_gloomshroom, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_gloomshroom>,
+            Slot<StoreItem::plant_cattail, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_cattail>,
+            Slot<StoreItem::plant_wintermelon, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_winter_melon>,
+            Slot<StoreItem::plant_gold_magnet, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_gold_magnet>,
+            Slot<StoreItem::plant_spikerock, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_sprike_rock>,
+            Slot<StoreItem::plant_cobcannon, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_cob_cannon>,
+            Slot<StoreItem::plant_imitater, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::plant_imitater>,
+            Slot<StoreItem::bonus_lawn_mower, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::bonus_lawn_mower>,
+            Slot<StoreItem::potted_marigold_1, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchesed_marigold_1_time>,
+            Slot<StoreItem::potted_marigold_2, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchesed_marigold_2_time>,
+            Slot<StoreItem::potted_marigold_3, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchesed_marigold_3_time>,
+            Slot<StoreItem::gold_wateringcan, AsFlag, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::gold_watering_can>,
+            Slot<StoreItem::fertilizer, AsOffset<k_amount_ratio>, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::fertilizer>,
+            Slot<StoreItem::bug_spray, AsOffset<k_amount_ratio>, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::bug_spray>,
+            Slot<StoreItem::phonograph, AsFlag, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::phonograph>,
+            Slot<StoreItem::gardening_glove, AsFlag, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::gardening_glove>,
+            Slot<StoreItem::mushroom_garden, AsFlag, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::mushroom_garden>,
+            Slot<StoreItem::wheel_barrow, AsFlag, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::wheel_barrow>,
+            Slot<StoreItem::stinky_the_snail, AsStinky, &DetailInfo::zen_garden, &ZenGarden::stinky>,
+            Slot<StoreItem::packet_upgrade, AsLimit<0, 4, true>, &DetailInfo::store, &Store::extra_packet_slots>,
+            Slot<StoreItem::pool_cleaner, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::pool_cleaner>,
+            Slot<StoreItem::roof_cleaner, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::roof_cleaner>,
+            Slot<StoreItem::rake, AsLimit<0, 3>, &DetailInfo::store, &Store::uses_of_rake>,
+            Slot<StoreItem::aquarium_garden, AsFlag, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::aquarium_garden>,
+            Slot<StoreItem::chocolate, AsOffset<k_amount_ratio>, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::chocolate>,
+            Slot<StoreItem::tree_of_wisdom, AsFlag, &DetailInfo::zen_garden, &ZenGarden::tree_of_wisdom, &TreeOfWisdom::purchased>,
+            Slot<StoreItem::tree_food, AsOffset<k_amount_ratio>, &DetailInfo::zen_garden, &ZenGarden::tree_of_wisdom, &TreeOfWisdom::tree_food>,
+            Slot<StoreItem::firstaid, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::first_aid>,
+            Slot<StoreItem::basic_giftbox, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchsed_basic_giftbox_time>,
+            Slot<StoreItem::bronze_giftbox, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchsed_bronze_giftboxtime>,
+            Slot<StoreItem::silver_giftbox, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchsed_silver_giftbox_time>,
+            Slot<StoreItem::gold_giftbox, AsValue, &DetailInfo::zen_garden, &ZenGarden::purchased, &ZenGardenPurchased::last_purchsed_gold_giftbox_time>,
+            Slot<StoreItem::zombotany, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::zombotany>,
+            Slot<StoreItem::minigame_pack_1, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::minigame_pack_1>,
+            Slot<StoreItem::minigame_pack_2, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::minigame_pack_2>,
+            Slot<StoreItem::minigame_pack_3, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::minigame_pack_3>,
+            Slot<StoreItem::minigame_pack_4, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::minigame_pack_4>,
+            Slot<StoreItem::minigame_pack_5, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::minigame_pack_5>,
+            Slot<StoreItem::i_zombie_pack, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::i_zombie_pack>,
+            Slot<StoreItem::scary_potter_pack, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::scary_potter_pack>,
+            Slot<StoreItem::bacon, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::bacon>,
+            Slot<StoreItem::bacon_2, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::bacon_2>,
+            Slot<StoreItem::last_stand_pack, AsFlag, &DetailInfo::store, &Store::purchased, &StorePurchased::last_stand_pack>,
+            Slot<StoreItem::hammer, AsValue, &DetailInfo::store, &Store::hammer>,
+            Slot<StoreItem::pvz, AsNothing>>;
+
         inline static auto exchange_to_version(
             DataStreamView &data,
             int &value) -> void
@@ -256,946 +964,29 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
             return;
         }
 
-        template <auto min, auto max, typename T>
-            requires std::is_arithmetic<T>::value
-        inline static auto exchange_range(
-            T const &value) -> T
-        {
-            static_assert(sizeof(min) == sizeof(T) && sizeof(max) == sizeof(T), "invalid_size_range");
-            return (value > min) ? (value > max) ? max : value : min;
-        }
-
-        inline static auto exchange_challenge_records_count(
+        // integer list of Key, the profile store key_list_size of them
 
-            ) -> size_t
+        template <typename Key>
+        inline static auto exchange_to_slot_list(
+            DataStreamView &data,
+            std::vector<int> &value) -> void
         {
-            if (k_version < 11)
-            {
-                return 101_size;
-            }
-            else if (k_version < 13)
-            {
-                return 100_size;
-            }
-            else if (k_version < 30)
-            {
-                return 200_size;
-            }
-            else
-            {
-                return 200_size;
-            }
+            exchange_list(data, value, [](auto &data, auto &value)
+                          { value = data.readInt32(); }, key_list_size<Key>());
+            return;
         }
 
-        inline static auto exchange_purchases_count(
+        // the list is padded with zero up to key_list_size
 
-            ) -> size_t
-        {
-            if (k_version < 11)
-            {
-                return 80_size;
-            }
-            else if (k_version < 13)
-            {
-                return 80_size;
-            }
-            else if (k_version < 30)
-            {
-                return 102_size;
-            }
-            else
-            {
-                return 80_size;
-            }
-        }
-
-        // Type is uint8_t || enum
-        template <typename InputType, typename ReturnType>
-            requires((std::is_enum<InputType>::value || std::is_same<InputType, uint8_t>::value)) && (std::is_enum<ReturnType>::value || std::is_same<ReturnType, uint8_t>::value || std::is_same<ReturnType, size_t>::value) && true
-        inline static auto exchange_enumeration(
-            InputType const &data) -> ReturnType
+        template <typename Key>
+        inline static auto exchange_from_slot_list(
+            DataStreamView &data,
+            std::vector<int> const &value) -> void
         {
-            // static_assert(sizeof...(InputType) == 1 || sizeof...(InputType) == 0, "Expected 0 or 1 argument only");
-            static_assert(std::is_enum<InputType>::value || std::is_enum<ReturnType>::value, "Must be one enumeration type");
-            if constexpr (std::is_same<InputType, GameMode>::value || std::is_same<ReturnType, GameMode>::value)
-            {
-                if constexpr (std::is_same<ReturnType, size_t>::value)
-                {
-                    if (k_version < 11)
-                    {
-                        return 70_size;
-                    }
-                    else if (k_version < 13)
-                    {
-                        return 72_size;
-                    }
-                    else if (k_version < 30)
-                    {
-                        return 72_size;
-                    }
-                    else
-                    {
-                        return 200_size;
-                    }
-                }
-                else
-                {
-                    if (k_version < 11)
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, GameMode>, 70>{
-                            std::pair(0, GameMode::adventure),
-                            std::pair(1, GameMode::survival_normal_stage_1),
-                            std::pair(2, GameMode::survival_normal_stage_2),
-                            std::pair(3, GameMode::survival_normal_stage_3),
-                            std::pair(4, GameMode::survival_normal_stage_4),
-                            std::pair(5, GameMode::survival_normal_stage_5),
-                            std::pair(6, GameMode::survival_hard_stage_1),
-                            std::pair(7, GameMode::survival_hard_stage_2),
-                            std::pair(8, GameMode::survival_hard_stage_3),
-                            std::pair(9, GameMode::survival_hard_stage_4),
-                            std::pair(10, GameMode::survival_hard_stage_5),
-                            std::pair(11, GameMode::survival_endless_stage_1),
-                            std::pair(12, GameMode::survival_endless_stage_2),
-                            std::pair(13, GameMode::survival_endless_stage_3),
-                            std::pair(14, GameMode::survival_endless_stage_4),
-                            std::pair(15, GameMode::survival_endless_stage_5),
-                            std::pair(16, GameMode::challenge_war_and_peas),
-                            std::pair(17, GameMode::challenge_beghouled),
-                            std::pair(18, GameMode::challenge_slot_machine),
-                            std::pair(19, GameMode::challenge_raining_seeds),
-                            std::pair(20, GameMode::challenge_wallnut_bowling),
-                            std::pair(21, GameMode::challenge_invisighoul),
-                            std::pair(22, GameMode::challenge_seeing_stars),
-                            std::pair(23, GameMode::challenge_zombiquarium),
-                            std::pair(24, GameMode::challenge_beghouled_twist),
-                            std::pair(25, GameMode::challenge_little_trouble),
-                            std::pair(26, GameMode::challenge_portal_combat),
-                            std::pair(27, GameMode::challenge_column),
-                            std::pair(28, GameMode::challenge_bobsled_bonanza),
-                            std::pair(29, GameMode::challenge_speed),
-                            std::pair(30, GameMode::challenge_whack_a_zombie),
-                            std::pair(31, GameMode::challenge_pogo_party),
-                            std::pair(32, GameMode::challenge_war_and_peas_2),
-                            std::pair(33, GameMode::challenge_wallnut_bowling_2),
-                            std::pair(34, GameMode::challenge_last_stand),
-                            std::pair(35, GameMode::challenge_final_boss),
-                            std::pair(36, GameMode::challenge_art_challenge_wallnut),
-                            std::pair(37, GameMode::challenge_sunny_day),
-                            std::pair(38, GameMode::challenge_resodded),
-                            std::pair(39, GameMode::challenge_big_time),
-                            std::pair(40, GameMode::challenge_art_challenge_sunflower),
-                            std::pair(41, GameMode::challenge_air_raid),
-                            std::pair(42, GameMode::challenge_ice),
-                            std::pair(43, GameMode::challenge_zen_garden),
-                            std::pair(44, GameMode::challenge_high_gravity),
-                            std::pair(45, GameMode::challenge_grave_danger),
-                            std::pair(46, GameMode::challenge_shovel),
-                            std::pair(47, GameMode::challenge_stormy_night),
-                            std::pair(48, GameMode::challenge_bungee_blitz),
-                            std::pair(49, GameMode::challenge_squirrel),
-                            std::pair(50, GameMode::scary_potter_1),
-                            std::pair(51, GameMode::scary_potter_2),
-                            std::pair(52, GameMode::scary_potter_3),
-                            std::pair(53, GameMode::scary_potter_4),
-                            std::pair(54, GameMode::scary_potter_5),
-                            std::pair(55, GameMode::scary_potter_6),
-                            std::pair(56, GameMode::scary_potter_7),
-                            std::pair(57, GameMode::scary_potter_8),
-                            std::pair(58, GameMode::scary_potter_9),
-                            std::pair(59, GameMode::scary_potter_endless),
-                            std::pair(60, GameMode::puzzle_i_zombie_1),
-                            std::pair(61, GameMode::puzzle_i_zombie_2),
-                            std::pair(62, GameMode::puzzle_i_zombie_3),
-                            std::pair(63, GameMode::puzzle_i_zombie_4),
-                            std::pair(64, GameMode::puzzle_i_zombie_5),
-                            std::pair(65, GameMode::puzzle_i_zombie_6),
-                            std::pair(66, GameMode::puzzle_i_zombie_7),
-                            std::pair(67, GameMode::puzzle_i_zombie_8),
-                            std::pair(68, GameMode::puzzle_i_zombie_9),
-                            std::pair(69, GameMode::puzzle_i_zombie_endless)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                    else if (k_version < 13)
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, GameMode>, 72>{
-                            std::pair(0, GameMode::survival_normal_stage_1),
-                            std::pair(1, GameMode::survival_normal_stage_2),
-                            std::pair(2, GameMode::survival_normal_stage_3),
-                            std::pair(3, GameMode::survival_normal_stage_4),
-                            std::pair(4, GameMode::survival_normal_stage_5),
-                            std::pair(5, GameMode::survival_hard_stage_1),
-                            std::pair(6, GameMode::survival_hard_stage_2),
-                            std::pair(7, GameMode::survival_hard_stage_3),
-                            std::pair(8, GameMode::survival_hard_stage_4),
-                            std::pair(9, GameMode::survival_hard_stage_5),
-                            std::pair(10, GameMode::survival_endless_stage_1),
-                            std::pair(11, GameMode::survival_endless_stage_2),
-                            std::pair(12, GameMode::survival_endless_stage_3),
-                            std::pair(13, GameMode::survival_endless_stage_4),
-                            std::pair(14, GameMode::survival_endless_stage_5),
-                            std::pair(15, GameMode::challenge_war_and_peas),
-                            std::pair(16, GameMode::challenge_wallnut_bowling),
-                            std::pair(17, GameMode::challenge_slot_machine),
-                            std::pair(18, GameMode::challenge_raining_seeds),
-                            std::pair(19, GameMode::challenge_beghouled),
-                            std::pair(20, GameMode::challenge_invisighoul),
-                            std::pair(21, GameMode::challenge_seeing_stars),
-                            std::pair(22, GameMode::challenge_zombiquarium),
-                            std::pair(23, GameMode::challenge_beghouled_twist),
-                            std::pair(24, GameMode::challenge_little_trouble),
-                            std::pair(25, GameMode::challenge_portal_combat),
-                            std::pair(26, GameMode::challenge_column),
-                            std::pair(27, GameMode::challenge_bobsled_bonanza),
-                            std::pair(28, GameMode::challenge_speed),
-                            std::pair(29, GameMode::challenge_whack_a_zombie),
-                            std::pair(30, GameMode::challenge_last_stand),
-                            std::pair(31, GameMode::challenge_war_and_peas_2),
-                            std::pair(32, GameMode::challenge_wallnut_bowling_2),
-                            std::pair(33, GameMode::challenge_pogo_party),
-                            std::pair(34, GameMode::challenge_final_boss),
-                            std::pair(35, GameMode::challenge_art_challenge_wallnut),
-                            std::pair(36, GameMode::challenge_sunny_day),
-                            std::pair(37, GameMode::challenge_resodded),
-                            std::pair(38, GameMode::challenge_big_time),
-                            std::pair(39, GameMode::challenge_art_challenge_sunflower),
-                            std::pair(40, GameMode::challenge_air_raid),
-                            std::pair(41, GameMode::challenge_ice),
-                            std::pair(42, GameMode::challenge_zen_garden),
-                            std::pair(43, GameMode::challenge_high_gravity),
-                            std::pair(44, GameMode::challenge_grave_danger),
-                            std::pair(45, GameMode::challenge_shovel),
-                            std::pair(46, GameMode::challenge_stormy_night),
-                            std::pair(47, GameMode::challenge_bungee_blitz),
-                            std::pair(48, GameMode::challenge_squirrel),
-                            std::pair(49, GameMode::tree_of_wisdom),
-                            std::pair(50, GameMode::scary_potter_1),
-                            std::pair(51, GameMode::scary_potter_2),
-                            std::pair(52, GameMode::scary_potter_3),
-                            std::pair(53, GameMode::scary_potter_4),
-                            std::pair(54, GameMode::scary_potter_5),
-                            std::pair(55, GameMode::scary_potter_6),
-                            std::pair(56, GameMode::scary_potter_7),
-                            std::pair(57, GameMode::scary_potter_8),
-                            std::pair(58, GameMode::scary_potter_9),
-                            std::pair(59, GameMode::scary_potter_endless),
-                            std::pair(60, GameMode::puzzle_i_zombie_1),
-                            std::pair(61, GameMode::puzzle_i_zombie_2),
-                            std::pair(62, GameMode::puzzle_i_zombie_3),
-                            std::pair(63, GameMode::puzzle_i_zombie_4),
-                            std::pair(64, GameMode::puzzle_i_zombie_5),
-                            std::pair(65, GameMode::puzzle_i_zombie_6),
-                            std::pair(66, GameMode::puzzle_i_zombie_7),
-                            std::pair(67, GameMode::puzzle_i_zombie_8),
-                            std::pair(68, GameMode::puzzle_i_zombie_9),
-                            std::pair(69, GameMode::puzzle_i_zombie_endless),
-                            std::pair(70, GameMode::upsell),
-                            std::pair(71, GameMode::intro)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                    else if (k_version < 30)
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, GameMode>, 72>{
-                            std::pair(0, GameMode::survival_normal_stage_1),
-                            std::pair(1, GameMode::survival_normal_stage_2),
-                            std::pair(2, GameMode::survival_normal_stage_3),
-                            std::pair(3, GameMode::survival_normal_stage_4),
-                            std::pair(4, GameMode::survival_normal_stage_5),
-                            std::pair(5, GameMode::survival_hard_stage_1),
-                            std::pair(6, GameMode::survival_hard_stage_2),
-                            std::pair(7, GameMode::survival_hard_stage_3),
-                            std::pair(8, GameMode::survival_hard_stage_4),
-                            std::pair(9, GameMode::survival_hard_stage_5),
-                            std::pair(10, GameMode::survival_endless_stage_1),
-                            std::pair(11, GameMode::survival_endless_stage_2),
-                            std::pair(12, GameMode::survival_endless_stage_3),
-                            std::pair(13, GameMode::survival_endless_stage_4),
-                            std::pair(14, GameMode::survival_endless_stage_5),
-                            std::pair(15, GameMode::challenge_war_and_peas),
-                            std::pair(16, GameMode::challenge_wallnut_bowling),
-                            std::pair(17, GameMode::challenge_slot_machine),
-                            std::pair(18, GameMode::challenge_raining_seeds),
-                            std::pair(19, GameMode::challenge_beghouled),
-                            std::pair(20, GameMode::challenge_invisighoul),
-                            std::pair(21, GameMode::challenge_seeing_stars),
-                            std::pair(22, GameMode::challenge_zombiquarium),
-                            std::pair(23, GameMode::challenge_beghouled_twist),
-                            std::pair(24, GameMode::challenge_little_trouble),
-                            std::pair(25, GameMode::challenge_portal_combat),
-                            std::pair(26, GameMode::challenge_column),
-                            std::pair(27, GameMode::challenge_bobsled_bonanza),
-                            std::pair(28, GameMode::challenge_speed),
-                            std::pair(29, GameMode::challenge_whack_a_zombie),
-                            std::pair(30, GameMode::challenge_last_stand),
-                            std::pair(31, GameMode::challenge_war_and_peas_2),
-                            std::pair(32, GameMode::challenge_wallnut_bowling_2),
-                            std::pair(33, GameMode::challenge_pogo_party),
-                            std::pair(34, GameMode::challenge_final_boss),
-                            std::pair(35, GameMode::challenge_art_challenge_wallnut),
-                            std::pair(36, GameMode::challenge_sunny_day),
-                            std::pair(37, GameMode::challenge_resodded),
-                            std::pair(38, GameMode::challenge_big_time),
-                            std::pair(39, GameMode::challenge_art_challenge_sunflower),
-                            std::pair(40, GameMode::challenge_air_raid),
-                            std::pair(41, GameMode::challenge_ice),
-                            std::pair(42, GameMode::challenge_zen_garden),
-                            std::pair(43, GameMode::challenge_high_gravity),
-                            std::pair(44, GameMode::challenge_grave_danger),
-                            std::pair(45, GameMode::challenge_shovel),
-                            std::pair(46, GameMode::challenge_stormy_night),
-                            std::pair(47, GameMode::challenge_bungee_blitz),
-                            std::pair(48, GameMode::challenge_squirrel),
-                            std::pair(49, GameMode::tree_of_wisdom),
-                            std::pair(50, GameMode::scary_potter_1),
-                            std::pair(51, GameMode::scary_potter_2),
-                            std::pair(52, GameMode::scary_potter_3),
-                            std::pair(53, GameMode::scary_potter_4),
-                            std::pair(54, GameMode::scary_potter_5),
-                            std::pair(55, GameMode::scary_potter_6),
-                            std::pair(56, GameMode::scary_potter_7),
-                            std::pair(57, GameMode::scary_potter_8),
-                            std::pair(58, GameMode::scary_potter_9),
-                            std::pair(59, GameMode::scary_potter_endless),
-                            std::pair(60, GameMode::puzzle_i_zombie_1),
-                            std::pair(61, GameMode::puzzle_i_zombie_2),
-                            std::pair(62, GameMode::puzzle_i_zombie_3),
-                            std::pair(63, GameMode::puzzle_i_zombie_4),
-                            std::pair(64, GameMode::puzzle_i_zombie_5),
-                            std::pair(65, GameMode::puzzle_i_zombie_6),
-                            std::pair(66, GameMode::puzzle_i_zombie_7),
-                            std::pair(67, GameMode::puzzle_i_zombie_8),
-                            std::pair(68, GameMode::puzzle_i_zombie_9),
-                            std::pair(69, GameMode::puzzle_i_zombie_endless),
-                            std::pair(70, GameMode::upsell),
-                            std::pair(71, GameMode::intro)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, GameMode>, 81>{
-                            std::pair(0, GameMode::survival_normal_stage_1),
-                            std::pair(1, GameMode::survival_normal_stage_2),
-                            std::pair(2, GameMode::survival_normal_stage_3),
-                            std::pair(3, GameMode::survival_normal_stage_4),
-                            std::pair(4, GameMode::survival_normal_stage_5),
-                            std::pair(5, GameMode::survival_hard_stage_1),
-                            std::pair(6, GameMode::survival_hard_stage_2),
-                            std::pair(7, GameMode::survival_hard_stage_3),
-                            std::pair(8, GameMode::survival_hard_stage_4),
-                            std::pair(9, GameMode::survival_hard_stage_5),
-                            std::pair(10, GameMode::survival_endless_stage_1),
-                            std::pair(11, GameMode::survival_endless_stage_2),
-                            std::pair(12, GameMode::survival_endless_stage_3),
-                            std::pair(13, GameMode::survival_endless_stage_4),
-                            std::pair(14, GameMode::survival_endless_stage_5),
-                            std::pair(15, GameMode::challenge_war_and_peas),
-                            std::pair(16, GameMode::challenge_wallnut_bowling),
-                            std::pair(17, GameMode::challenge_slot_machine),
-                            std::pair(18, GameMode::challenge_raining_seeds),
-                            std::pair(19, GameMode::challenge_beghouled),
-                            std::pair(20, GameMode::challenge_invisighoul),
-                            std::pair(21, GameMode::challenge_seeing_stars),
-                            std::pair(22, GameMode::challenge_zombiquarium),
-                            std::pair(23, GameMode::challenge_beghouled_twist),
-                            std::pair(24, GameMode::challenge_little_trouble),
-                            std::pair(25, GameMode::challenge_portal_combat),
-                            std::pair(26, GameMode::challenge_column),
-                            std::pair(27, GameMode::challenge_bobsled_bonanza),
-                            std::pair(28, GameMode::challenge_speed),
-                            std::pair(29, GameMode::challenge_whack_a_zombie),
-                            std::pair(30, GameMode::challenge_last_stand),
-                            std::pair(31, GameMode::challenge_war_and_peas_2),
-                            std::pair(32, GameMode::challenge_wallnut_bowling_2),
-                            std::pair(33, GameMode::challenge_pogo_party),
-                            std::pair(34, GameMode::challenge_final_boss),
-                            std::pair(35, GameMode::challenge_art_challenge_wallnut),
-                            std::pair(36, GameMode::challenge_sunny_day),
-                            std::pair(37, GameMode::challenge_resodded),
-                            std::pair(38, GameMode::challenge_big_time),
-                            std::pair(39, GameMode::challenge_art_challenge_sunflower),
-                            std::pair(40, GameMode::challenge_air_raid),
-                            std::pair(41, GameMode::challenge_ice),
-                            std::pair(42, GameMode::challenge_zen_garden),
-                            std::pair(43, GameMode::challenge_high_gravity),
-                            std::pair(44, GameMode::challenge_grave_danger),
-                            std::pair(45, GameMode::challenge_shovel),
-                            std::pair(46, GameMode::challenge_stormy_night),
-                            std::pair(47, GameMode::challenge_bungee_blitz),
-                            std::pair(48, GameMode::challenge_squirrel),
-                            std::pair(49, GameMode::scary_potter_1),
-                            std::pair(50, GameMode::scary_potter_2),
-                            std::pair(51, GameMode::scary_potter_3),
-                            std::pair(52, GameMode::scary_potter_4),
-                            std::pair(53, GameMode::scary_potter_5),
-                            std::pair(54, GameMode::scary_potter_6),
-                            std::pair(55, GameMode::scary_potter_7),
-                            std::pair(56, GameMode::scary_potter_8),
-                            std::pair(57, GameMode::scary_potter_9),
-                            std::pair(58, GameMode::scary_potter_endless),
-                            std::pair(59, GameMode::puzzle_i_zombie_1),
-                            std::pair(60, GameMode::puzzle_i_zombie_2),
-                            std::pair(61, GameMode::puzzle_i_zombie_3),
-                            std::pair(62, GameMode::puzzle_i_zombie_4),
-                            std::pair(63, GameMode::puzzle_i_zombie_5),
-                            std::pair(64, GameMode::puzzle_i_zombie_6),
-                            std::pair(65, GameMode::puzzle_i_zombie_7),
-                            std::pair(66, GameMode::puzzle_i_zombie_8),
-                            std::pair(67, GameMode::puzzle_i_zombie_9),
-                            std::pair(68, GameMode::puzzle_i_zombie_endless),
-                            std::pair(121, GameMode::last_stand_stage_1),
-                            std::pair(122, GameMode::last_stand_stage_2),
-                            std::pair(123, GameMode::last_stand_stage_3),
-                            std::pair(124, GameMode::last_stand_stage_4),
-                            std::pair(125, GameMode::last_stand_stage_5),
-                            std::pair(126, GameMode::last_stand_endless),
-                            std::pair(139, GameMode::unknown),
-                            std::pair(195, GameMode::unknown),
-                            std::pair(196, GameMode::unknown),
-                            std::pair(197, GameMode::unknown),
-                            std::pair(198, GameMode::unknown),
-                            std::pair(199, GameMode::unknown)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                }
-            }
-            if constexpr (std::is_same<InputType, StoreItem>::value || std::is_same<ReturnType, StoreItem>::value)
-            {
-                if constexpr (std::is_same<ReturnType, size_t>::value)
-                {
-                    if (k_version < 11)
-                    {
-                        return 27_size;
-                    }
-                    else if (k_version < 13)
-                    {
-                        return 31_size;
-                    }
-                    else if (k_version < 30)
-                    { // Maybe
-                        return 19_size;
-                    }
-                    else
-                    {
-                        return 44_size;
-                    }
-                }
-                else
-                {
-                    if (k_version < 11)
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, StoreItem>, 27>{
-                            std::pair(0, StoreItem::plant_gatlingpea),
-                            std::pair(1, StoreItem::plant_twinsunflower),
-                            std::pair(2, StoreItem::plant_gloomshroom),
-                            std::pair(3, StoreItem::plant_cattail),
-                            std::pair(4, StoreItem::plant_wintermelon),
-                            std::pair(5, StoreItem::plant_gold_magnet),
-                            std::pair(6, StoreItem::plant_spikerock),
-                            std::pair(7, StoreItem::plant_cobcannon),
-                            std::pair(8, StoreItem::plant_imitater),
-                            std::pair(9, StoreItem::bonus_lawn_mower),
-                            std::pair(10, StoreItem::potted_marigold_1),
-                            std::pair(11, StoreItem::potted_marigold_2),
-                            std::pair(12, StoreItem::potted_marigold_3),
-                            std::pair(13, StoreItem::gold_wateringcan),
-                            std::pair(14, StoreItem::fertilizer),
-                            std::pair(15, StoreItem::bug_spray),
-                            std::pair(16, StoreItem::phonograph),
-                            std::pair(17, StoreItem::gardening_glove),
-                            std::pair(18, StoreItem::mushroom_garden),
-                            std::pair(19, StoreItem::wheel_barrow),
-                            std::pair(20, StoreItem::stinky_the_snail),
-                            std::pair(21, StoreItem::packet_upgrade),
-                            std::pair(22, StoreItem::pool_cleaner),
-                            std::pair(23, StoreItem::roof_cleaner),
-                            std::pair(24, StoreItem::rake),
-                            std::pair(25, StoreItem::aquarium_garden),
-                            std::pair(26, StoreItem::chocolate)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                    else if (k_version < 13)
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, StoreItem>, 31>{
-                            std::pair(0, StoreItem::plant_gatlingpea),
-                            std::pair(1, StoreItem::plant_twinsunflower),
-                            std::pair(2, StoreItem::plant_gloomshroom),
-                            std::pair(3, StoreItem::plant_cattail),
-                            std::pair(4, StoreItem::plant_wintermelon),
-                            std::pair(5, StoreItem::plant_gold_magnet),
-                            std::pair(6, StoreItem::plant_spikerock),
-                            std::pair(7, StoreItem::plant_cobcannon),
-                            std::pair(8, StoreItem::plant_imitater),
-                            std::pair(9, StoreItem::bonus_lawn_mower),
-                            std::pair(10, StoreItem::potted_marigold_1),
-                            std::pair(11, StoreItem::potted_marigold_2),
-                            std::pair(12, StoreItem::potted_marigold_3),
-                            std::pair(13, StoreItem::gold_wateringcan),
-                            std::pair(14, StoreItem::fertilizer),
-                            std::pair(15, StoreItem::bug_spray),
-                            std::pair(16, StoreItem::phonograph),
-                            std::pair(17, StoreItem::gardening_glove),
-                            std::pair(18, StoreItem::mushroom_garden),
-                            std::pair(19, StoreItem::wheel_barrow),
-                            std::pair(20, StoreItem::stinky_the_snail),
-                            std::pair(21, StoreItem::packet_upgrade),
-                            std::pair(22, StoreItem::pool_cleaner),
-                            std::pair(23, StoreItem::roof_cleaner),
-                            std::pair(24, StoreItem::rake),
-                            std::pair(25, StoreItem::aquarium_garden),
-                            std::pair(26, StoreItem::chocolate),
-                            std::pair(27, StoreItem::tree_of_wisdom),
-                            std::pair(28, StoreItem::tree_food),
-                            std::pair(29, StoreItem::firstaid),
-                            std::pair(30, StoreItem::pvz)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                    else if (k_version < 30)
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, StoreItem>, 15>{
-                            std::pair(0, StoreItem::plant_gatlingpea),
-                            std::pair(1, StoreItem::plant_twinsunflower),
-                            std::pair(2, StoreItem::plant_gloomshroom),
-                            std::pair(3, StoreItem::plant_cattail),
-                            std::pair(4, StoreItem::plant_wintermelon),
-                            std::pair(5, StoreItem::plant_gold_magnet),
-                            std::pair(6, StoreItem::plant_spikerock),
-                            std::pair(7, StoreItem::plant_cobcannon),
-                            std::pair(8, StoreItem::plant_imitater),
-                            std::pair(13, StoreItem::packet_upgrade),
-                            std::pair(14, StoreItem::pool_cleaner),
-                            std::pair(15, StoreItem::roof_cleaner),
-                            std::pair(16, StoreItem::rake),
-                            std::pair(17, StoreItem::firstaid),
-                            std::pair(18, StoreItem::pvz)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        constexpr auto value_package = std::array<std::pair<uint8_t, StoreItem>, 44>{
-                            std::pair(0, StoreItem::plant_gatlingpea),
-                            std::pair(1, StoreItem::plant_twinsunflower),
-                            std::pair(2, StoreItem::plant_gloomshroom),
-                            std::pair(3, StoreItem::plant_cattail),
-                            std::pair(4, StoreItem::plant_wintermelon),
-                            std::pair(5, StoreItem::plant_gold_magnet),
-                            std::pair(6, StoreItem::plant_spikerock),
-                            std::pair(7, StoreItem::plant_cobcannon),
-                            std::pair(8, StoreItem::plant_imitater),
-                            std::pair(9, StoreItem::bonus_lawn_mower),
-                            std::pair(10, StoreItem::potted_marigold_1),
-                            std::pair(11, StoreItem::potted_marigold_2),
-                            std::pair(12, StoreItem::potted_marigold_3),
-                            std::pair(13, StoreItem::packet_upgrade),
-                            std::pair(14, StoreItem::pool_cleaner),
-                            std::pair(15, StoreItem::roof_cleaner),
-                            std::pair(16, StoreItem::rake),
-                            std::pair(17, StoreItem::firstaid),
-                            std::pair(18, StoreItem::gold_wateringcan),
-                            std::pair(19, StoreItem::fertilizer),
-                            std::pair(20, StoreItem::bug_spray),
-                            std::pair(21, StoreItem::phonograph),
-                            std::pair(22, StoreItem::gardening_glove),
-                            std::pair(23, StoreItem::mushroom_garden),
-                            std::pair(24, StoreItem::wheel_barrow),
-                            std::pair(25, StoreItem::stinky_the_snail),
-                            std::pair(26, StoreItem::aquarium_garden),
-                            std::pair(27, StoreItem::chocolate),
-                            std::pair(28, StoreItem::basic_giftbox),
-                            std::pair(29, StoreItem::zombotany),
-                            std::pair(30, StoreItem::minigame_pack_1),
-                            std::pair(31, StoreItem::minigame_pack_2),
-                            std::pair(32, StoreItem::minigame_pack_3),
-                            std::pair(33, StoreItem::minigame_pack_4),
-                            std::pair(34, StoreItem::minigame_pack_5),
-                            std::pair(35, StoreItem::i_zombie_pack),
-                            std::pair(36, StoreItem::scary_potter_pack),
-                            std::pair(37, StoreItem::bronze_giftbox),
-                            std::pair(38, StoreItem::silver_giftbox),
-                            std::pair(39, StoreItem::gold_giftbox),
-                            std::pair(40, StoreItem::bacon),
-                            std::pair(41, StoreItem::gold_giftbox),
-                            std::pair(42, StoreItem::last_stand_pack),
-                            std::pair(43, StoreItem::hammer)};
-
-                        //---------------------------------
-                        if constexpr (std::is_same<InputType, uint8_t>::value)
-                        {
-                            static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.first == data; });
-                                it != value_package.end())
-                            {
-                                return it->second;
-                            }
-                        }
-                        if constexpr (std::is_enum<InputType>::value)
-                        {
-                            static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                            if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                       { return element.second == data; });
-                                it != value_package.end())
-                            {
-                                return it->first;
-                            }
-                        }
-                    }
-                }
-            }
-
-            if constexpr (std::is_same<InputType, AchievementId>::value || std::is_same<ReturnType, AchievementId>::value)
-            {
-                if constexpr (std::is_same<ReturnType, size_t>::value)
-                {
-                    if (k_version >= 12)
-                    {
-                        if (k_version < 13)
-                        {
-                            return 20_size;
-                        }
-                        else if (k_version < 30)
-                        {
-                            return 25_size;
-                        }
-                        else
-                        {
-                            return 46_size;
-                        }
-                    }
-                }
-                else
-                {
-                    if (k_version >= 12)
-                    {
-                        if (k_version < 13)
-                        {
-                            constexpr auto value_package = std::array<std::pair<uint8_t, AchievementId>, 20>{
-                                std::pair(0, AchievementId::home_security),
-                                std::pair(1, AchievementId::nobel_peas_prize),
-                                std::pair(2, AchievementId::better_off_dead),
-                                std::pair(3, AchievementId::china_shop),
-                                std::pair(4, AchievementId::spudow),
-                                std::pair(5, AchievementId::explodonator),
-                                std::pair(6, AchievementId::morticulturalist),
-                                std::pair(7, AchievementId::dont_pea),
-                                std::pair(8, AchievementId::roll_some_heads),
-                                std::pair(9, AchievementId::grounded),
-                                std::pair(10, AchievementId::zombologist),
-                                std::pair(11, AchievementId::penny_pincher),
-                                std::pair(12, AchievementId::sunny_days),
-                                std::pair(13, AchievementId::popcorn_party),
-                                std::pair(14, AchievementId::good_morning),
-                                std::pair(15, AchievementId::no_fungus_amongus),
-                                std::pair(16, AchievementId::beyond_the_grave),
-                                std::pair(17, AchievementId::immortal),
-                                std::pair(18, AchievementId::towering_wisdom),
-                                std::pair(19, AchievementId::mustache_mode)};
-
-                            //---------------------------------
-                            if constexpr (std::is_same<InputType, uint8_t>::value)
-                            {
-                                static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                                if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                           { return element.first == data; });
-                                    it != value_package.end())
-                                {
-                                    return it->second;
-                                }
-                            }
-                            if constexpr (std::is_enum<InputType>::value)
-                            {
-                                static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                                if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                           { return element.second == data; });
-                                    it != value_package.end())
-                                {
-                                    return it->first;
-                                }
-                            }
-                        }
-                        else if (k_version < 30)
-                        {
-                            constexpr auto value_package = std::array<std::pair<uint8_t, AchievementId>, 25>{
-                                std::pair(0, AchievementId::home_security),
-                                std::pair(1, AchievementId::spudow),
-                                std::pair(2, AchievementId::explodonator),
-                                std::pair(3, AchievementId::morticulturalist),
-                                std::pair(4, AchievementId::dont_pea),
-                                std::pair(5, AchievementId::roll_some_heads),
-                                std::pair(6, AchievementId::grounded),
-                                std::pair(7, AchievementId::zombologist),
-                                std::pair(8, AchievementId::penny_pincher),
-                                std::pair(9, AchievementId::sunny_days),
-                                std::pair(10, AchievementId::popcorn_party),
-                                std::pair(11, AchievementId::good_morning),
-                                std::pair(12, AchievementId::no_fungus_amongus),
-                                std::pair(13, AchievementId::last_mown_stading),
-                                std::pair(14, AchievementId::below_zero),
-                                std::pair(15, AchievementId::flower_power),
-                                std::pair(16, AchievementId::pyromaniac),
-                                std::pair(17, AchievementId::lawn_mowner_man),
-                                std::pair(18, AchievementId::chill_out),
-                                std::pair(19, AchievementId::defcorn_five),
-                                std::pair(20, AchievementId::monster_mash),
-                                std::pair(21, AchievementId::blind_faith),
-                                std::pair(22, AchievementId::pool_closed),
-                                std::pair(23, AchievementId::melony_lane),
-                                std::pair(24, AchievementId::second_life)};
-
-                            //---------------------------------
-                            if constexpr (std::is_same<InputType, uint8_t>::value)
-                            {
-                                static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                                if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                           { return element.first == data; });
-                                    it != value_package.end())
-                                {
-                                    return it->second;
-                                }
-                            }
-                            if constexpr (std::is_enum<InputType>::value)
-                            {
-                                static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                                if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                           { return element.second == data; });
-                                    it != value_package.end())
-                                {
-                                    return it->first;
-                                }
-                            }
-                        }
-                        else
-                        {
-                            constexpr auto value_package = std::array<std::pair<uint8_t, AchievementId>, 46>{
-                                std::pair(0, AchievementId::home_security),
-                                std::pair(1, AchievementId::spudow),
-                                std::pair(2, AchievementId::explodonator),
-                                std::pair(3, AchievementId::morticulturalist),
-                                std::pair(4, AchievementId::dont_pea),
-                                std::pair(5, AchievementId::roll_some_heads),
-                                std::pair(6, AchievementId::grounded),
-                                std::pair(7, AchievementId::zombologist),
-                                std::pair(8, AchievementId::penny_pincher),
-                                std::pair(9, AchievementId::sunny_days),
-                                std::pair(10, AchievementId::good_morning),
-                                std::pair(11, AchievementId::no_fungus_amongus),
-                                std::pair(12, AchievementId::last_mown_stading),
-                                std::pair(13, AchievementId::below_zero),
-                                std::pair(14, AchievementId::flower_power),
-                                std::pair(15, AchievementId::pyromaniac),
-                                std::pair(16, AchievementId::lawn_mowner_man),
-                                std::pair(17, AchievementId::chill_out),
-                                std::pair(18, AchievementId::defcorn_five),
-                                std::pair(19, AchievementId::monster_mash),
-                                std::pair(20, AchievementId::blind_faith),
-                                std::pair(21, AchievementId::pool_closed),
-                                std::pair(22, AchievementId::melony_lane),
-                                std::pair(23, AchievementId::second_life),
-                                std::pair(24, AchievementId::lucky_spin),
-                                std::pair(25, AchievementId::chilli_free),
-                                std::pair(26, AchievementId::enlightened),
-                                std::pair(27, AchievementId::diamond_beghouler),
-                                std::pair(28, AchievementId::greenfingers),
-                                std::pair(29, AchievementId::wallnot_attack),
-                                std::pair(30, AchievementId::beyond_the_grave),
-                                std::pair(31, AchievementId::peking_express),
-                                std::pair(32, AchievementId::shooting_star),
-                                std::pair(33, AchievementId::sol_invictus),
-                                std::pair(34, AchievementId::sproing_sproing),
-                                std::pair(35, AchievementId::better_off_dead),
-                                std::pair(36, AchievementId::i_win),
-                                std::pair(37, AchievementId::where_the_sun_dont_shine),
-                                std::pair(38, AchievementId::undead_space),
-                                std::pair(39, AchievementId::disco_is_undead),
-                                std::pair(40, AchievementId::china_shop),
-                                std::pair(41, AchievementId::smashing),
-                                std::pair(42, AchievementId::gotcha),
-                                std::pair(43, AchievementId::still_standing),
-                                std::pair(44, AchievementId::the_stuff_of_legends),
-                                std::pair(45, AchievementId::hammer_time)};
-
-                            //---------------------------------
-                            if constexpr (std::is_same<InputType, uint8_t>::value)
-                            {
-                                static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                                if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                           { return element.first == data; });
-                                    it != value_package.end())
-                                {
-                                    return it->second;
-                                }
-                            }
-                            if constexpr (std::is_enum<InputType>::value)
-                            {
-                                static_assert(std::is_same<ReturnType, uint8_t>::value, "Return type must be uint8_t");
-                                if (auto it = std::find_if(value_package.begin(), value_package.end(), [&](auto &element)
-                                                           { return element.second == data; });
-                                    it != value_package.end())
-                                {
-                                    return it->first;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-
-            //------------------------------
-            if constexpr (std::is_same<ReturnType, size_t>::value)
-            {
-                return 0_size;
-            }
-            if constexpr (std::is_same<InputType, uint8_t>::value)
-            {
-                static_assert(std::is_enum<ReturnType>::value, "Return type must be enumeration type");
-                auto type = std::string_view{std::to_string(data)};
-                assert_conditional(false,  String::format(fmt::format("{}", Language::get("miscellaneous.shared.failed_cast_enum_index")), type, magic_enum::enum_type_name<ReturnType>()), "exchange_enumeration");
-            }
+            exchange_list<false, uint32_t>(data, value, [](auto &data, auto &value)
+                                           { data.writeInt32(value); });
+            data.writeNull((key_list_size<Key>() - value.size()) * k_block_size);
+            return;
         }
     };
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "kernel/definition/utility.hpp"
+#include "kernel/support/popcap/player_info/schema.hpp"
 
 namespace Sen::Kernel::Support::PopCap::PlayerInfo
 {
@@ -9,8 +10,6 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
 
     using namespace Sen::Kernel::Support::Miscellaneous::Shared;
 
-    inline static auto k_version = 0;
-
     enum class SeedType : uint8_t
     {
         seed_peashooter = 0,
@@ -360,106 +359,34 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         bool dr_zomboss_revenge;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const MiniGameRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["zombotany"] = nlohmann_json_t.zombotany;
-        if (k_version < 11)
-        {
-            nlohmann_json_j["beghouled"] = nlohmann_json_t.beghouled;
-        }
-        else
-        {
-            if (k_version < 30) {
-                nlohmann_json_j["wallnull_bowling"] = nlohmann_json_t.wallnull_bowling;
-            }
-        }
-        nlohmann_json_j["slot_machine"] = nlohmann_json_t.slot_machine;
-        nlohmann_json_j["raining_seeds"] = nlohmann_json_t.raining_seeds;
-        if (k_version < 11)
-        {
-            nlohmann_json_j["wallnull_bowling"] = nlohmann_json_t.wallnull_bowling;
-        }
-        else
-        {
-            nlohmann_json_j["beghouled"] = nlohmann_json_t.beghouled;
-        }
-        nlohmann_json_j["invisi_ghoul"] = nlohmann_json_t.invisi_ghoul;
-        nlohmann_json_j["seeing_stars"] = nlohmann_json_t.seeing_stars;
-        nlohmann_json_j["zombiquarium"] = nlohmann_json_t.zombiquarium;
-        nlohmann_json_j["beghouled_twist"] = nlohmann_json_t.beghouled_twist;
-        nlohmann_json_j["little_trouble"] = nlohmann_json_t.little_trouble;
-        nlohmann_json_j["portal_combat"] = nlohmann_json_t.portal_combat;
-        nlohmann_json_j["column_like_see_you_em"] = nlohmann_json_t.column_like_see_you_em;
-        nlohmann_json_j["bobsled_bonanza"] = nlohmann_json_t.bobsled_bonanza;
-        nlohmann_json_j["zombie_nimble_zombie_quick"] = nlohmann_json_t.zombie_nimble_zombie_quick;
-        if (k_version < 30) {
-            nlohmann_json_j["whack_a_zombie"] = nlohmann_json_t.whack_a_zombie;
-        }   
-        if (k_version < 11)
-        {
-            nlohmann_json_j["last_stand"] = nlohmann_json_t.last_stand;
-        }
-        else
-        {
-            nlohmann_json_j["last_stand"] = static_cast<bool>(nlohmann_json_t.last_stand);
-        }
-        nlohmann_json_j["zombotany_2"] = nlohmann_json_t.zombotany_2;
-        nlohmann_json_j["wallnut_bowling_2"] = nlohmann_json_t.wallnut_bowling_2;
-        nlohmann_json_j["pogo_party"] = nlohmann_json_t.pogo_party;
-        if (k_version < 30) {
-            nlohmann_json_j["dr_zomboss_revenge"] = nlohmann_json_t.dr_zomboss_revenge;
-        }
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        MiniGameRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("zombotany").get_to(nlohmann_json_t.zombotany);
-        if (k_version < 11)
-        {
-            nlohmann_json_j.at("beghouled").get_to(nlohmann_json_t.beghouled);
-        }
-        else
-        {
-            if (k_version < 30) {
-                nlohmann_json_j.at("wallnull_bowling").get_to(nlohmann_json_t.wallnull_bowling);
-            }
-        }
-        nlohmann_json_j.at("slot_machine").get_to(nlohmann_json_t.slot_machine);
-        nlohmann_json_j.at("raining_seeds").get_to(nlohmann_json_t.raining_seeds);
-        if (k_version < 11)
-        {
-            nlohmann_json_j.at("wallnull_bowling").get_to(nlohmann_json_t.wallnull_bowling);
-        }
-        else
-        {
-            nlohmann_json_j.at("beghouled").get_to(nlohmann_json_t.beghouled);
-        }
-        nlohmann_json_j.at("invisi_ghoul").get_to(nlohmann_json_t.invisi_ghoul);
-        nlohmann_json_j.at("seeing_stars").get_to(nlohmann_json_t.seeing_stars);
-        nlohmann_json_j.at("zombiquarium").get_to(nlohmann_json_t.zombiquarium);
-        nlohmann_json_j.at("beghouled_twist").get_to(nlohmann_json_t.beghouled_twist);
-        nlohmann_json_j.at("little_trouble").get_to(nlohmann_json_t.little_trouble);
-        nlohmann_json_j.at("portal_combat").get_to(nlohmann_json_t.portal_combat);
-        nlohmann_json_j.at("column_like_see_you_em").get_to(nlohmann_json_t.column_like_see_you_em);
-        nlohmann_json_j.at("bobsled_bonanza").get_to(nlohmann_json_t.bobsled_bonanza);
-        nlohmann_json_j.at("zombie_nimble_zombie_quick").get_to(nlohmann_json_t.zombie_nimble_zombie_quick);
-        if (k_version < 30) {
-            nlohmann_json_j.at("whack_a_zombie").get_to(nlohmann_json_t.whack_a_zombie);
-        }
-        nlohmann_json_j.at("last_stand").get_to(nlohmann_json_t.last_stand);
-        nlohmann_json_j.at("zombotany_2").get_to(nlohmann_json_t.zombotany_2);
-        nlohmann_json_j.at("wallnut_bowling_2").get_to(nlohmann_json_t.wallnut_bowling_2);
-        nlohmann_json_j.at("pogo_party").get_to(nlohmann_json_t.pogo_party);
-        if (k_version < 30) {
-            nlohmann_json_j.at("dr_zomboss_revenge").get_to(nlohmann_json_t.dr_zomboss_revenge);
-        }
-        return;
-    }
+    template <>
+    struct Schema<MiniGameRecord>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("zombotany", &MiniGameRecord::zombotany),
+            field("beghouled", &MiniGameRecord::beghouled, until(11)),
+            field("wallnull_bowling", &MiniGameRecord::wallnull_bowling, between(11, 30)),
+            field("slot_machine", &MiniGameRecord::slot_machine),
+            field("raining_seeds", &MiniGameRecord::raining_seeds),
+            field("wallnull_bowling", &MiniGameRecord::wallnull_bowling, until(11)),
+            field("beghouled", &MiniGameRecord::beghouled, since(11)),
+            field("invisi_ghoul", &MiniGameRecord::invisi_ghoul),
+            field("seeing_stars", &MiniGameRecord::seeing_stars),
+            field("zombiquarium", &MiniGameRecord::zombiquarium),
+            field("beghouled_twist", &MiniGameRecord::beghouled_twist),
+            field("little_trouble", &MiniGameRecord::little_trouble),
+            field("portal_combat", &MiniGameRecord::portal_combat),
+            field("column_like_see_you_em", &MiniGameRecord::column_like_see_you_em),
+            field("bobsled_bonanza", &MiniGameRecord::bobsled_bonanza),
+            field("zombie_nimble_zombie_quick", &MiniGameRecord::zombie_nimble_zombie_quick),
+            field("whack_a_zombie", &MiniGameRecord::whack_a_zombie, until(30)),
+            field("last_stand", &MiniGameRecord::last_stand, until(11)),
+            field("last_stand", &MiniGameRecord::last_stand, since(11), FieldKind::boolean),
+            field("zombotany_2", &MiniGameRecord::zombotany_2),
+            field("wallnut_bowling_2", &MiniGameRecord::wallnut_bowling_2),
+            field("pogo_party", &MiniGameRecord::pogo_party),
+            field("dr_zomboss_revenge", &MiniGameRecord::dr_zomboss_revenge, until(30)));
+    };
 
     struct LastStandRecord
     {
@@ -471,31 +398,17 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int endless_flag;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const LastStandRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["day_flag"] = nlohmann_json_t.day_flag;
-        nlohmann_json_j["night_flag"] = nlohmann_json_t.night_flag;
-        nlohmann_json_j["pool_flag"] = nlohmann_json_t.pool_flag;
-        nlohmann_json_j["fog_flag"] = nlohmann_json_t.fog_flag;
-        nlohmann_json_j["roof_flag"] = nlohmann_json_t.roof_flag;
-        nlohmann_json_j["endless_flag"] = nlohmann_json_t.endless_flag;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        LastStandRecord &nlohmann_json_t) -> void
+    template <>
+    struct Schema<LastStandRecord>
     {
-        nlohmann_json_j.at("day_flag").get_to(nlohmann_json_t.day_flag);
-        nlohmann_json_j.at("night_flag").get_to(nlohmann_json_t.night_flag);
-        nlohmann_json_j.at("pool_flag").get_to(nlohmann_json_t.pool_flag);
-        nlohmann_json_j.at("fog_flag").get_to(nlohmann_json_t.fog_flag);
-        nlohmann_json_j.at("roof_flag").get_to(nlohmann_json_t.roof_flag);
-        nlohmann_json_j.at("endless_flag").get_to(nlohmann_json_t.endless_flag);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("day_flag", &LastStandRecord::day_flag),
+            field("night_flag", &LastStandRecord::night_flag),
+            field("pool_flag", &LastStandRecord::pool_flag),
+            field("fog_flag", &LastStandRecord::fog_flag),
+            field("roof_flag", &LastStandRecord::roof_flag),
+            field("endless_flag", &LastStandRecord::endless_flag));
+    };
 
     struct LimboRecord
     {
@@ -522,65 +435,32 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int survival_roof_endless_flag;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const LimboRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["art_challenge_wallnut"] = nlohmann_json_t.art_challenge_wallnut;
-        nlohmann_json_j["sunny_day"] = nlohmann_json_t.sunny_day;
-        nlohmann_json_j["unsodded"] = nlohmann_json_t.unsodded;
-        nlohmann_json_j["big_time"] = nlohmann_json_t.big_time;
-        nlohmann_json_j["art_challenge_sunflower"] = nlohmann_json_t.art_challenge_sunflower;
-        nlohmann_json_j["air_raid"] = nlohmann_json_t.air_raid;
-        nlohmann_json_j["ice_level"] = nlohmann_json_t.ice_level;
-        nlohmann_json_j["zen_garden"] = nlohmann_json_t.zen_garden;
-        nlohmann_json_j["high_gravity"] = nlohmann_json_t.high_gravity;
-        nlohmann_json_j["grave_danger"] = nlohmann_json_t.grave_danger;
-        nlohmann_json_j["can_you_dig_it"] = nlohmann_json_t.can_you_dig_it;
-        nlohmann_json_j["dark_stormy_night"] = nlohmann_json_t.dark_stormy_night;
-        nlohmann_json_j["bungee_blitz"] = nlohmann_json_t.bungee_blitz;
-        nlohmann_json_j["squirrel"] = nlohmann_json_t.squirrel;
-        if (k_version >= 11 && k_version < 13)
-        {
-            nlohmann_json_j["intro"] = nlohmann_json_t.intro;
-            nlohmann_json_j["tree_of_wisdom"] = nlohmann_json_t.tree_of_wisdom;
-            nlohmann_json_j["upsell"] = nlohmann_json_t.upsell;
-        }
-        nlohmann_json_j["survival_day_endless_flag"] = nlohmann_json_t.survival_day_endless_flag;
-        nlohmann_json_j["survival_night_endless_flag"] = nlohmann_json_t.survival_night_endless_flag;
-        nlohmann_json_j["survival_fog_endless_flag"] = nlohmann_json_t.survival_fog_endless_flag;
-        nlohmann_json_j["survival_roof_endless_flag"] = nlohmann_json_t.survival_roof_endless_flag;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        LimboRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("art_challenge_wallnut").get_to(nlohmann_json_t.art_challenge_wallnut);
-        nlohmann_json_j.at("sunny_day").get_to(nlohmann_json_t.sunny_day);
-        nlohmann_json_j.at("unsodded").get_to(nlohmann_json_t.unsodded);
-        nlohmann_json_j.at("big_time").get_to(nlohmann_json_t.big_time);
-        nlohmann_json_j.at("art_challenge_sunflower").get_to(nlohmann_json_t.art_challenge_sunflower);
-        nlohmann_json_j.at("air_raid").get_to(nlohmann_json_t.air_raid);
-        nlohmann_json_j.at("high_gravity").get_to(nlohmann_json_t.high_gravity);
-        nlohmann_json_j.at("grave_danger").get_to(nlohmann_json_t.grave_danger);
-        nlohmann_json_j.at("can_you_dig_it").get_to(nlohmann_json_t.can_you_dig_it);
-        nlohmann_json_j.at("dark_stormy_night").get_to(nlohmann_json_t.dark_stormy_night);
-        nlohmann_json_j.at("bungee_blitz").get_to(nlohmann_json_t.bungee_blitz);
-        nlohmann_json_j.at("squirrel").get_to(nlohmann_json_t.squirrel);
-        if (k_version >= 11 && k_version < 13)
-        {
-            nlohmann_json_j.at("intro").get_to(nlohmann_json_t.intro);
-            nlohmann_json_j.at("tree_of_wisdom").get_to(nlohmann_json_t.tree_of_wisdom);
-            nlohmann_json_j.at("upsell").get_to(nlohmann_json_t.upsell);
-        }
-        nlohmann_json_j.at("survival_day_endless_flag").get_to(nlohmann_json_t.survival_day_endless_flag);
-        nlohmann_json_j.at("survival_night_endless_flag").get_to(nlohmann_json_t.survival_night_endless_flag);
-        nlohmann_json_j.at("survival_fog_endless_flag").get_to(nlohmann_json_t.survival_fog_endless_flag);
-        nlohmann_json_j.at("survival_roof_endless_flag").get_to(nlohmann_json_t.survival_roof_endless_flag);
-        return;
-    }
+    template <>
+    struct Schema<LimboRecord>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("art_challenge_wallnut", &LimboRecord::art_challenge_wallnut),
+            field("sunny_day", &LimboRecord::sunny_day),
+            field("unsodded", &LimboRecord::unsodded),
+            field("big_time", &LimboRecord::big_time),
+            field("art_challenge_sunflower", &LimboRecord::art_challenge_sunflower),
+            field("air_raid", &LimboRecord::air_raid),
+            field("ice_level", &LimboRecord::ice_level),
+            field("zen_garden", &LimboRecord::zen_garden),
+            field("high_gravity", &LimboRecord::high_gravity),
+            field("grave_danger", &LimboRecord::grave_danger),
+            field("can_you_dig_it", &LimboRecord::can_you_dig_it),
+            field("dark_stormy_night", &LimboRecord::dark_stormy_night),
+            field("bungee_blitz", &LimboRecord::bungee_blitz),
+            field("squirrel", &LimboRecord::squirrel),
+            field("intro", &LimboRecord::intro, between(11, 13)),
+            field("tree_of_wisdom", &LimboRecord::tree_of_wisdom, between(11, 13)),
+            field("upsell", &LimboRecord::upsell, between(11, 13)),
+            field("survival_day_endless_flag", &LimboRecord::survival_day_endless_flag),
+            field("survival_night_endless_flag", &LimboRecord::survival_night_endless_flag),
+            field("survival_fog_endless_flag", &LimboRecord::survival_fog_endless_flag),
+            field("survival_roof_endless_flag", &LimboRecord::survival_roof_endless_flag));
+    };
 
     struct PuzzleRecord
     {
@@ -606,59 +486,31 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int i_zombie_endless_flag;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const PuzzleRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["vasebreaker_1"] = nlohmann_json_t.vasebreaker_1;
-        nlohmann_json_j["vasebreaker_2"] = nlohmann_json_t.vasebreaker_2;
-        nlohmann_json_j["vasebreaker_3"] = nlohmann_json_t.vasebreaker_3;
-        nlohmann_json_j["vasebreaker_4"] = nlohmann_json_t.vasebreaker_4;
-        nlohmann_json_j["vasebreaker_5"] = nlohmann_json_t.vasebreaker_5;
-        nlohmann_json_j["vasebreaker_6"] = nlohmann_json_t.vasebreaker_6;
-        nlohmann_json_j["vasebreaker_7"] = nlohmann_json_t.vasebreaker_7;
-        nlohmann_json_j["vasebreaker_8"] = nlohmann_json_t.vasebreaker_8;
-        nlohmann_json_j["vasebreaker_9"] = nlohmann_json_t.vasebreaker_9;
-        nlohmann_json_j["vasebreaker_endless_flag"] = nlohmann_json_t.vasebreaker_endless_flag;
-        nlohmann_json_j["i_zombie_1"] = nlohmann_json_t.i_zombie_1;
-        nlohmann_json_j["i_zombie_2"] = nlohmann_json_t.i_zombie_2;
-        nlohmann_json_j["i_zombie_3"] = nlohmann_json_t.i_zombie_3;
-        nlohmann_json_j["i_zombie_4"] = nlohmann_json_t.i_zombie_4;
-        nlohmann_json_j["i_zombie_5"] = nlohmann_json_t.i_zombie_5;
-        nlohmann_json_j["i_zombie_6"] = nlohmann_json_t.i_zombie_6;
-        nlohmann_json_j["i_zombie_7"] = nlohmann_json_t.i_zombie_7;
-        nlohmann_json_j["i_zombie_8"] = nlohmann_json_t.i_zombie_8;
-        nlohmann_json_j["i_zombie_9"] = nlohmann_json_t.i_zombie_9;
-        nlohmann_json_j["i_zombie_endless_flag"] = nlohmann_json_t.i_zombie_endless_flag;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        PuzzleRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("vasebreaker_1").get_to(nlohmann_json_t.vasebreaker_1);
-        nlohmann_json_j.at("vasebreaker_2").get_to(nlohmann_json_t.vasebreaker_2);
-        nlohmann_json_j.at("vasebreaker_3").get_to(nlohmann_json_t.vasebreaker_3);
-        nlohmann_json_j.at("vasebreaker_4").get_to(nlohmann_json_t.vasebreaker_4);
-        nlohmann_json_j.at("vasebreaker_5").get_to(nlohmann_json_t.vasebreaker_5);
-        nlohmann_json_j.at("vasebreaker_6").get_to(nlohmann_json_t.vasebreaker_6);
-        nlohmann_json_j.at("vasebreaker_7").get_to(nlohmann_json_t.vasebreaker_7);
-        nlohmann_json_j.at("vasebreaker_8").get_to(nlohmann_json_t.vasebreaker_8);
-        nlohmann_json_j.at("vasebreaker_9").get_to(nlohmann_json_t.vasebreaker_9);
-        nlohmann_json_j.at("vasebreaker_endless_flag").get_to(nlohmann_json_t.vasebreaker_endless_flag);
-        nlohmann_json_j.at("i_zombie_1").get_to(nlohmann_json_t.i_zombie_1);
-        nlohmann_json_j.at("i_zombie_2").get_to(nlohmann_json_t.i_zombie_2);
-        nlohmann_json_j.at("i_zombie_3").get_to(nlohmann_json_t.i_zombie_3);
-        nlohmann_json_j.at("i_zombie_4").get_to(nlohmann_json_t.i_zombie_4);
-        nlohmann_json_j.at("i_zombie_5").get_to(nlohmann_json_t.i_zombie_5);
-        nlohmann_json_j.at("i_zombie_6").get_to(nlohmann_json_t.i_zombie_6);
-        nlohmann_json_j.at("i_zombie_7").get_to(nlohmann_json_t.i_zombie_7);
-        nlohmann_json_j.at("i_zombie_8").get_to(nlohmann_json_t.i_zombie_8);
-        nlohmann_json_j.at("i_zombie_9").get_to(nlohmann_json_t.i_zombie_9);
-        nlohmann_json_j.at("i_zombie_endless_flag").get_to(nlohmann_json_t.i_zombie_endless_flag);
-        return;
-    }
+    template <>
+    struct Schema<PuzzleRecord>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("vasebreaker_1", &PuzzleRecord::vasebreaker_1),
+            field("vasebreaker_2", &PuzzleRecord::vasebreaker_2),
+            field("vasebreaker_3", &PuzzleRecord::vasebreaker_3),
+            field("vasebreaker_4", &PuzzleRecord::vasebreaker_4),
+            field("vasebreaker_5", &PuzzleRecord::vasebreaker_5),
+            field("vasebreaker_6", &PuzzleRecord::vasebreaker_6),
+            field("vasebreaker_7", &PuzzleRecord::vasebreaker_7),
+            field("vasebreaker_8", &PuzzleRecord::vasebreaker_8),
+            field("vasebreaker_9", &PuzzleRecord::vasebreaker_9),
+            field("vasebreaker_endless_flag", &PuzzleRecord::vasebreaker_endless_flag),
+            field("i_zombie_1", &PuzzleRecord::i_zombie_1),
+            field("i_zombie_2", &PuzzleRecord::i_zombie_2),
+            field("i_zombie_3", &PuzzleRecord::i_zombie_3),
+            field("i_zombie_4", &PuzzleRecord::i_zombie_4),
+            field("i_zombie_5", &PuzzleRecord::i_zombie_5),
+            field("i_zombie_6", &PuzzleRecord::i_zombie_6),
+            field("i_zombie_7", &PuzzleRecord::i_zombie_7),
+            field("i_zombie_8", &PuzzleRecord::i_zombie_8),
+            field("i_zombie_9", &PuzzleRecord::i_zombie_9),
+            field("i_zombie_endless_flag", &PuzzleRecord::i_zombie_endless_flag));
+    };
 
     struct SurvivalRecord
     {
@@ -675,41 +527,22 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int survival_endless_flag;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const SurvivalRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["day_normal_flag"] = nlohmann_json_t.day_normal_flag;
-        nlohmann_json_j["night_normal_flag"] = nlohmann_json_t.night_normal_flag;
-        nlohmann_json_j["pool_normal_flag"] = nlohmann_json_t.pool_normal_flag;
-        nlohmann_json_j["fog_normal_flag"] = nlohmann_json_t.fog_normal_flag;
-        nlohmann_json_j["roof_normal_flag"] = nlohmann_json_t.roof_normal_flag;
-        nlohmann_json_j["day_hard_flag"] = nlohmann_json_t.day_hard_flag;
-        nlohmann_json_j["night_hard_flag"] = nlohmann_json_t.night_hard_flag;
-        nlohmann_json_j["pool_hard_flag"] = nlohmann_json_t.pool_hard_flag;
-        nlohmann_json_j["fog_hard_flag"] = nlohmann_json_t.fog_hard_flag;
-        nlohmann_json_j["roof_hard_flag"] = nlohmann_json_t.roof_hard_flag;
-        nlohmann_json_j["survival_endless_flag"] = nlohmann_json_t.survival_endless_flag;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        SurvivalRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("day_normal_flag").get_to(nlohmann_json_t.day_normal_flag);
-        nlohmann_json_j.at("night_normal_flag").get_to(nlohmann_json_t.night_normal_flag);
-        nlohmann_json_j.at("pool_normal_flag").get_to(nlohmann_json_t.pool_normal_flag);
-        nlohmann_json_j.at("fog_normal_flag").get_to(nlohmann_json_t.fog_normal_flag);
-        nlohmann_json_j.at("roof_normal_flag").get_to(nlohmann_json_t.roof_normal_flag);
-        nlohmann_json_j.at("day_hard_flag").get_to(nlohmann_json_t.day_hard_flag);
-        nlohmann_json_j.at("night_hard_flag").get_to(nlohmann_json_t.night_hard_flag);
-        nlohmann_json_j.at("pool_hard_flag").get_to(nlohmann_json_t.pool_hard_flag);
-        nlohmann_json_j.at("fog_hard_flag").get_to(nlohmann_json_t.fog_hard_flag);
-        nlohmann_json_j.at("roof_hard_flag").get_to(nlohmann_json_t.roof_hard_flag);
-        nlohmann_json_j.at("survival_endless_flag").get_to(nlohmann_json_t.survival_endless_flag);
-        return;
-    }
+    template <>
+    struct Schema<SurvivalRecord>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("day_normal_flag", &SurvivalRecord::day_normal_flag),
+            field("night_normal_flag", &SurvivalRecord::night_normal_flag),
+            field("pool_normal_flag", &SurvivalRecord::pool_normal_flag),
+            field("fog_normal_flag", &SurvivalRecord::fog_normal_flag),
+            field("roof_normal_flag", &SurvivalRecord::roof_normal_flag),
+            field("day_hard_flag", &SurvivalRecord::day_hard_flag),
+            field("night_hard_flag", &SurvivalRecord::night_hard_flag),
+            field("pool_hard_flag", &SurvivalRecord::pool_hard_flag),
+            field("fog_hard_flag", &SurvivalRecord::fog_hard_flag),
+            field("roof_hard_flag", &SurvivalRecord::roof_hard_flag),
+            field("survival_endless_flag", &SurvivalRecord::survival_endless_flag));
+    };
 
     struct ChallengeRecord
     {
@@ -720,41 +553,16 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         LimboRecord canceled_minigame;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const ChallengeRecord &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["minigame"] = nlohmann_json_t.minigame;
-        nlohmann_json_j["puzzle"] = nlohmann_json_t.puzzle;
-        nlohmann_json_j["survival"] = nlohmann_json_t.survival;
-        if (k_version >= 30)
-        {
-            nlohmann_json_j["last_stand"] = nlohmann_json_t.last_stand;
-        }
-        if (k_version < 13)
-        {
-            nlohmann_json_j["canceled_minigame"] = nlohmann_json_t.canceled_minigame;
-        }
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        ChallengeRecord &nlohmann_json_t) -> void
+    template <>
+    struct Schema<ChallengeRecord>
     {
-        nlohmann_json_j.at("minigame").get_to(nlohmann_json_t.minigame);
-        nlohmann_json_j.at("puzzle").get_to(nlohmann_json_t.puzzle);
-        nlohmann_json_j.at("survival").get_to(nlohmann_json_t.survival);
-        if (k_version >= 30)
-        {
-            nlohmann_json_j.at("last_stand").get_to(nlohmann_json_t.last_stand);
-        }
-        if (k_version < 13)
-        {
-            nlohmann_json_j.at("canceled_minigame").get_to(nlohmann_json_t.canceled_minigame);
-        }
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("minigame", &ChallengeRecord::minigame),
+            field("puzzle", &ChallengeRecord::puzzle),
+            field("survival", &ChallengeRecord::survival),
+            field("last_stand", &ChallengeRecord::last_stand, since(30)),
+            field("canceled_minigame", &ChallengeRecord::canceled_minigame, until(13)));
+    };
 
     struct Unlocked
     {
@@ -767,31 +575,17 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         bool first_time_play_survival;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const Unlocked &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["minigame"] = nlohmann_json_t.minigame;
-        nlohmann_json_j["puzzle_mode"] = nlohmann_json_t.puzzle_mode;
-        nlohmann_json_j["first_time_play_minigame"] = nlohmann_json_t.first_time_play_minigame;
-        nlohmann_json_j["first_time_play_i_zombie"] = nlohmann_json_t.first_time_play_i_zombie;
-        nlohmann_json_j["first_time_play_vasebreaker"] = nlohmann_json_t.first_time_play_vasebreaker;
-        nlohmann_json_j["first_time_play_survival"] = nlohmann_json_t.first_time_play_survival;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        Unlocked &nlohmann_json_t) -> void
+    template <>
+    struct Schema<Unlocked>
     {
-        nlohmann_json_j.at("minigame").get_to(nlohmann_json_t.minigame);
-        nlohmann_json_j.at("puzzle_mode").get_to(nlohmann_json_t.puzzle_mode);
-        nlohmann_json_j.at("first_time_play_minigame").get_to(nlohmann_json_t.first_time_play_minigame);
-        nlohmann_json_j.at("first_time_play_i_zombie").get_to(nlohmann_json_t.first_time_play_i_zombie);
-        nlohmann_json_j.at("first_time_play_vasebreaker").get_to(nlohmann_json_t.first_time_play_vasebreaker);
-        nlohmann_json_j.at("first_time_play_survival").get_to(nlohmann_json_t.first_time_play_survival);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("minigame", &Unlocked::minigame),
+            field("puzzle_mode", &Unlocked::puzzle_mode),
+            field("first_time_play_minigame", &Unlocked::first_time_play_minigame),
+            field("first_time_play_i_zombie", &Unlocked::first_time_play_i_zombie),
+            field("first_time_play_vasebreaker", &Unlocked::first_time_play_vasebreaker),
+            field("first_time_play_survival", &Unlocked::first_time_play_survival));
+    };
 
     struct General
     {
@@ -805,36 +599,19 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         bool has_magic_taco_reward;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const General &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["adventure_level"] = nlohmann_json_t.adventure_level;
-        nlohmann_json_j["coins"] = nlohmann_json_t.coins;
-        nlohmann_json_j["adventure_compeled"] = nlohmann_json_t.adventure_compeled;
-        nlohmann_json_j["completed_adventure_time"] = nlohmann_json_t.completed_adventure_time;
-        nlohmann_json_j["player_time_active_player"] = nlohmann_json_t.player_time_active_player;
-        nlohmann_json_j["player_time_inactive_player"] = nlohmann_json_t.player_time_inactive_player;
-        nlohmann_json_j["place_holder_player_stats"] = nlohmann_json_t.place_holder_player_stats;
-        // nlohmann_json_j["need_message_on_game_selector"] = nlohmann_json_t.need_message_on_game_selector;
-        nlohmann_json_j["has_magic_taco_reward"] = nlohmann_json_t.has_magic_taco_reward;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        General &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("adventure_level").get_to(nlohmann_json_t.adventure_level);
-        nlohmann_json_j.at("coins").get_to(nlohmann_json_t.coins);
-        nlohmann_json_j.at("adventure_compeled").get_to(nlohmann_json_t.adventure_compeled);
-        nlohmann_json_j.at("completed_adventure_time").get_to(nlohmann_json_t.completed_adventure_time);
-        nlohmann_json_j.at("player_time_active_player").get_to(nlohmann_json_t.player_time_active_player);
-        nlohmann_json_j.at("player_time_inactive_player").get_to(nlohmann_json_t.player_time_inactive_player);
-        nlohmann_json_j.at("place_holder_player_stats").get_to(nlohmann_json_t.place_holder_player_stats);
-        nlohmann_json_j.at("has_magic_taco_reward").get_to(nlohmann_json_t.has_magic_taco_reward);
-        return;
-    }
+    template <>
+    struct Schema<General>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("adventure_level", &General::adventure_level),
+            field("coins", &General::coins),
+            field("adventure_compeled", &General::adventure_compeled),
+            field("completed_adventure_time", &General::completed_adventure_time),
+            field("player_time_active_player", &General::player_time_active_player),
+            field("player_time_inactive_player", &General::player_time_inactive_player),
+            field("place_holder_player_stats", &General::place_holder_player_stats),
+            field("has_magic_taco_reward", &General::has_magic_taco_reward));
+    };
 
     struct StinkyInfo
     { 
@@ -844,26 +621,14 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         // int has_seen_upsell; // unknown.
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const StinkyInfo &nlohmann_json_t) -> void
+    template <>
+    struct Schema<StinkyInfo>
     {
-        nlohmann_json_j["sleeping"] = nlohmann_json_t.sleeping;
-        nlohmann_json_j["last_awoken"] = nlohmann_json_t.last_awoken;
-        nlohmann_json_j["last_chocolate"] = nlohmann_json_t.last_chocolate;
-        // nlohmann_json_j["has_seen_upsell"] = nlohmann_json_t.has_seen_upsell;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        StinkyInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("sleeping").get_to(nlohmann_json_t.sleeping);
-        nlohmann_json_j.at("last_awoken").get_to(nlohmann_json_t.last_awoken);
-        nlohmann_json_j.at("last_chocolate").get_to(nlohmann_json_t.last_chocolate);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("sleeping", &StinkyInfo::sleeping),
+            field("last_awoken", &StinkyInfo::last_awoken),
+            field("last_chocolate", &StinkyInfo::last_chocolate));
+    };
 
     struct Position
     {
@@ -871,23 +636,13 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int y;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const Position &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["x"] = nlohmann_json_t.x;
-        nlohmann_json_j["y"] = nlohmann_json_t.y;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        Position &nlohmann_json_t) -> void
+    template <>
+    struct Schema<Position>
     {
-        nlohmann_json_j.at("x").get_to(nlohmann_json_t.x);
-        nlohmann_json_j.at("y").get_to(nlohmann_json_t.y);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("x", &Position::x),
+            field("y", &Position::y));
+    };
 
     struct StinkyTheSnail
     {
@@ -896,25 +651,14 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         Position position;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const StinkyTheSnail &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["purchased"] = nlohmann_json_t.purchased;
-        nlohmann_json_j["status"] = nlohmann_json_t.status;
-        nlohmann_json_j["position"] = nlohmann_json_t.position;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        StinkyTheSnail &nlohmann_json_t) -> void
+    template <>
+    struct Schema<StinkyTheSnail>
     {
-        nlohmann_json_j.at("purchased").get_to(nlohmann_json_t.purchased);
-        nlohmann_json_j.at("status").get_to(nlohmann_json_t.status);
-        nlohmann_json_j.at("position").get_to(nlohmann_json_t.position);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("purchased", &StinkyTheSnail::purchased),
+            field("status", &StinkyTheSnail::status),
+            field("position", &StinkyTheSnail::position));
+    };
 
     struct PottedPlantTime
     {
@@ -924,27 +668,15 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int last_chocolate_time;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const PottedPlantTime &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["last_watered_time"] = nlohmann_json_t.last_watered_time;
-        nlohmann_json_j["last_need_ful_filled_time"] = nlohmann_json_t.last_need_ful_filled_time;
-        nlohmann_json_j["last_fertilized_time"] = nlohmann_json_t.last_fertilized_time;
-        nlohmann_json_j["last_chocolate_time"] = nlohmann_json_t.last_chocolate_time;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        PottedPlantTime &nlohmann_json_t) -> void
+    template <>
+    struct Schema<PottedPlantTime>
     {
-        nlohmann_json_j.at("last_watered_time").get_to(nlohmann_json_t.last_watered_time);
-        nlohmann_json_j.at("last_need_ful_filled_time").get_to(nlohmann_json_t.last_need_ful_filled_time);
-        nlohmann_json_j.at("last_fertilized_time").get_to(nlohmann_json_t.last_fertilized_time);
-        nlohmann_json_j.at("last_chocolate_time").get_to(nlohmann_json_t.last_chocolate_time);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("last_watered_time", &PottedPlantTime::last_watered_time),
+            field("last_need_ful_filled_time", &PottedPlantTime::last_need_ful_filled_time),
+            field("last_fertilized_time", &PottedPlantTime::last_fertilized_time),
+            field("last_chocolate_time", &PottedPlantTime::last_chocolate_time));
+    };
 
     struct PottedPlantInfo
     {
@@ -959,35 +691,18 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         // int future_attribute;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const PottedPlantInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["orientation"] = magic_enum::enum_name(nlohmann_json_t.orientation);
-        nlohmann_json_j["color"] = magic_enum::enum_name(nlohmann_json_t.color);
-        nlohmann_json_j["plant_age"] = magic_enum::enum_name(nlohmann_json_t.plant_age);
-        nlohmann_json_j["plant_need"] = magic_enum::enum_name(nlohmann_json_t.plant_need);
-        // nlohmann_json_j["num_of_time_fertilized"] = nlohmann_json_t.num_of_time_fertilized;
-        nlohmann_json_j["num_of_time_watered"] = nlohmann_json_t.num_of_time_watered;
-        nlohmann_json_j["feeding_pre_grow"] = nlohmann_json_t.feeding_pre_grow;
-        nlohmann_json_j["time"] = nlohmann_json_t.time;
-        // nlohmann_json_j["future_attribute"] = nlohmann_json_t.future_attribute;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        PottedPlantInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_t.orientation = magic_enum_cast<FacingDirection>(nlohmann_json_j.at("orientation").get<std::string>());
-        nlohmann_json_t.color = magic_enum_cast<DrawVariation>(nlohmann_json_j.at("color").get<std::string>());
-        nlohmann_json_t.plant_age = magic_enum_cast<PottedPlantAge>(nlohmann_json_j.at("plant_age").get<std::string>());
-        nlohmann_json_t.plant_need = magic_enum_cast<PottedPlantNeed>(nlohmann_json_j.at("plant_need").get<std::string>());
-        nlohmann_json_j.at("num_of_time_watered").get_to(nlohmann_json_t.num_of_time_watered);
-        nlohmann_json_j.at("feeding_pre_grow").get_to(nlohmann_json_t.feeding_pre_grow);
-        nlohmann_json_j.at("time").get_to(nlohmann_json_t.time);
-        return;
-    }
+    template <>
+    struct Schema<PottedPlantInfo>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("orientation", &PottedPlantInfo::orientation),
+            field("color", &PottedPlantInfo::color),
+            field("plant_age", &PottedPlantInfo::plant_age),
+            field("plant_need", &PottedPlantInfo::plant_need),
+            field("num_of_time_watered", &PottedPlantInfo::num_of_time_watered),
+            field("feeding_pre_grow", &PottedPlantInfo::feeding_pre_grow),
+            field("time", &PottedPlantInfo::time));
+    };
 
     struct PottedPlant
     {
@@ -997,27 +712,15 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         PottedPlantInfo plant_status;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const PottedPlant &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["seed_type"] = magic_enum::enum_name(nlohmann_json_t.seed_type);
-        nlohmann_json_j["location"] = magic_enum::enum_name(nlohmann_json_t.location);
-        nlohmann_json_j["position"] = nlohmann_json_t.position;
-        nlohmann_json_j["plant_status"] = nlohmann_json_t.plant_status;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        PottedPlant &nlohmann_json_t) -> void
+    template <>
+    struct Schema<PottedPlant>
     {
-        nlohmann_json_t.seed_type = magic_enum_cast<SeedType>(nlohmann_json_j.at("seed_type").get<std::string>());
-        nlohmann_json_t.location = magic_enum_cast<GerdenType>(nlohmann_json_j.at("location").get<std::string>());
-        nlohmann_json_j.at("position").get_to(nlohmann_json_t.position);
-        nlohmann_json_j.at("plant_status").get_to(nlohmann_json_t.plant_status);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("seed_type", &PottedPlant::seed_type),
+            field("location", &PottedPlant::location),
+            field("position", &PottedPlant::position),
+            field("plant_status", &PottedPlant::plant_status));
+    };
 
     struct ZenGardenPurchased
     {
@@ -1042,60 +745,27 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         bool aquarium_garden;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const ZenGardenPurchased &nlohmann_json_t) -> void
-    {
-        if (k_version >= 30)
-        {
-            nlohmann_json_j["last_purchsed_basic_giftbox_time"] = nlohmann_json_t.last_purchsed_basic_giftbox_time;
-            nlohmann_json_j["last_purchsed_bronze_giftboxtime"] = nlohmann_json_t.last_purchsed_bronze_giftboxtime;
-            nlohmann_json_j["last_purchsed_silver_giftbox_time"] = nlohmann_json_t.last_purchsed_silver_giftbox_time;
-            nlohmann_json_j["last_purchsed_gold_giftbox_time"] = nlohmann_json_t.last_purchsed_gold_giftbox_time;
-        }
-        //  nlohmann_json_j["potted_marigold_1"] = nlohmann_json_t.potted_marigold_1;
-        nlohmann_json_j["last_purchesed_marigold_1_time"] = nlohmann_json_t.last_purchesed_marigold_1_time;
-        //   nlohmann_json_j["potted_marigold_2"] = nlohmann_json_t.potted_marigold_2;
-        nlohmann_json_j["last_purchesed_marigold_2_time"] = nlohmann_json_t.last_purchesed_marigold_2_time;
-        //  nlohmann_json_j["potted_marigold_3"] = nlohmann_json_t.potted_marigold_3;
-        nlohmann_json_j["last_purchesed_marigold_3_time"] = nlohmann_json_t.last_purchesed_marigold_3_time;
-        nlohmann_json_j["fertilizer"] = nlohmann_json_t.fertilizer;
-        nlohmann_json_j["bug_spray"] = nlohmann_json_t.bug_spray;
-        nlohmann_json_j["chocolate"] = nlohmann_json_t.chocolate;
-        nlohmann_json_j["gold_watering_can"] = nlohmann_json_t.gold_watering_can;
-        nlohmann_json_j["phonograph"] = nlohmann_json_t.phonograph;
-        nlohmann_json_j["gardening_glove"] = nlohmann_json_t.gardening_glove;
-        nlohmann_json_j["mushroom_garden"] = nlohmann_json_t.mushroom_garden;
-        nlohmann_json_j["wheel_barrow"] = nlohmann_json_t.wheel_barrow;
-        nlohmann_json_j["aquarium_garden"] = nlohmann_json_t.aquarium_garden;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        ZenGardenPurchased &nlohmann_json_t) -> void
-    {
-        if (k_version >= 30)
-        {
-            nlohmann_json_j.at("last_purchsed_basic_giftbox_time").get_to(nlohmann_json_t.last_purchsed_basic_giftbox_time);
-            nlohmann_json_j.at("last_purchsed_bronze_giftboxtime").get_to(nlohmann_json_t.last_purchsed_bronze_giftboxtime);
-            nlohmann_json_j.at("last_purchsed_silver_giftbox_time").get_to(nlohmann_json_t.last_purchsed_silver_giftbox_time);
-            nlohmann_json_j.at("last_purchsed_gold_giftbox_time").get_to(nlohmann_json_t.last_purchsed_gold_giftbox_time);
-        }
-        nlohmann_json_j.at("last_purchesed_marigold_1_time").get_to(nlohmann_json_t.last_purchesed_marigold_1_time);
-        nlohmann_json_j.at("last_purchesed_marigold_2_time").get_to(nlohmann_json_t.last_purchesed_marigold_2_time);
-        nlohmann_json_j.at("last_purchesed_marigold_3_time").get_to(nlohmann_json_t.last_purchesed_marigold_3_time);
-        nlohmann_json_j.at("fertilizer").get_to(nlohmann_json_t.fertilizer);
-        nlohmann_json_j.at("bug_spray").get_to(nlohmann_json_t.bug_spray);
-        nlohmann_json_j.at("chocolate").get_to(nlohmann_json_t.chocolate);
-        nlohmann_json_j.at("gold_watering_can").get_to(nlohmann_json_t.gold_watering_can);
-        nlohmann_json_j.at("phonograph").get_to(nlohmann_json_t.phonograph);
-        nlohmann_json_j.at("gardening_glove").get_to(nlohmann_json_t.gardening_glove);
-        nlohmann_json_j.at("mushroom_garden").get_to(nlohmann_json_t.mushroom_garden);
-        nlohmann_json_j.at("wheel_barrow").get_to(nlohmann_json_t.wheel_barrow);
-        nlohmann_json_j.at("aquarium_garden").get_to(nlohmann_json_t.aquarium_garden);
-        return;
-    }
+    template <>
+    struct Schema<ZenGardenPurchased>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("last_purchsed_basic_giftbox_time", &ZenGardenPurchased::last_purchsed_basic_giftbox_time, since(30)),
+            field("last_purchsed_bronze_giftboxtime", &ZenGardenPurchased::last_purchsed_bronze_giftboxtime, since(30)),
+            field("last_purchsed_silver_giftbox_time", &ZenGardenPurchased::last_purchsed_silver_giftbox_time, since(30)),
+            field("last_purchsed_gold_giftbox_time", &ZenGardenPurchased::last_purchsed_gold_giftbox_time, since(30)),
+            field("last_purchesed_marigold_1_time", &ZenGardenPurchased::last_purchesed_marigold_1_time),
+            field("last_purchesed_marigold_2_time", &ZenGardenPurchased::last_purchesed_marigold_2_time),
+            field("last_purchesed_marigold_3_time", &ZenGardenPurchased::last_purchesed_marigold_3_time),
+            field("fertilizer", &ZenGardenPurchased::fertilizer),
+            field("bug_spray", &ZenGardenPurchased::bug_spray),
+            field("chocolate", &ZenGardenPurchased::chocolate),
+            field("gold_watering_can", &ZenGardenPurchased::gold_watering_can),
+            field("phonograph", &ZenGardenPurchased::phonograph),
+            field("gardening_glove", &ZenGardenPurchased::gardening_glove),
+            field("mushroom_garden", &ZenGardenPurchased::mushroom_garden),
+            field("wheel_barrow", &ZenGardenPurchased::wheel_barrow),
+            field("aquarium_garden", &ZenGardenPurchased::aquarium_garden));
+    };
 
     struct TreeOfWisdom
     {
@@ -1104,25 +774,14 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int tree_food;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const TreeOfWisdom &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["purchased"] = nlohmann_json_t.purchased;
-        nlohmann_json_j["height"] = nlohmann_json_t.height;
-        nlohmann_json_j["tree_food"] = nlohmann_json_t.tree_food;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        TreeOfWisdom &nlohmann_json_t) -> void
+    template <>
+    struct Schema<TreeOfWisdom>
     {
-        nlohmann_json_j.at("purchased").get_to(nlohmann_json_t.purchased);
-        nlohmann_json_j.at("height").get_to(nlohmann_json_t.height);
-        nlohmann_json_j.at("tree_food").get_to(nlohmann_json_t.tree_food);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("purchased", &TreeOfWisdom::purchased),
+            field("height", &TreeOfWisdom::height),
+            field("tree_food", &TreeOfWisdom::tree_food));
+    };
 
     struct ZenGarden
     {
@@ -1132,37 +791,15 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         std::vector<PottedPlant> potted_plants;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const ZenGarden &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["stinky"] = nlohmann_json_t.stinky;
-        if (k_version >= 11)
-        {
-            nlohmann_json_j["tree_of_wisdom"] = nlohmann_json_t.tree_of_wisdom;
-        }
-        else
-        {
-            nlohmann_json_j["tree_of_wisdom"] = nullptr;
-        }
-        nlohmann_json_j["purchased"] = nlohmann_json_t.purchased;
-        nlohmann_json_j["potted_plants"] = nlohmann_json_t.potted_plants;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        ZenGarden &nlohmann_json_t) -> void
+    template <>
+    struct Schema<ZenGarden>
     {
-        nlohmann_json_j.at("stinky").get_to(nlohmann_json_t.stinky);
-        if (k_version >= 11)
-        {
-            nlohmann_json_j.at("tree_of_wisdom").get_to(nlohmann_json_t.tree_of_wisdom);
-        }
-        nlohmann_json_j.at("purchased").get_to(nlohmann_json_t.purchased);
-        nlohmann_json_j.at("potted_plants").get_to(nlohmann_json_t.potted_plants);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("stinky", &ZenGarden::stinky),
+            field("tree_of_wisdom", &ZenGarden::tree_of_wisdom, since(11), FieldKind::nullable),
+            field("purchased", &ZenGarden::purchased),
+            field("potted_plants", &ZenGarden::potted_plants));
+    };
 
     struct StorePurchased
     {
@@ -1192,77 +829,34 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         bool bacon_2;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const StorePurchased &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["pool_cleaner"] = nlohmann_json_t.pool_cleaner;
-        nlohmann_json_j["roof_cleaner"] = nlohmann_json_t.roof_cleaner;
-        if (k_version >= 11)
-        {
-            nlohmann_json_j["first_aid"] = nlohmann_json_t.first_aid;
-        }
-        nlohmann_json_j["plant_gatling_pea"] = nlohmann_json_t.plant_gatling_pea;
-        nlohmann_json_j["plant_twin_sunflower"] = nlohmann_json_t.plant_twin_sunflower;
-        nlohmann_json_j["plant_gloomshroom"] = nlohmann_json_t.plant_gloomshroom;
-        nlohmann_json_j["plant_cattail"] = nlohmann_json_t.plant_cattail;
-        nlohmann_json_j["plant_winter_melon"] = nlohmann_json_t.plant_winter_melon;
-        nlohmann_json_j["plant_gold_magnet"] = nlohmann_json_t.plant_gold_magnet;
-        nlohmann_json_j["plant_sprike_rock"] = nlohmann_json_t.plant_sprike_rock;
-        nlohmann_json_j["plant_cob_cannon"] = nlohmann_json_t.plant_cob_cannon;
-        nlohmann_json_j["plant_imitater"] = nlohmann_json_t.plant_imitater;
-        if (k_version >= 30)
-        {
-            nlohmann_json_j["zombotany"] = nlohmann_json_t.zombotany;
-            nlohmann_json_j["minigame_pack_1"] = nlohmann_json_t.minigame_pack_1;
-            nlohmann_json_j["minigame_pack_2"] = nlohmann_json_t.minigame_pack_2;
-            nlohmann_json_j["minigame_pack_3"] = nlohmann_json_t.minigame_pack_3;
-            nlohmann_json_j["minigame_pack_4"] = nlohmann_json_t.minigame_pack_4;
-            nlohmann_json_j["minigame_pack_5"] = nlohmann_json_t.minigame_pack_5;
-            nlohmann_json_j["i_zombie_pack"] = nlohmann_json_t.i_zombie_pack;
-            nlohmann_json_j["scary_potter_pack"] = nlohmann_json_t.scary_potter_pack;
-            nlohmann_json_j["last_stand_pack"] = nlohmann_json_t.last_stand_pack;
-            nlohmann_json_j["bacon"] = nlohmann_json_t.bacon;
-            nlohmann_json_j["bacon_2"] = nlohmann_json_t.bacon_2;
-        }
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        StorePurchased &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("pool_cleaner").get_to(nlohmann_json_t.pool_cleaner);
-        nlohmann_json_j.at("roof_cleaner").get_to(nlohmann_json_t.roof_cleaner);
-        if (k_version >= 11)
-        {
-            nlohmann_json_j.at("first_aid").get_to(nlohmann_json_t.first_aid);
-        }
-        nlohmann_json_j.at("plant_gatling_pea").get_to(nlohmann_json_t.plant_gatling_pea);
-        nlohmann_json_j.at("plant_twin_sunflower").get_to(nlohmann_json_t.plant_twin_sunflower);
-        nlohmann_json_j.at("plant_gloomshroom").get_to(nlohmann_json_t.plant_gloomshroom);
-        nlohmann_json_j.at("plant_cattail").get_to(nlohmann_json_t.plant_cattail);
-        nlohmann_json_j.at("plant_winter_melon").get_to(nlohmann_json_t.plant_winter_melon);
-        nlohmann_json_j.at("plant_gold_magnet").get_to(nlohmann_json_t.plant_gold_magnet);
-        nlohmann_json_j.at("plant_sprike_rock").get_to(nlohmann_json_t.plant_sprike_rock);
-        nlohmann_json_j.at("plant_cob_cannon").get_to(nlohmann_json_t.plant_cob_cannon);
-        nlohmann_json_j.at("plant_imitater").get_to(nlohmann_json_t.plant_imitater);
-        if (k_version >= 30)
-        {
-            nlohmann_json_j.at("zombotany").get_to(nlohmann_json_t.zombotany);
-            nlohmann_json_j.at("minigame_pack_1").get_to(nlohmann_json_t.minigame_pack_1);
-            nlohmann_json_j.at("minigame_pack_2").get_to(nlohmann_json_t.minigame_pack_2);
-            nlohmann_json_j.at("minigame_pack_3").get_to(nlohmann_json_t.minigame_pack_3);
-            nlohmann_json_j.at("minigame_pack_4").get_to(nlohmann_json_t.minigame_pack_4);
-            nlohmann_json_j.at("minigame_pack_5").get_to(nlohmann_json_t.minigame_pack_5);
-            nlohmann_json_j.at("i_zombie_pack").get_to(nlohmann_json_t.i_zombie_pack);
-            nlohmann_json_j.at("scary_potter_pack").get_to(nlohmann_json_t.scary_potter_pack);
-            nlohmann_json_j.at("last_stand_pack").get_to(nlohmann_json_t.last_stand_pack);
-            nlohmann_json_j.at("bacon").get_to(nlohmann_json_t.bacon);
-            nlohmann_json_j.at("bacon_2").get_to(nlohmann_json_t.bacon_2);
-        }
-        return;
-    }
+    template <>
+    struct Schema<StorePurchased>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("pool_cleaner", &StorePurchased::pool_cleaner),
+            field("roof_cleaner", &StorePurchased::roof_cleaner),
+            field("first_aid", &StorePurchased::first_aid, since(11)),
+            field("plant_gatling_pea", &StorePurchased::plant_gatling_pea),
+            field("plant_twin_sunflower", &StorePurchased::plant_twin_sunflower),
+            field("plant_gloomshroom", &StorePurchased::plant_gloomshroom),
+            field("plant_cattail", &StorePurchased::plant_cattail),
+            field("plant_winter_melon", &StorePurchased::plant_winter_melon),
+            field("plant_gold_magnet", &StorePurchased::plant_gold_magnet),
+            field("plant_sprike_rock", &StorePurchased::plant_sprike_rock),
+            field("plant_cob_cannon", &StorePurchased::plant_cob_cannon),
+            field("plant_imitater", &StorePurchased::plant_imitater),
+            field("zombotany", &StorePurchased::zombotany, since(30)),
+            field("minigame_pack_1", &StorePurchased::minigame_pack_1, since(30)),
+            field("minigame_pack_2", &StorePurchased::minigame_pack_2, since(30)),
+            field("minigame_pack_3", &StorePurchased::minigame_pack_3, since(30)),
+            field("minigame_pack_4", &StorePurchased::minigame_pack_4, since(30)),
+            field("minigame_pack_5", &StorePurchased::minigame_pack_5, since(30)),
+            field("i_zombie_pack", &StorePurchased::i_zombie_pack, since(30)),
+            field("scary_potter_pack", &StorePurchased::scary_potter_pack, since(30)),
+            field("last_stand_pack", &StorePurchased::last_stand_pack, since(30)),
+            field("bacon", &StorePurchased::bacon, since(30)),
+            field("bacon_2", &StorePurchased::bacon_2, since(30)));
+    };
 
     struct Store
     {
@@ -1272,33 +866,15 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         StorePurchased purchased;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const Store &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["extra_packet_slots"] = nlohmann_json_t.extra_packet_slots;
-        nlohmann_json_j["uses_of_rake"] = nlohmann_json_t.uses_of_rake;
-        if (k_version >= 30)
-        {
-            nlohmann_json_j["hammer"] = nlohmann_json_t.hammer;
-        }
-        nlohmann_json_j["purchased"] = nlohmann_json_t.purchased;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        Store &nlohmann_json_t) -> void
+    template <>
+    struct Schema<Store>
     {
-        nlohmann_json_j.at("extra_packet_slots").get_to(nlohmann_json_t.extra_packet_slots);
-        nlohmann_json_j.at("uses_of_rake").get_to(nlohmann_json_t.uses_of_rake);
-        if (k_version >= 30)
-        {
-            nlohmann_json_j.at("hammer").get_to(nlohmann_json_t.hammer);
-        }
-        nlohmann_json_j.at("purchased").get_to(nlohmann_json_t.purchased);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("extra_packet_slots", &Store::extra_packet_slots),
+            field("uses_of_rake", &Store::uses_of_rake),
+            field("hammer", &Store::hammer, since(30)),
+            field("purchased", &Store::purchased));
+    };
 
     struct AchievementInfo
     {
@@ -1306,23 +882,13 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         bool shown;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const AchievementInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["earned"] = nlohmann_json_t.earned;
-        nlohmann_json_j["shown"] = nlohmann_json_t.shown;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        AchievementInfo &nlohmann_json_t) -> void
+    template <>
+    struct Schema<AchievementInfo>
     {
-        nlohmann_json_j.at("earned").get_to(nlohmann_json_t.earned);
-        nlohmann_json_j.at("shown").get_to(nlohmann_json_t.shown);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("earned", &AchievementInfo::earned),
+            field("shown", &AchievementInfo::shown));
+    };
 
     struct Achievement
     {
@@ -1380,314 +946,216 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         AchievementInfo hammer_time;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const Achievement &nlohmann_json_t) -> void
-    {
-        if (k_version >= 12)
+    // every layout one after the other, a profile version only fall in one of the ranges
+
+    inline constexpr auto k_achievement_field = std::array{
+        field("home_lawn_security", &Achievement::home_lawn_security, between(12, 13)),
+        field("nobel_peas_prize", &Achievement::nobel_peas_prize, between(12, 13)),
+        field("better_off_dead", &Achievement::better_off_dead, between(12, 13)),
+        field("china_shop", &Achievement::china_shop, between(12, 13)),
+        field("spudow", &Achievement::spudow, between(12, 13)),
+        field("explodonator", &Achievement::explodonator, between(12, 13)),
+        field("morticulturalist", &Achievement::morticulturalist, between(12, 13)),
+        field("dont_pea_in_the_pool", &Achievement::dont_pea_in_the_pool, between(12, 13)),
+        field("roll_some_heads", &Achievement::roll_some_heads, between(12, 13)),
+        field("grounded", &Achievement::grounded, between(12, 13)),
+        field("zombologist", &Achievement::zombologist, between(12, 13)),
+        field("penny_pincher", &Achievement::penny_pincher, between(12, 13)),
+        field("sunny_days", &Achievement::sunny_days, between(12, 13)),
+        field("popcorn_party", &Achievement::popcorn_party, between(12, 13)),
+        field("good_morning", &Achievement::good_morning, between(12, 13)),
+        field("no_fungus_among_us", &Achievement::no_fungus_among_us, between(12, 13)),
+        field("beyond_the_grave", &Achievement::beyond_the_grave, between(12, 13)),
+        field("immortal", &Achievement::immortal, between(12, 13)),
+        field("towering_wisdom", &Achievement::towering_wisdom, between(12, 13)),
+        field("mustache_mode", &Achievement::mustache_mode, between(12, 13)),
+        field("home_lawn_security", &Achievement::home_lawn_security, between(13, 30)),
+        field("spudow", &Achievement::spudow, between(13, 30)),
+        field("explodonator", &Achievement::explodonator, between(13, 30)),
+        field("morticulturalist", &Achievement::morticulturalist, between(13, 30)),
+        field("dont_pea_in_the_pool", &Achievement::dont_pea_in_the_pool, between(13, 30)),
+        field("roll_some_heads", &Achievement::roll_some_heads, between(13, 30)),
+        field("grounded", &Achievement::grounded, between(13, 30)),
+        field("zombologist", &Achievement::zombologist, between(13, 30)),
+        field("penny_pincher", &Achievement::penny_pincher, between(13, 30)),
+        field("sunny_days", &Achievement::sunny_days, between(13, 30)),
+        field("popcorn_party", &Achievement::popcorn_party, between(13, 30)),
+        field("good_morning", &Achievement::good_morning, between(13, 30)),
+        field("no_fungus_among_us", &Achievement::no_fungus_among_us, between(13, 30)),
+        field("home_lawn_security", &Achievement::home_lawn_security, since(30)),
+        field("spudow", &Achievement::spudow, since(30)),
+        field("explodonator", &Achievement::explodonator, since(30)),
+        field("morticulturalist", &Achievement::morticulturalist, since(30)),
+        field("dont_pea_in_the_pool", &Achievement::dont_pea_in_the_pool, since(30)),
+        field("roll_some_heads", &Achievement::roll_some_heads, since(30)),
+        field("grounded", &Achievement::grounded, since(30)),
+        field("zombologist", &Achievement::zombologist, since(30)),
+        field("penny_pincher", &Achievement::penny_pincher, since(30)),
+        field("sunny_days", &Achievement::sunny_days, since(30)),
+        field("good_morning", &Achievement::good_morning, since(30)),
+        field("no_fungus_among_us", &Achievement::no_fungus_among_us, since(30)),
+        field("last_mown_stading", &Achievement::last_mown_stading, since(30)),
+        field("below_zero", &Achievement::below_zero, since(30)),
+        field("flower_power", &Achievement::flower_power, since(30)),
+        field("pyromaniac", &Achievement::pyromaniac, since(30)),
+        field("lawn_mowner_man", &Achievement::lawn_mowner_man, since(30)),
+        field("chill_out", &Achievement::chill_out, since(30)),
+        field("defcorn_five", &Achievement::defcorn_five, since(30)),
+        field("monster_mash", &Achievement::monster_mash, since(30)),
+        field("blind_faith", &Achievement::blind_faith, since(30)),
+        field("pool_closed", &Achievement::pool_closed, since(30)),
+        field("melony_lane", &Achievement::melony_lane, since(30)),
+        field("second_life", &Achievement::second_life, since(30)),
+        field("lucky_spin", &Achievement::lucky_spin, since(30)),
+        field("chilli_free", &Achievement::chilli_free, since(30)),
+        field("enlightened", &Achievement::enlightened, since(30)),
+        field("diamond_beghouler", &Achievement::diamond_beghouler, since(30)),
+        field("greenfingers", &Achievement::greenfingers, since(30)),
+        field("wallnot_attack", &Achievement::wallnot_attack, since(30)),
+        field("beyond_the_grave", &Achievement::beyond_the_grave, since(30)),
+        field("peking_express", &Achievement::peking_express, since(30)),
+        field("shooting_star", &Achievement::shooting_star, since(30)),
+        field("sol_invictus", &Achievement::sol_invictus, since(30)),
+        field("sproing_sproing", &Achievement::sproing_sproing, since(30)),
+        field("better_off_dead", &Achievement::better_off_dead, since(30)),
+        field("i_win", &Achievement::i_win, since(30)),
+        field("where_the_sun_dont_shine", &Achievement::where_the_sun_dont_shine, since(30)),
+        field("undead_space", &Achievement::undead_space, since(30)),
+        field("disco_is_undead", &Achievement::disco_is_undead, since(30)),
+        field("china_shop", &Achievement::china_shop, since(30)),
+        field("smashing", &Achievement::smashing, since(30)),
+        field("gotcha", &Achievement::gotcha, since(30)),
+        field("still_standing", &Achievement::still_standing, since(30)),
+        field("the_stuff_of_legends", &Achievement::the_stuff_of_legends, since(30)),
+        field("hammer_time", &Achievement::hammer_time, since(30))};
+
+    // stored by version 13 profiles that carry 25 achievements instead of 13
+
+    inline constexpr auto k_achievement_extended_range = between(13, 30);
+
+    inline constexpr auto k_achievement_base_count = 13;
+
+    inline constexpr auto k_achievement_extended_count = 25;
+
+    inline constexpr auto k_achievement_extended_field = std::array{
+        field("last_mown_stading", &Achievement::last_mown_stading, k_achievement_extended_range),
+        field("below_zero", &Achievement::below_zero, k_achievement_extended_range),
+        field("flower_power", &Achievement::flower_power, k_achievement_extended_range),
+        field("pyromaniac", &Achievement::pyromaniac, k_achievement_extended_range),
+        field("lawn_mowner_man", &Achievement::lawn_mowner_man, k_achievement_extended_range),
+        field("chill_out", &Achievement::chill_out, k_achievement_extended_range),
+        field("defcorn_five", &Achievement::defcorn_five, k_achievement_extended_range),
+        field("monster_mash", &Achievement::monster_mash, k_achievement_extended_range),
+        field("blind_faith", &Achievement::blind_faith, k_achievement_extended_range),
+        field("pool_closed", &Achievement::pool_closed, k_achievement_extended_range),
+        field("melony_lane", &Achievement::melony_lane, k_achievement_extended_range),
+        field("second_life", &Achievement::second_life, k_achievement_extended_range)};
+
+    // indexed by AchievementId
+
+    inline constexpr auto k_achievement_member = std::array{
+        &Achievement::home_lawn_security,
+        &Achievement::nobel_peas_prize,
+        &Achievement::better_off_dead,
+        &Achievement::china_shop,
+        &Achievement::spudow,
+        &Achievement::explodonator,
+        &Achievement::morticulturalist,
+        &Achievement::dont_pea_in_the_pool,
+        &Achievement::roll_some_heads,
+        &Achievement::grounded,
+        &Achievement::zombologist,
+        &Achievement::penny_pincher,
+        &Achievement::sunny_days,
+        &Achievement::popcorn_party,
+        &Achievement::good_morning,
+        &Achievement::no_fungus_among_us,
+        &Achievement::beyond_the_grave,
+        &Achievement::immortal,
+        &Achievement::towering_wisdom,
+        &Achievement::mustache_mode,
+        &Achievement::last_mown_stading,
+        &Achievement::below_zero,
+        &Achievement::flower_power,
+        &Achievement::pyromaniac,
+        &Achievement::lawn_mowner_man,
+        &Achievement::chill_out,
+        &Achievement::defcorn_five,
+        &Achievement::monster_mash,
+        &Achievement::blind_faith,
+        &Achievement::pool_closed,
+        &Achievement::melony_lane,
+        &Achievement::second_life,
+        &Achievement::lucky_spin,
+        &Achievement::chilli_free,
+        &Achievement::enlightened,
+        &Achievement::diamond_beghouler,
+        &Achievement::greenfingers,
+        &Achievement::wallnot_attack,
+        &Achievement::peking_express,
+        &Achievement::shooting_star,
+        &Achievement::sol_invictus,
+        &Achievement::sproing_sproing,
+        &Achievement::i_win,
+        &Achievement::where_the_sun_dont_shine,
+        &Achievement::undead_space,
+        &Achievement::disco_is_undead,
+        &Achievement::smashing,
+        &Achievement::gotcha,
+        &Achievement::still_standing,
+        &Achievement::the_stuff_of_legends,
+        &Achievement::hammer_time};
+
+    // profiles older than 12 do not store achievements, nlohmann wrote the empty object as null
+
+    inline auto write_value(
+        JsonWriter &writer,
+        Achievement const &value) -> void
+    {
+        if (k_version < 12)
         {
-            if (k_version < 13)
-            {
-                nlohmann_json_j["home_lawn_security"] = nlohmann_json_t.home_lawn_security;
-                nlohmann_json_j["nobel_peas_prize"] = nlohmann_json_t.nobel_peas_prize;
-                nlohmann_json_j["better_off_dead"] = nlohmann_json_t.better_off_dead;
-                nlohmann_json_j["china_shop"] = nlohmann_json_t.china_shop;
-                nlohmann_json_j["spudow"] = nlohmann_json_t.spudow;
-                nlohmann_json_j["explodonator"] = nlohmann_json_t.explodonator;
-                nlohmann_json_j["morticulturalist"] = nlohmann_json_t.morticulturalist;
-                nlohmann_json_j["dont_pea_in_the_pool"] = nlohmann_json_t.dont_pea_in_the_pool;
-                nlohmann_json_j["roll_some_heads"] = nlohmann_json_t.roll_some_heads;
-                nlohmann_json_j["grounded"] = nlohmann_json_t.grounded;
-                nlohmann_json_j["zombologist"] = nlohmann_json_t.zombologist;
-                nlohmann_json_j["penny_pincher"] = nlohmann_json_t.penny_pincher;
-                nlohmann_json_j["sunny_days"] = nlohmann_json_t.sunny_days;
-                nlohmann_json_j["popcorn_party"] = nlohmann_json_t.popcorn_party;
-                nlohmann_json_j["good_morning"] = nlohmann_json_t.good_morning;
-                nlohmann_json_j["no_fungus_among_us"] = nlohmann_json_t.no_fungus_among_us;
-                nlohmann_json_j["beyond_the_grave"] = nlohmann_json_t.beyond_the_grave;
-                nlohmann_json_j["immortal"] = nlohmann_json_t.immortal;
-                nlohmann_json_j["towering_wisdom"] = nlohmann_json_t.towering_wisdom;
-                nlohmann_json_j["mustache_mode"] = nlohmann_json_t.mustache_mode;
-            }
-            else if (k_version < 30)
-            {
-                nlohmann_json_j["home_lawn_security"] = nlohmann_json_t.home_lawn_security;
-                nlohmann_json_j["spudow"] = nlohmann_json_t.spudow;
-                nlohmann_json_j["explodonator"] = nlohmann_json_t.explodonator;
-                nlohmann_json_j["morticulturalist"] = nlohmann_json_t.morticulturalist;
-                nlohmann_json_j["dont_pea_in_the_pool"] = nlohmann_json_t.dont_pea_in_the_pool;
-                nlohmann_json_j["roll_some_heads"] = nlohmann_json_t.roll_some_heads;
-                nlohmann_json_j["grounded"] = nlohmann_json_t.grounded;
-                nlohmann_json_j["zombologist"] = nlohmann_json_t.zombologist;
-                nlohmann_json_j["penny_pincher"] = nlohmann_json_t.penny_pincher;
-                nlohmann_json_j["sunny_days"] = nlohmann_json_t.sunny_days;
-                nlohmann_json_j["popcorn_party"] = nlohmann_json_t.popcorn_party;
-                nlohmann_json_j["good_morning"] = nlohmann_json_t.good_morning;
-                nlohmann_json_j["no_fungus_among_us"] = nlohmann_json_t.no_fungus_among_us;
-                if (nlohmann_json_t.num_of_achievement > 13)
-                {
-                    assert_conditional(nlohmann_json_t.num_of_achievement == 25, fmt::format("{}", Language::get("popcap.player_info.invalid_num_of_achievement")), "to_json");
-                    nlohmann_json_j["last_mown_stading"] = nlohmann_json_t.last_mown_stading;
-                    nlohmann_json_j["below_zero"] = nlohmann_json_t.below_zero;
-                    nlohmann_json_j["flower_power"] = nlohmann_json_t.flower_power;
-                    nlohmann_json_j["pyromaniac"] = nlohmann_json_t.pyromaniac;
-                    nlohmann_json_j["lawn_mowner_man"] = nlohmann_json_t.lawn_mowner_man;
-                    nlohmann_json_j["chill_out"] = nlohmann_json_t.chill_out;
-                    nlohmann_json_j["defcorn_five"] = nlohmann_json_t.defcorn_five;
-                    nlohmann_json_j["monster_mash"] = nlohmann_json_t.monster_mash;
-                    nlohmann_json_j["blind_faith"] = nlohmann_json_t.blind_faith;
-                    nlohmann_json_j["pool_closed"] = nlohmann_json_t.pool_closed;
-                    nlohmann_json_j["melony_lane"] = nlohmann_json_t.melony_lane;
-                    nlohmann_json_j["second_life"] = nlohmann_json_t.second_life;
-                }
-            }
-            else
+            writer.WriteNull();
+            return;
+        }
+        writer.WriteStartObject();
+        for (auto const &element : k_achievement_field)
+        {
+            write_field(writer, value, element);
+        }
+        if (k_achievement_extended_range.contains(k_version) && value.num_of_achievement > k_achievement_base_count)
+        {
+            assert_conditional(value.num_of_achievement == k_achievement_extended_count, fmt::format("{}", Language::get("popcap.player_info.invalid_num_of_achievement")), "write_value");
+            for (auto const &element : k_achievement_extended_field)
             {
-                nlohmann_json_j["home_lawn_security"] = nlohmann_json_t.home_lawn_security;
-                nlohmann_json_j["spudow"] = nlohmann_json_t.spudow;
-                nlohmann_json_j["explodonator"] = nlohmann_json_t.explodonator;
-                nlohmann_json_j["morticulturalist"] = nlohmann_json_t.morticulturalist;
-                nlohmann_json_j["dont_pea_in_the_pool"] = nlohmann_json_t.dont_pea_in_the_pool;
-                nlohmann_json_j["roll_some_heads"] = nlohmann_json_t.roll_some_heads;
-                nlohmann_json_j["grounded"] = nlohmann_json_t.grounded;
-                nlohmann_json_j["zombologist"] = nlohmann_json_t.zombologist;
-                nlohmann_json_j["penny_pincher"] = nlohmann_json_t.penny_pincher;
-                nlohmann_json_j["sunny_days"] = nlohmann_json_t.sunny_days;
-                nlohmann_json_j["good_morning"] = nlohmann_json_t.good_morning;
-                nlohmann_json_j["no_fungus_among_us"] = nlohmann_json_t.no_fungus_among_us;
-                nlohmann_json_j["last_mown_stading"] = nlohmann_json_t.last_mown_stading;
-                nlohmann_json_j["below_zero"] = nlohmann_json_t.below_zero;
-                nlohmann_json_j["flower_power"] = nlohmann_json_t.flower_power;
-                nlohmann_json_j["pyromaniac"] = nlohmann_json_t.pyromaniac;
-                nlohmann_json_j["lawn_mowner_man"] = nlohmann_json_t.lawn_mowner_man;
-                nlohmann_json_j["chill_out"] = nlohmann_json_t.chill_out;
-                nlohmann_json_j["defcorn_five"] = nlohmann_json_t.defcorn_five;
-                nlohmann_json_j["monster_mash"] = nlohmann_json_t.monster_mash;
-                nlohmann_json_j["blind_faith"] = nlohmann_json_t.blind_faith;
-                nlohmann_json_j["pool_closed"] = nlohmann_json_t.pool_closed;
-                nlohmann_json_j["melony_lane"] = nlohmann_json_t.melony_lane;
-                nlohmann_json_j["second_life"] = nlohmann_json_t.second_life;
-                nlohmann_json_j["lucky_spin"] = nlohmann_json_t.lucky_spin;
-                nlohmann_json_j["chilli_free"] = nlohmann_json_t.chilli_free;
-                nlohmann_json_j["enlightened"] = nlohmann_json_t.enlightened;
-                nlohmann_json_j["diamond_beghouler"] = nlohmann_json_t.diamond_beghouler;
-                nlohmann_json_j["greenfingers"] = nlohmann_json_t.greenfingers;
-                nlohmann_json_j["wallnot_attack"] = nlohmann_json_t.wallnot_attack;
-                nlohmann_json_j["beyond_the_grave"] = nlohmann_json_t.beyond_the_grave;
-                nlohmann_json_j["peking_express"] = nlohmann_json_t.peking_express;
-                nlohmann_json_j["shooting_star"] = nlohmann_json_t.shooting_star;
-                nlohmann_json_j["sol_invictus"] = nlohmann_json_t.sol_invictus;
-                nlohmann_json_j["sproing_sproing"] = nlohmann_json_t.sproing_sproing;
-                nlohmann_json_j["better_off_dead"] = nlohmann_json_t.better_off_dead;
-                nlohmann_json_j["i_win"] = nlohmann_json_t.i_win;
-                nlohmann_json_j["where_the_sun_dont_shine"] = nlohmann_json_t.where_the_sun_dont_shine;
-                nlohmann_json_j["undead_space"] = nlohmann_json_t.undead_space;
-                nlohmann_json_j["disco_is_undead"] = nlohmann_json_t.disco_is_undead;
-                nlohmann_json_j["china_shop"] = nlohmann_json_t.china_shop;
-                nlohmann_json_j["smashing"] = nlohmann_json_t.smashing;
-                nlohmann_json_j["gotcha"] = nlohmann_json_t.gotcha;
-                nlohmann_json_j["still_standing"] = nlohmann_json_t.still_standing;
-                nlohmann_json_j["the_stuff_of_legends"] = nlohmann_json_t.the_stuff_of_legends;
-                nlohmann_json_j["hammer_time"] = nlohmann_json_t.hammer_time;
+                write_field(writer, value, element);
             }
         }
+        writer.WriteEndObject();
         return;
     }
 
     inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        Achievement &nlohmann_json_t) -> void
+        nlohmann::ordered_json const &json,
+        Achievement &value) -> void
     {
-        if (k_version >= 12)
+        for (auto const &element : k_achievement_field)
         {
-            if (k_version < 13)
-            {
-                nlohmann_json_j.at("home_lawn_security").get_to(nlohmann_json_t.home_lawn_security);
-                nlohmann_json_j.at("nobel_peas_prize").get_to(nlohmann_json_t.nobel_peas_prize);
-                nlohmann_json_j.at("better_off_dead").get_to(nlohmann_json_t.better_off_dead);
-                nlohmann_json_j.at("china_shop").get_to(nlohmann_json_t.china_shop);
-                nlohmann_json_j.at("spudow").get_to(nlohmann_json_t.spudow);
-                nlohmann_json_j.at("explodonator").get_to(nlohmann_json_t.explodonator);
-                nlohmann_json_j.at("morticulturalist").get_to(nlohmann_json_t.morticulturalist);
-                nlohmann_json_j.at("dont_pea_in_the_pool").get_to(nlohmann_json_t.dont_pea_in_the_pool);
-                nlohmann_json_j.at("roll_some_heads").get_to(nlohmann_json_t.roll_some_heads);
-                nlohmann_json_j.at("grounded").get_to(nlohmann_json_t.grounded);
-                nlohmann_json_j.at("zombologist").get_to(nlohmann_json_t.zombologist);
-                nlohmann_json_j.at("penny_pincher").get_to(nlohmann_json_t.penny_pincher);
-                nlohmann_json_j.at("sunny_days").get_to(nlohmann_json_t.sunny_days);
-                nlohmann_json_j.at("popcorn_party").get_to(nlohmann_json_t.popcorn_party);
-                nlohmann_json_j.at("good_morning").get_to(nlohmann_json_t.good_morning);
-                nlohmann_json_j.at("no_fungus_among_us").get_to(nlohmann_json_t.no_fungus_among_us);
-                nlohmann_json_j.at("beyond_the_grave").get_to(nlohmann_json_t.beyond_the_grave);
-                nlohmann_json_j.at("immortal").get_to(nlohmann_json_t.immortal);
-                nlohmann_json_j.at("towering_wisdom").get_to(nlohmann_json_t.towering_wisdom);
-                nlohmann_json_j.at("mustache_mode").get_to(nlohmann_json_t.mustache_mode);
-            }
-            else if (k_version < 30)
+            read_field(json, value, element);
+        }
+        if (k_achievement_extended_range.contains(k_version))
+        {
+            value.num_of_achievement = k_achievement_base_count;
+            for (auto const &element : k_achievement_extended_field)
             {
-                nlohmann_json_j.at("home_lawn_security").get_to(nlohmann_json_t.home_lawn_security);
-                nlohmann_json_j.at("spudow").get_to(nlohmann_json_t.spudow);
-                nlohmann_json_j.at("explodonator").get_to(nlohmann_json_t.explodonator);
-                nlohmann_json_j.at("morticulturalist").get_to(nlohmann_json_t.morticulturalist);
-                nlohmann_json_j.at("dont_pea_in_the_pool").get_to(nlohmann_json_t.dont_pea_in_the_pool);
-                nlohmann_json_j.at("roll_some_heads").get_to(nlohmann_json_t.roll_some_heads);
-                nlohmann_json_j.at("grounded").get_to(nlohmann_json_t.grounded);
-                nlohmann_json_j.at("zombologist").get_to(nlohmann_json_t.zombologist);
-                nlohmann_json_j.at("penny_pincher").get_to(nlohmann_json_t.penny_pincher);
-                nlohmann_json_j.at("sunny_days").get_to(nlohmann_json_t.sunny_days);
-                nlohmann_json_j.at("popcorn_party").get_to(nlohmann_json_t.popcorn_party);
-                nlohmann_json_j.at("good_morning").get_to(nlohmann_json_t.good_morning);
-                nlohmann_json_j.at("no_fungus_among_us").get_to(nlohmann_json_t.no_fungus_among_us);
-                nlohmann_json_t.num_of_achievement = 13;
-                try
-                {
-                    nlohmann_json_j.at("last_mown_stading").get_to(nlohmann_json_t.last_mown_stading);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("below_zero").get_to(nlohmann_json_t.below_zero);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("flower_power").get_to(nlohmann_json_t.flower_power);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("pyromaniac").get_to(nlohmann_json_t.pyromaniac);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("lawn_mowner_man").get_to(nlohmann_json_t.lawn_mowner_man);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("chill_out").get_to(nlohmann_json_t.chill_out);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("defcorn_five").get_to(nlohmann_json_t.defcorn_five);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("monster_mash").get_to(nlohmann_json_t.monster_mash);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("blind_faith").get_to(nlohmann_json_t.blind_faith);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("pool_closed").get_to(nlohmann_json_t.pool_closed);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("melony_lane").get_to(nlohmann_json_t.melony_lane);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                try
-                {
-                    nlohmann_json_j.at("second_life").get_to(nlohmann_json_t.second_life);
-                    ++nlohmann_json_t.num_of_achievement;
-                }
-                catch (nlohmann::ordered_json::exception &e)
-                {
-                }
-                if (nlohmann_json_t.num_of_achievement > 13)
+                if (json.contains(element.name))
                 {
-                    assert_conditional(nlohmann_json_t.num_of_achievement == 25, fmt::format("{}", Language::get("popcap.player_info.invalid_num_of_achievement")), "from_json");
+                    read_field(json, value, element);
+                    ++value.num_of_achievement;
                 }
             }
-            else
+            if (value.num_of_achievement > k_achievement_base_count)
             {
-                nlohmann_json_j.at("home_lawn_security").get_to(nlohmann_json_t.home_lawn_security);
-                nlohmann_json_j.at("spudow").get_to(nlohmann_json_t.spudow);
-                nlohmann_json_j.at("explodonator").get_to(nlohmann_json_t.explodonator);
-                nlohmann_json_j.at("morticulturalist").get_to(nlohmann_json_t.morticulturalist);
-                nlohmann_json_j.at("dont_pea_in_the_pool").get_to(nlohmann_json_t.dont_pea_in_the_pool);
-                nlohmann_json_j.at("grounded").get_to(nlohmann_json_t.grounded);
-                nlohmann_json_j.at("roll_some_heads").get_to(nlohmann_json_t.roll_some_heads);
-                nlohmann_json_j.at("zombologist").get_to(nlohmann_json_t.zombologist);
-                nlohmann_json_j.at("penny_pincher").get_to(nlohmann_json_t.penny_pincher);
-                nlohmann_json_j.at("sunny_days").get_to(nlohmann_json_t.sunny_days);
-                nlohmann_json_j.at("good_morning").get_to(nlohmann_json_t.good_morning);
-                nlohmann_json_j.at("no_fungus_among_us").get_to(nlohmann_json_t.no_fungus_among_us);
-                nlohmann_json_j.at("last_mown_stading").get_to(nlohmann_json_t.last_mown_stading);
-                nlohmann_json_j.at("below_zero").get_to(nlohmann_json_t.below_zero);
-                nlohmann_json_j.at("flower_power").get_to(nlohmann_json_t.flower_power);
-                nlohmann_json_j.at("pyromaniac").get_to(nlohmann_json_t.pyromaniac);
-                nlohmann_json_j.at("lawn_mowner_man").get_to(nlohmann_json_t.lawn_mowner_man);
-                nlohmann_json_j.at("chill_out").get_to(nlohmann_json_t.chill_out);
-                nlohmann_json_j.at("defcorn_five").get_to(nlohmann_json_t.defcorn_five);
-                nlohmann_json_j.at("monster_mash").get_to(nlohmann_json_t.monster_mash);
-                nlohmann_json_j.at("blind_faith").get_to(nlohmann_json_t.blind_faith);
-                nlohmann_json_j.at("pool_closed").get_to(nlohmann_json_t.pool_closed);
-                nlohmann_json_j.at("melony_lane").get_to(nlohmann_json_t.melony_lane);
-                nlohmann_json_j.at("second_life").get_to(nlohmann_json_t.second_life);
-                nlohmann_json_j.at("lucky_spin").get_to(nlohmann_json_t.lucky_spin);
-                nlohmann_json_j.at("chilli_free").get_to(nlohmann_json_t.chilli_free);
-                nlohmann_json_j.at("enlightened").get_to(nlohmann_json_t.enlightened);
-                nlohmann_json_j.at("diamond_beghouler").get_to(nlohmann_json_t.diamond_beghouler);
-                nlohmann_json_j.at("greenfingers").get_to(nlohmann_json_t.greenfingers);
-                nlohmann_json_j.at("wallnot_attack").get_to(nlohmann_json_t.wallnot_attack);
-                nlohmann_json_j.at("beyond_the_grave").get_to(nlohmann_json_t.beyond_the_grave);
-                nlohmann_json_j.at("peking_express").get_to(nlohmann_json_t.peking_express);
-                nlohmann_json_j.at("shooting_star").get_to(nlohmann_json_t.shooting_star);
-                nlohmann_json_j.at("sol_invictus").get_to(nlohmann_json_t.sol_invictus);
-                nlohmann_json_j.at("sproing_sproing").get_to(nlohmann_json_t.sproing_sproing);
-                nlohmann_json_j.at("better_off_dead").get_to(nlohmann_json_t.better_off_dead);
-                nlohmann_json_j.at("i_win").get_to(nlohmann_json_t.i_win);
-                nlohmann_json_j.at("where_the_sun_dont_shine").get_to(nlohmann_json_t.where_the_sun_dont_shine);
-                nlohmann_json_j.at("undead_space").get_to(nlohmann_json_t.undead_space);
-                nlohmann_json_j.at("disco_is_undead").get_to(nlohmann_json_t.disco_is_undead);
-                nlohmann_json_j.at("china_shop").get_to(nlohmann_json_t.china_shop);
-                nlohmann_json_j.at("smashing").get_to(nlohmann_json_t.smashing);
-                nlohmann_json_j.at("gotcha").get_to(nlohmann_json_t.gotcha);
-                nlohmann_json_j.at("still_standing").get_to(nlohmann_json_t.still_standing);
-                nlohmann_json_j.at("the_stuff_of_legends").get_to(nlohmann_json_t.the_stuff_of_legends);
-                nlohmann_json_j.at("hammer_time").get_to(nlohmann_json_t.hammer_time);
+                assert_conditional(value.num_of_achievement == k_achievement_extended_count, fmt::format("{}", Language::get("popcap.player_info.invalid_num_of_achievement")), "from_json");
             }
         }
         return;
@@ -1699,23 +1167,13 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int color;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const ZombatarArgument &nlohmann_json_t) -> void
+    template <>
+    struct Schema<ZombatarArgument>
     {
-        nlohmann_json_j["type"] = nlohmann_json_t.type;
-        nlohmann_json_j["color"] = nlohmann_json_t.color;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        ZombatarArgument &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("type").get_to(nlohmann_json_t.type);
-        nlohmann_json_j.at("color").get_to(nlohmann_json_t.color);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("type", &ZombatarArgument::type),
+            field("color", &ZombatarArgument::color));
+    };
 
     struct ZombatarValue
     {
@@ -1730,33 +1188,18 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         ZombatarArgument backdrop;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const ZombatarValue &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["skin_color"] = nlohmann_json_t.skin_color;
-        nlohmann_json_j["clothes"] = nlohmann_json_t.clothes;
-        nlohmann_json_j["accessories"] = nlohmann_json_t.accessories;
-        nlohmann_json_j["facial_hair"] = nlohmann_json_t.facial_hair;
-        nlohmann_json_j["hair"] = nlohmann_json_t.hair;
-        nlohmann_json_j["eyewear"] = nlohmann_json_t.eyewear;
-        nlohmann_json_j["backdrop"] = nlohmann_json_t.backdrop;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        ZombatarValue &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("skin_color").get_to(nlohmann_json_t.skin_color);
-        nlohmann_json_j.at("clothes").get_to(nlohmann_json_t.clothes);
-        nlohmann_json_j.at("accessories").get_to(nlohmann_json_t.accessories);
-        nlohmann_json_j.at("facial_hair").get_to(nlohmann_json_t.facial_hair);
-        nlohmann_json_j.at("hair").get_to(nlohmann_json_t.hair);
-        nlohmann_json_j.at("eyewear").get_to(nlohmann_json_t.eyewear);
-        nlohmann_json_j.at("backdrop").get_to(nlohmann_json_t.backdrop);
-        return;
-    }
+    template <>
+    struct Schema<ZombatarValue>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("skin_color", &ZombatarValue::skin_color),
+            field("clothes", &ZombatarValue::clothes),
+            field("accessories", &ZombatarValue::accessories),
+            field("facial_hair", &ZombatarValue::facial_hair),
+            field("hair", &ZombatarValue::hair),
+            field("eyewear", &ZombatarValue::eyewear),
+            field("backdrop", &ZombatarValue::backdrop));
+    };
 
     struct Zombatar
     {
@@ -1765,25 +1208,14 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         std::vector<ZombatarValue> value;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const Zombatar &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["accepted_zombatar_license"] = nlohmann_json_t.accepted_zombatar_license;
-        nlohmann_json_j["display_save_image_messenge"] = nlohmann_json_t.display_save_image_messenge;
-        nlohmann_json_j["value"] = nlohmann_json_t.value;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        Zombatar &nlohmann_json_t) -> void
+    template <>
+    struct Schema<Zombatar>
     {
-        nlohmann_json_j.at("accepted_zombatar_license").get_to(nlohmann_json_t.accepted_zombatar_license);
-        nlohmann_json_j.at("display_save_image_messenge").get_to(nlohmann_json_t.display_save_image_messenge);
-        nlohmann_json_j.at("value").get_to(nlohmann_json_t.value);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("accepted_zombatar_license", &Zombatar::accepted_zombatar_license),
+            field("display_save_image_messenge", &Zombatar::display_save_image_messenge),
+            field("value", &Zombatar::value));
+    };
 
     struct DetailInfo
     {
@@ -1803,102 +1235,20 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         std::string unknown_expand;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const DetailInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["version"] = nlohmann_json_t.version;
-        nlohmann_json_j["general"] = nlohmann_json_t.general;
-        if (nlohmann_json_t.has_unlocked)
-        {
-            nlohmann_json_j["unlocked"] = nlohmann_json_t.unlocked;
-        }
-        else
-        {
-            nlohmann_json_j["unlocked"] = nullptr;
-        }
-        if (nlohmann_json_t.has_trophies)
-        {
-            nlohmann_json_j["trophies"] = nlohmann_json_t.trophies;
-        }
-        else
-        {
-            nlohmann_json_j["trophies"] = nullptr;
-        }
-        nlohmann_json_j["store"] = nlohmann_json_t.store;
-        if (nlohmann_json_t.has_zen_garden)
-        {
-            nlohmann_json_j["zen_garden"] = nlohmann_json_t.zen_garden;
-        }
-        else
-        {
-            nlohmann_json_j["zen_garden"] = nullptr;
-        }
-        if (nlohmann_json_t.has_achievement)
-        {
-            nlohmann_json_j["achievement"] = nlohmann_json_t.achievement;
-        }
-        else
-        {
-            nlohmann_json_j["achievement"] = nullptr;
-        }
-        if (nlohmann_json_t.has_zombatar)
-        {
-            nlohmann_json_j["zombatar"] = nlohmann_json_t.zombatar;
-        }
-        else
-        {
-            nlohmann_json_j["zombatar"] = nullptr;
-        }
-        if (!nlohmann_json_t.unknown_expand.empty())
-        {
-            nlohmann_json_j["unknown_expand"] = nlohmann_json_t.unknown_expand;
-        }
-        else
-        {
-            nlohmann_json_j["unknown_expand"] = nullptr;
-        }
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        DetailInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
-        nlohmann_json_j.at("general").get_to(nlohmann_json_t.general);
-        if (nlohmann_json_j["unlocked"] != nullptr)
-        {
-            nlohmann_json_j.at("unlocked").get_to(nlohmann_json_t.unlocked);
-            nlohmann_json_t.has_unlocked = true;
-        }
-        if (nlohmann_json_j["trophies"] != nullptr)
-        {
-            nlohmann_json_j.at("trophies").get_to(nlohmann_json_t.trophies);
-            nlohmann_json_t.has_trophies = true;
-        }
-        nlohmann_json_j.at("store").get_to(nlohmann_json_t.store);
-        if (nlohmann_json_j["zen_garden"] != nullptr)
-        {
-            nlohmann_json_j.at("zen_garden").get_to(nlohmann_json_t.zen_garden);
-            nlohmann_json_t.has_zen_garden = true;
-        }
-        if (nlohmann_json_j["achievement"] != nullptr)
-        {
-            nlohmann_json_j.at("achievement").get_to(nlohmann_json_t.achievement);
-            nlohmann_json_t.has_achievement = true;
-        }
-        if (nlohmann_json_j["zombatar"] != nullptr)
-        {
-            nlohmann_json_j.at("zombatar").get_to(nlohmann_json_t.zombatar);
-            nlohmann_json_t.has_zombatar = true;
-        }
-        if (nlohmann_json_j["unknown_expand"] != nullptr)
-        {
-            nlohmann_json_j.at("unknown_expand").get_to(nlohmann_json_t.unknown_expand);
-        }
-        return;
-    }
+    template <>
+    struct Schema<DetailInfo>
+    {
+        inline static constexpr auto value = std::make_tuple(
+            field("version", &DetailInfo::version),
+            field("general", &DetailInfo::general),
+            field("unlocked", &DetailInfo::unlocked, k_every_version, FieldKind::nullable, &DetailInfo::has_unlocked),
+            field("trophies", &DetailInfo::trophies, k_every_version, FieldKind::nullable, &DetailInfo::has_trophies),
+            field("store", &DetailInfo::store),
+            field("zen_garden", &DetailInfo::zen_garden, k_every_version, FieldKind::nullable, &DetailInfo::has_zen_garden),
+            field("achievement", &DetailInfo::achievement, k_every_version, FieldKind::nullable, &DetailInfo::has_achievement),
+            field("zombatar", &DetailInfo::zombatar, k_every_version, FieldKind::nullable, &DetailInfo::has_zombatar),
+            field("unknown_expand", &DetailInfo::unknown_expand, k_every_version, FieldKind::nullable));
+    };
 
     struct UserDetail
     {
@@ -1907,25 +1257,14 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         int id;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const UserDetail &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["name"] = nlohmann_json_t.name;
-        nlohmann_json_j["use_seq"] = nlohmann_json_t.use_seq;
-        nlohmann_json_j["id"] = nlohmann_json_t.id;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        UserDetail &nlohmann_json_t) -> void
+    template <>
+    struct Schema<UserDetail>
     {
-        nlohmann_json_j.at("name").get_to(nlohmann_json_t.name);
-        nlohmann_json_j.at("use_seq").get_to(nlohmann_json_t.use_seq);
-        nlohmann_json_j.at("id").get_to(nlohmann_json_t.id);
-        return;
-    }
+        inline static constexpr auto value = std::make_tuple(
+            field("name", &UserDetail::name),
+            field("use_seq", &UserDetail::use_seq),
+            field("id", &UserDetail::id));
+    };
 
     struct SummaryInfo
     {
@@ -1933,43 +1272,11 @@ namespace Sen::Kernel::Support::PopCap::PlayerInfo
         std::vector<UserDetail> users;
     };
 
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const SummaryInfo &nlohmann_json_t) -> void
+    template <>
+    struct Schema<SummaryInfo>
     {
-        nlohmann_json_j["version"] = nlohmann_json_t.version;
-        nlohmann_json_j["users"] = nlohmann_json_t.users;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        SummaryInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
-        nlohmann_json_j.at("users").get_to(nlohmann_json_t.users);
-        return;
-    }
-
-    struct VersionInfo {
-        int version;
+        inline static constexpr auto value = std::make_tuple(
+            field("version", &SummaryInfo::version),
+            field("users", &SummaryInfo::users));
     };
-
-    inline auto to_json(
-        nlohmann::ordered_json &nlohmann_json_j,
-        const VersionInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j["version"] = nlohmann_json_t.version;
-        k_version = nlohmann_json_t.version;
-        return;
-    }
-
-    inline auto from_json(
-        const nlohmann::ordered_json &nlohmann_json_j,
-        VersionInfo &nlohmann_json_t) -> void
-    {
-        nlohmann_json_j.at("version").get_to(nlohmann_json_t.version);
-        k_version = nlohmann_json_t.version;
-        return;
-    }
-}
\ No newline at end of file
+}
@@ -0,0 +1,400 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/popcap/player_info/schema.hpp"
+
+namespace Sen::Kernel::Support::PopCap::PlayerInfo
+{
+
+    using namespace Definition;
+
+    /**
+     * Binary layout of a profile
+     * The game store a profile as flat structures and integer lists indexed by an enumeration,
+     * the descriptors below tell how they map onto the definition so decode and encode share one table
+     */
+
+    /**
+     * Integer list indexed by Key, for the profile versions in version
+     * size: number of integers stored in the profile
+     * count: number of leading integers that are mapped onto the definition
+     * index: position of each key in the list
+     */
+
+    template <typename Key>
+    struct KeyLayout
+    {
+        VersionRange version;
+
+        std::size_t size;
+
+        std::size_t count;
+
+        std::span<std::pair<std::uint8_t, Key> const> index;
+    };
+
+    // value is an array of KeyLayout, one per version range
+
+    template <typename Key>
+    struct KeyTable;
+
+    template <typename Key>
+    inline auto key_layout(
+
+        ) -> KeyLayout<Key> const *
+    {
+        for (auto const &element : KeyTable<Key>::value)
+        {
+            if (element.version.contains(k_version))
+            {
+                return &element;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Key>
+    inline auto key_list_size(
+
+        ) -> std::size_t
+    {
+        auto layout = key_layout<Key>();
+        return layout == nullptr ? 0_size : layout->size;
+    }
+
+    template <typename Key>
+    inline auto key_count(
+
+        ) -> std::size_t
+    {
+        auto layout = key_layout<Key>();
+        return layout == nullptr ? 0_size : layout->count;
+    }
+
+    template <typename Key>
+    inline auto key_of(
+        std::size_t index) -> Key
+    {
+        if (auto layout = key_layout<Key>(); layout != nullptr)
+        {
+            for (auto const &[position, key] : layout->index)
+            {
+                if (position == index)
+                {
+                    return key;
+                }
+            }
+        }
+        throw Exception(String::format(fmt::format("{}", Language::get("miscellaneous.shared.failed_cast_enum_index")), std::to_string(index), std::string{magic_enum::enum_type_name<Key>()}), std::source_location::current(), "key_of");
+    }
+
+    // first position of key, none when the profile version does not store it
+
+    template <typename Key>
+    inline auto index_of(
+        Key key) -> std::optional<std::size_t>
+    {
+        if (auto layout = key_layout<Key>(); layout != nullptr)
+        {
+            for (auto const &[position, element] : layout->index)
+            {
+                if (element == key)
+                {
+                    return static_cast<std::size_t>(position);
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    // value reached from a structure through a chain of data members
+
+    template <auto... t_member>
+    struct Path
+    {
+        template <typename Class>
+        inline static auto get(
+            Class &value) -> auto &
+        {
+            return (value .* ... .* t_member);
+        }
+    };
+
+    /**
+     * Member of a binary structure and the definition member it hold
+     * Enumerations and booleans are stored as integers, the value is cast both ways
+     */
+
+    template <auto t_source, auto... t_target>
+    struct Link
+    {
+        template <typename Source, typename Target>
+        inline static auto read(
+            Source const &source,
+            Target &target) -> void
+        {
+            auto &value = Path<t_target...>::get(target);
+            value = static_cast<std::remove_cvref_t<decltype(value)>>(source.*t_source);
+            return;
+        }
+
+        template <typename Source, typename Target>
+        inline static auto write(
+            Target const &target,
+            Source &source) -> void
+        {
+            auto &value = source.*t_source;
+            value = static_cast<std::remove_cvref_t<decltype(value)>>(Path<t_target...>::get(target));
+            return;
+        }
+    };
+
+    template <typename... Link>
+    struct Mapping
+    {
+        template <typename Source, typename Target>
+        inline static auto read(
+            Source const &source,
+            Target &target) -> void
+        {
+            (Link::read(source, target), ...);
+            return;
+        }
+
+        template <typename Source, typename Target>
+        inline static auto write(
+            Target const &target,
+            Source &source) -> void
+        {
+            (Link::write(target, source), ...);
+            return;
+        }
+
+        template <typename Source, typename Target>
+        inline static auto read_list(
+            std::vector<Source> const &source,
+            std::vector<Target> &target) -> void
+        {
+            target.resize(source.size());
+            for (auto i : Range(source.size()))
+            {
+                read(source[i], target[i]);
+            }
+            return;
+        }
+
+        template <typename Source, typename Target>
+        inline static auto write_list(
+            std::vector<Target> const &target,
+            std::vector<Source> &source) -> void
+        {
+            source.resize(target.size());
+            for (auto i : Range(target.size()))
+            {
+                write(target[i], source[i]);
+            }
+            return;
+        }
+    };
+
+    // Slot conversions, a slot is read when it is not zero and written when is_set
+
+    // the slot is set, stored as 1
+
+    struct AsFlag
+    {
+        inline static auto read(
+            int value,
+            bool &target) -> void
+        {
+            target = true;
+            return;
+        }
+
+        inline static auto is_set(
+            bool target) -> bool
+        {
+            return target;
+        }
+
+        inline static auto write(
+            bool target) -> int
+        {
+            return 1;
+        }
+    };
+
+    struct AsValue
+    {
+        inline static auto read(
+            int value,
+            int &target) -> void
+        {
+            target = value;
+            return;
+        }
+
+        inline static auto is_set(
+            int target) -> bool
+        {
+            return target != 0;
+        }
+
+        inline static auto write(
+            int target) -> int
+        {
+            return target;
+        }
+    };
+
+    // amount stored above an offset
+
+    template <int t_offset>
+    struct AsOffset
+    {
+        inline static auto read(
+            int value,
+            int &target) -> void
+        {
+            target = value - t_offset;
+            return;
+        }
+
+        inline static auto is_set(
+            int target) -> bool
+        {
+            return target != 0;
+        }
+
+        inline static auto write(
+            int target) -> int
+        {
+            return target + t_offset;
+        }
+    };
+
+    // clamped to [t_minimum, t_maximum] on write, and on read too when t_on_read
+
+    template <int t_minimum, int t_maximum, bool t_on_read = false>
+    struct AsLimit
+    {
+        inline static auto read(
+            int value,
+            int &target) -> void
+        {
+            target = t_on_read ? std::clamp(value, t_minimum, t_maximum) : value;
+            return;
+        }
+
+        inline static auto is_set(
+            int target) -> bool
+        {
+            return target != 0;
+        }
+
+        inline static auto write(
+            int target) -> int
+        {
+            return std::clamp(target, t_minimum, t_maximum);
+        }
+    };
+
+    // known slot without a definition member
+
+    struct AsNothing
+    {
+        template <typename Target>
+        inline static auto read(
+            int value,
+            Target &target) -> void
+        {
+            return;
+        }
+
+        template <typename Target>
+        inline static auto is_set(
+            Target const &target) -> bool
+        {
+            return false;
+        }
+
+        template <typename Target>
+        inline static auto write(
+            Target const &target) -> int
+        {
+            return 0;
+        }
+    };
+
+    // slot of key in an integer list, holding the definition member at t_member
+
+    template <auto t_key, typename Convert, auto... t_member>
+    struct Slot
+    {
+        using Key = decltype(t_key);
+
+        inline static constexpr auto key = t_key;
+
+        template <typename Class>
+        inline static auto read(
+            int value,
+            Class &definition) -> void
+        {
+            Convert::read(value, Path<t_member...>::get(definition));
+            return;
+        }
+
+        template <typename Class>
+        inline static auto write(
+            Class const &definition,
+            std::vector<int> &list) -> void
+        {
+            auto const &value = Path<t_member...>::get(definition);
+            if (!Convert::is_set(value))
+            {
+                return;
+            }
+            if (auto index = index_of(t_key); index.has_value() && index.value() < list.size())
+            {
+                list[index.value()] = Convert::write(value);
+            }
+            return;
+        }
+    };
+
+    template <typename Slot, typename... Rest>
+    struct SlotList
+    {
+        using Key = typename Slot::Key;
+
+        template <typename Class>
+        inline static auto read(
+            std::vector<int> const &list,
+            Class &definition) -> void
+        {
+            for (auto index : Range(std::min(key_count<Key>(), list.size())))
+            {
+                if (list[index] == 0)
+                {
+                    continue;
+                }
+                auto key = key_of<Key>(index);
+                auto bound = ((Slot::key == key ? (Slot::read(list[index], definition), true) : false) | ... | (Rest::key == key ? (Rest::read(list[index], definition), true) : false));
+                assert_conditional(bound, String::format(fmt::format("{}", Language::get("popcap.player_info.unbound_slot")), std::to_string(index), std::string{magic_enum::enum_type_name<Key>()}), "read");
+            }
+            return;
+        }
+
+        template <typename Class>
+        inline static auto write(
+            Class const &definition,
+            std::vector<int> &list) -> void
+        {
+            list.resize(key_count<Key>());
+            Slot::write(definition, list);
+            (Rest::write(definition, list), ...);
+            return;
+        }
+    };
+
+}
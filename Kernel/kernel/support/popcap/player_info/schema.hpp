@@ -0,0 +1,260 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/miscellaneous/shared.hpp"
+
+namespace Sen::Kernel::Support::PopCap::PlayerInfo
+{
+
+    using namespace Definition;
+
+    using namespace Sen::Kernel::Support::Miscellaneous::Shared;
+
+    // version of the profile being converted, thread local so profiles can be converted in parallel
+
+    inline static thread_local auto k_version = 0;
+
+    // [since, until) range of profile versions a field is stored in
+
+    struct VersionRange
+    {
+        int since;
+
+        int until;
+
+        inline constexpr auto contains(
+            int version) const -> bool
+        {
+            return version >= thiz.since && version < thiz.until;
+        }
+    };
+
+    inline constexpr auto k_every_version = VersionRange{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+
+    inline constexpr auto since(
+        int version) -> VersionRange
+    {
+        return VersionRange{version, std::numeric_limits<int>::max()};
+    }
+
+    inline constexpr auto until(
+        int version) -> VersionRange
+    {
+        return VersionRange{std::numeric_limits<int>::min(), version};
+    }
+
+    inline constexpr auto between(
+        int since,
+        int until) -> VersionRange
+    {
+        return VersionRange{since, until};
+    }
+
+    enum class FieldKind : uint8_t
+    {
+        // omitted outside its version range
+        value,
+        // integer stored as a boolean
+        boolean,
+        // null outside its version range, or when it is not present
+        nullable,
+    };
+
+    /**
+     * One json member of a definition structure
+     * presence: flag telling a nullable field is set, without it a container is present when it is not empty
+     */
+
+    template <typename Class, typename Value>
+    struct Field
+    {
+        std::string_view name;
+
+        Value Class::*member;
+
+        VersionRange version;
+
+        FieldKind kind;
+
+        bool Class::*presence;
+    };
+
+    template <typename Class, typename Value>
+    inline constexpr auto field(
+        std::string_view name,
+        Value Class::*member,
+        VersionRange version = k_every_version,
+        FieldKind kind = FieldKind::value,
+        bool Class::*presence = nullptr) -> Field<Class, Value>
+    {
+        return Field<Class, Value>{name, member, version, kind, presence};
+    }
+
+    /**
+     * Json layout of a definition structure, value is a tuple of Field in output order
+     * Every structure with a schema is written to JsonWriter and read from json by the functions below
+     */
+
+    template <typename Class>
+    struct Schema;
+
+    template <typename Class>
+    concept HasSchema = requires { Schema<Class>::value; };
+
+    template <typename Value>
+    struct IsList : std::false_type
+    {
+    };
+
+    template <typename Value>
+    struct IsList<std::vector<Value>> : std::true_type
+    {
+    };
+
+    template <typename Class, typename Value>
+    inline auto is_present(
+        Class const &value,
+        Field<Class, Value> const &field) -> bool
+    {
+        if (field.presence != nullptr)
+        {
+            return value.*field.presence;
+        }
+        if constexpr (requires { (value.*field.member).empty(); })
+        {
+            return !(value.*field.member).empty();
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template <typename Value>
+    inline auto write_value(
+        JsonWriter &writer,
+        Value const &value) -> void
+    {
+        if constexpr (HasSchema<Value>)
+        {
+            writer.WriteStartObject();
+            std::apply([&](auto const &...field)
+                       { (write_field(writer, value, field), ...); }, Schema<Value>::value);
+            writer.WriteEndObject();
+        }
+        else if constexpr (IsList<Value>::value)
+        {
+            writer.WriteStartArray();
+            for (auto const &element : value)
+            {
+                write_value(writer, element);
+            }
+            writer.WriteEndArray();
+        }
+        else if constexpr (std::is_enum_v<Value>)
+        {
+            writer.WriteValue(magic_enum::enum_name(value));
+        }
+        else if constexpr (std::is_same_v<Value, bool>)
+        {
+            writer.WriteBoolean(value);
+        }
+        else if constexpr (std::is_same_v<Value, std::string>)
+        {
+            writer.WriteValue(std::string_view{value});
+        }
+        else
+        {
+            static_assert(std::is_arithmetic_v<Value>, "unsupported field type");
+            writer.WriteValue(value);
+        }
+        return;
+    }
+
+    template <typename Class, typename Value>
+    inline auto write_field(
+        JsonWriter &writer,
+        Class const &value,
+        Field<Class, Value> const &field) -> void
+    {
+        auto in_range = field.version.contains(k_version);
+        if (!in_range && field.kind != FieldKind::nullable)
+        {
+            return;
+        }
+        writer.WritePropertyName(field.name);
+        if (field.kind == FieldKind::nullable && !(in_range && is_present(value, field)))
+        {
+            writer.WriteNull();
+            return;
+        }
+        if constexpr (std::is_arithmetic_v<Value>)
+        {
+            if (field.kind == FieldKind::boolean)
+            {
+                writer.WriteBoolean(static_cast<bool>(value.*field.member));
+                return;
+            }
+        }
+        write_value(writer, value.*field.member);
+        return;
+    }
+
+    template <typename Value>
+    inline auto read_value(
+        nlohmann::ordered_json const &json,
+        Value &value) -> void
+    {
+        if constexpr (std::is_enum_v<Value>)
+        {
+            value = magic_enum_cast<Value>(json.get<std::string>());
+        }
+        else
+        {
+            json.get_to(value);
+        }
+        return;
+    }
+
+    template <typename Class, typename Value>
+    inline auto read_field(
+        nlohmann::ordered_json const &json,
+        Class &value,
+        Field<Class, Value> const &field) -> void
+    {
+        if (!field.version.contains(k_version))
+        {
+            return;
+        }
+        if (field.kind == FieldKind::nullable)
+        {
+            auto element = json.find(field.name);
+            if (element == json.end() || element->is_null())
+            {
+                return;
+            }
+            read_value(*element, value.*field.member);
+            if (field.presence != nullptr)
+            {
+                value.*field.presence = true;
+            }
+            return;
+        }
+        read_value(json.at(field.name), value.*field.member);
+        return;
+    }
+
+    // found by nlohmann through ADL, so get_to work on every structure with a schema
+
+    template <typename Class>
+        requires HasSchema<Class>
+    inline auto from_json(
+        nlohmann::ordered_json const &json,
+        Class &value) -> void
+    {
+        std::apply([&](auto const &...field)
+                   { (read_field(json, value, field), ...); }, Schema<Class>::value);
+        return;
+    }
+
+}
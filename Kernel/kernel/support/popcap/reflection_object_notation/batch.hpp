@@ -0,0 +1,223 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/miscellaneous/batch.hpp"
+#include "kernel/support/popcap/reflection_object_notation/decode.hpp"
+#include "kernel/support/popcap/reflection_object_notation/encode.hpp"
+#include "kernel/support/popcap/reflection_object_notation/instance.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
+{
+    using namespace Definition;
+
+    /**
+     * use_rijndael: decode accept encrypted files, encode encrypt every file
+     * limit: maximum worker count
+     */
+
+    struct BatchSetting
+    {
+        bool use_rijndael;
+
+        std::string key;
+
+        std::string iv;
+
+        std::size_t limit;
+    };
+
+    using BatchError = Sen::Kernel::Support::Miscellaneous::Batch::Error;
+
+    using BatchResult = Sen::Kernel::Support::Miscellaneous::Batch::Result;
+
+    /**
+     * Convert a whole directory tree on a fixed pool of workers
+     * Every worker own its buffers, writer, parser and string tables, so nothing is allocated again
+     * once they have grown to the largest file the worker met
+     */
+
+    struct Batch
+    {
+    protected:
+        struct Arena
+        {
+            std::vector<std::uint8_t> input;
+
+            std::vector<std::uint8_t> output;
+
+            std::vector<std::uint8_t> encrypted;
+
+            JsonWriter writer;
+
+            std::vector<std::string_view> native_string_list;
+
+            std::vector<std::string_view> unicode_string_list;
+
+            StringTable native_string_index;
+
+            StringTable unicode_string_index;
+
+            simdjson::ondemand::parser parser;
+        };
+
+        using Job = Sen::Kernel::Support::Miscellaneous::Batch::Job;
+
+        // encrypted rton start with 0x10 0x00 instead of the magic
+
+        inline static auto is_encrypted(
+            const std::vector<std::uint8_t> &data) -> bool
+        {
+            return data.size() >= 2_size && data[0] == 0x10_byte && data[1] == 0x00_byte;
+        }
+
+        inline static auto decode_file(
+            Arena &arena,
+            const Job &job,
+            const BatchSetting &setting) -> void
+        {
+            FileSystem::read_binary(job.source, arena.input);
+            if (setting.use_rijndael && is_encrypted(arena.input))
+            {
+                auto source = DataStreamView{std::move(arena.input)};
+                arena.output.clear();
+                auto decrypted = DataStreamView{std::move(arena.output)};
+                Instance::decrypt(source, decrypted, setting.key, setting.iv);
+                arena.input = source.release();
+                arena.output = decrypted.release();
+                std::swap(arena.input, arena.output);
+            }
+            auto stream = DataStreamView{std::move(arena.input)};
+            arena.writer.Clear();
+            arena.writer.WriteIndent = true;
+            Decode::process_whole(stream, arena.writer, arena.native_string_list, arena.unicode_string_list);
+            arena.input = stream.release();
+            FileSystem::write_file(job.destination, arena.writer.View());
+            arena.writer.Clear();
+            return;
+        }
+
+        inline static auto encode_file(
+            Arena &arena,
+            const Job &job,
+            const BatchSetting &setting) -> void
+        {
+            FileSystem::read_binary(job.source, arena.input);
+            auto size = arena.input.size();
+            arena.input.resize(size + SIMDJSON_PADDING);
+            arena.output.clear();
+            auto stream = DataStreamView{std::move(arena.output)};
+            Encode::process_whole(stream, simdjson::padded_string_view{reinterpret_cast<const char *>(arena.input.data()), size, arena.input.size()}, arena.parser, arena.native_string_index, arena.unicode_string_index);
+            if (setting.use_rijndael)
+            {
+                arena.encrypted.clear();
+                auto encrypted = DataStreamView{std::move(arena.encrypted)};
+                Instance::encrypt(stream, encrypted, setting.key, setting.iv);
+                encrypted.out_file(job.destination);
+                arena.encrypted = encrypted.release();
+            }
+            else
+            {
+                stream.out_file(job.destination);
+            }
+            arena.output = stream.release();
+            return;
+        }
+
+        /**
+         * Workers pull the next job from a shared counter, the calling thread only report progress
+         * progress(done, total) always run on the calling thread, if it throw the remaining jobs are dropped
+         */
+
+        template <typename Convert, typename Progress>
+        inline static auto process(
+            std::vector<Job> const &job_list,
+            const BatchSetting &setting,
+            const Convert &convert,
+            const Progress &progress) -> BatchResult
+        {
+            auto total = job_list.size();
+            if (total == 0_size)
+            {
+                progress(0_size, 0_size);
+                return BatchResult{.processed = 0_size};
+            }
+            auto error_list = std::vector<std::optional<BatchError>>(total);
+            auto next = std::atomic<std::size_t>{0_size};
+            auto done = 0_size;
+            auto mutex = std::mutex{};
+            auto signal = std::condition_variable{};
+            auto worker_count = std::min<std::size_t>(std::max<std::size_t>(setting.limit, 1_size), total);
+            auto pool = ThreadPool{worker_count};
+            for (auto i : Range<std::size_t>(worker_count))
+            {
+                pool.enqueue([&]()
+                             {
+                    auto arena = std::make_unique<Arena>();
+                    for (auto index = next.fetch_add(1_size); index < total; index = next.fetch_add(1_size)) {
+                        error_list[index] = Sen::Kernel::Support::Miscellaneous::Batch::try_convert(job_list[index], [&](const Job &job) {
+                            convert(*arena, job, setting);
+                        });
+                        {
+                            auto lock = std::lock_guard<std::mutex>(mutex);
+                            ++done;
+                        }
+                        signal.notify_one();
+                    } });
+            }
+            try
+            {
+                auto reported = 0_size;
+                auto lock = std::unique_lock<std::mutex>(mutex);
+                while (reported < total)
+                {
+                    signal.wait(lock, [&]()
+                                { return done != reported; });
+                    reported = done;
+                    lock.unlock();
+                    progress(reported, total);
+                    lock.lock();
+                }
+            }
+            catch (...)
+            {
+                next.store(total);
+                pool.wait();
+                throw;
+            }
+            pool.wait();
+            return Sen::Kernel::Support::Miscellaneous::Batch::make_result(error_list);
+        }
+
+    public:
+        /**
+         * source: directory of rton files, encrypted files are decrypted when setting.use_rijndael is set
+         * destination: directory receiving the json files, the tree is mirrored
+         */
+
+        template <typename Progress>
+        inline static auto decode_directory(
+            std::string_view source,
+            std::string_view destination,
+            const BatchSetting &setting,
+            const Progress &progress) -> BatchResult
+        {
+            return process(Sen::Kernel::Support::Miscellaneous::Batch::make_job_list(source, destination, ".rton"_sv, ".json"_sv), setting, decode_file, progress);
+        }
+
+        /**
+         * source: directory of json files
+         * destination: directory receiving the rton files, the tree is mirrored
+         */
+
+        template <typename Progress>
+        inline static auto encode_directory(
+            std::string_view source,
+            std::string_view destination,
+            const BatchSetting &setting,
+            const Progress &progress) -> BatchResult
+        {
+            return process(Sen::Kernel::Support::Miscellaneous::Batch::make_job_list(source, destination, ".json"_sv, ".rton"_sv), setting, encode_file, progress);
+        }
+    };
+
+}
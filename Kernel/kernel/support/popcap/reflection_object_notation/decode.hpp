@@ -9,352 +9,441 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
     struct Decode : Common
     {
     protected:
-        template <auto write_key>
-        inline static auto exchange_value(
-            DataStreamView &stream,
-            JsonWriter &value,
-            std::vector<std::string> &native_string_index,
-            std::vector<std::string> &unicode_string_index,
-            TypeIdentifierEnumeration::Type const &type) -> void
+        using Type = TypeIdentifierEnumeration::Type;
+
+        /**
+         * Decoder state, the whole rton body is read through a raw cursor
+         * Strings are views into the source, so the string tables never copy them
+         */
+
+        struct Context
         {
-            static_assert(write_key == true || write_key == false, "write_key must be true or false");
-            switch (type)
-            {
-            case TypeIdentifierEnumeration::Type::boolean_false:
-            {
-                value.WriteBoolean(false);
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::boolean_true:
-            {
-                value.WriteBoolean(true);
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_8:
-            {
-                value.WriteValue(stream.readInt8());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_8_zero:
-            {
-                value.WriteValue(static_cast<int8_t>(0));
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_8:
-            {
-                value.WriteValue(stream.readUint8());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_8_zero:
-            {
-                value.WriteValue(static_cast<uint8_t>(0));
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_16:
-            {
-                value.WriteValue(stream.readInt16());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_16_zero:
-            {
-                value.WriteValue(static_cast<int16_t>(0));
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_16:
-            {
-                value.WriteValue(stream.readUint16());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_16_zero:
-            {
-                value.WriteValue(static_cast<uint16_t>(0));
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_32:
-            {
-                value.WriteValue(stream.readInt32());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_32_zero:
-            {
-                value.WriteValue(static_cast<int32_t>(0));
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_32:
-            {
-                value.WriteValue(stream.readUint32());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_32_zero:
-            {
-                value.WriteValue(static_cast<uint32_t>(0));
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_64:
-            {
-                value.WriteValue(stream.readInt64());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_signed_64_zero:
+            const std::uint8_t *begin;
+
+            const std::uint8_t *cursor;
+
+            const std::uint8_t *end;
+
+            std::size_t offset;
+
+            JsonWriter &value;
+
+            std::vector<std::string_view> &native_string_index;
+
+            std::vector<std::string_view> &unicode_string_index;
+
+            std::string rtid;
+        };
+
+        using Handler = void (*)(Context &);
+
+        // longest scalar payload, a 64 bit varint, checked once before the handler instead of per byte
+
+        inline static constexpr auto k_scalar_margin = 10_size;
+
+        inline static auto position(
+            Context const &context) -> std::size_t
+        {
+            return context.offset + static_cast<std::size_t>(context.cursor - context.begin);
+        }
+
+        [[noreturn]] inline static auto fail_bound(
+            Context const &context,
+            std::size_t size) -> void
+        {
+            throw Exception(fmt::format("{}, {}: {} + {} <= {}", Language::get("offset_outside_bounds_of_data_stream"), Language::get("offset"), position(context), size, context.offset + static_cast<std::size_t>(context.end - context.begin)), std::source_location::current(), "fail_bound");
+        }
+
+        [[noreturn]] inline static auto fail_bytecode(
+            Context const &context) -> void
+        {
+            throw Exception(fmt::format("{}. {}: 0x{:02x}", Kernel::Language::get("popcap.rton.decode.invalid_bytecode"), Kernel::Language::get("offset"), position(context)), std::source_location::current(), "exchange_value");
+        }
+
+        template <auto checked>
+        inline static auto ensure(
+            Context const &context,
+            std::size_t size) -> void
+        {
+            if constexpr (checked)
             {
-                value.WriteValue(static_cast<int64_t>(0));
-                break;
+                if (static_cast<std::size_t>(context.end - context.cursor) < size)
+                {
+                    fail_bound(context, size);
+                }
             }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_64:
+            return;
+        }
+
+        template <typename T, auto checked>
+        inline static auto read(
+            Context &context) -> T
+        {
+            ensure<checked>(context, sizeof(T));
+            auto result = T{};
+            std::memcpy(&result, context.cursor, sizeof(T));
+            context.cursor += sizeof(T);
+            return result;
+        }
+
+        /**
+         * T is the unsigned storage, at most 5 bytes for 32 bit and 10 bytes for 64 bit are read
+         * A longer varint is rejected at shift 35 or 70 like DataStreamView does, so it never go past k_scalar_margin
+         */
+
+        template <typename T, auto checked>
+        inline static auto read_varint(
+            Context &context) -> T
+        {
+            auto result = T{};
+            auto shift = 0_size;
+            for (; shift < sizeof(T) * 8_size; shift += 7_size)
             {
-                value.WriteValue(stream.readUint64());
-                break;
+                auto byte = read<std::uint8_t, checked>(context);
+                result |= static_cast<T>(byte & 0x7Fu) << shift;
+                if ((byte & 0x80u) == 0u)
+                {
+                    return result;
+                }
             }
-            case TypeIdentifierEnumeration::Type::integer_unsigned_64_zero:
+            throw Exception(fmt::format("{} {}", Language::get("invalid_varint_number"), shift), std::source_location::current(), "read_varint");
+        }
+
+        inline static auto read_string(
+            Context &context) -> std::string_view
+        {
+            auto size = static_cast<std::size_t>(read_varint<std::uint32_t, true>(context));
+            ensure<true>(context, size);
+            auto result = std::string_view{reinterpret_cast<const char *>(context.cursor), size};
+            context.cursor += size;
+            return result;
+        }
+
+        template <auto write_key>
+        inline static auto write_string(
+            Context &context,
+            std::string_view content) -> void
+        {
+            if constexpr (write_key)
             {
-                value.WriteValue(static_cast<uint64_t>(0));
-                break;
+                context.value.WritePropertyName(content);
             }
-            case TypeIdentifierEnumeration::Type::floater_signed_32:
+            else
             {
-                value.WriteValue(stream.readFloat());
-                break;
+                context.value.WriteValue(content);
             }
-            case TypeIdentifierEnumeration::Type::floater_signed_32_zero:
+            return;
+        }
+
+        // handlers, one per type identifier
+
+        inline static auto exchange_invalid(
+            Context &context) -> void
+        {
+            fail_bytecode(context);
+        }
+
+        template <auto boolean>
+        inline static auto exchange_boolean(
+            Context &context) -> void
+        {
+            context.value.WriteBoolean(boolean);
+            return;
+        }
+
+        template <typename T>
+        inline static auto exchange_zero(
+            Context &context) -> void
+        {
+            context.value.WriteValue(T{0});
+            return;
+        }
+
+        template <typename T, auto checked>
+        inline static auto exchange_fixed(
+            Context &context) -> void
+        {
+            context.value.WriteValue(read<T, checked>(context));
+            return;
+        }
+
+        template <typename T, auto use_zigzag, auto checked>
+        inline static auto exchange_varint(
+            Context &context) -> void
+        {
+            using Unsigned = std::make_unsigned_t<T>;
+            auto value = read_varint<Unsigned, checked>(context);
+            if constexpr (use_zigzag)
             {
-                value.WriteValue(static_cast<float>(0.0f));
-                break;
+                context.value.WriteValue(static_cast<T>((value >> 1) ^ (~(value & 1u) + 1u)));
             }
-            case TypeIdentifierEnumeration::Type::floater_signed_64:
+            else
             {
-                value.WriteValue(stream.readDouble());
-                break;
+                context.value.WriteValue(static_cast<T>(value));
             }
-            case TypeIdentifierEnumeration::Type::floater_signed_64_zero:
+            return;
+        }
+
+        template <auto write_key>
+        inline static auto exchange_string_native(
+            Context &context) -> void
+        {
+            write_string<write_key>(context, read_string(context));
+            return;
+        }
+
+        template <auto write_key>
+        inline static auto exchange_string_native_indexing(
+            Context &context) -> void
+        {
+            auto content = read_string(context);
+            write_string<write_key>(context, content);
+            context.native_string_index.emplace_back(content);
+            return;
+        }
+
+        template <auto write_key>
+        inline static auto exchange_string_unicode(
+            Context &context) -> void
+        {
+            read_varint<std::uint32_t, true>(context);
+            write_string<write_key>(context, read_string(context));
+            return;
+        }
+
+        template <auto write_key>
+        inline static auto exchange_string_unicode_indexing(
+            Context &context) -> void
+        {
+            read_varint<std::uint32_t, true>(context);
+            auto content = read_string(context);
+            write_string<write_key>(context, content);
+            context.unicode_string_index.emplace_back(content);
+            return;
+        }
+
+        template <auto write_key, auto use_unicode>
+        inline static auto exchange_string_indexed(
+            Context &context) -> void
+        {
+            auto &string_index = use_unicode ? context.unicode_string_index : context.native_string_index;
+            auto index = static_cast<std::size_t>(read_varint<std::uint32_t, true>(context));
+            if (index >= string_index.size())
             {
-                value.WriteValue(static_cast<double>(0.0));
-                break;
+                fail_bytecode(context);
             }
-            case TypeIdentifierEnumeration::Type::integer_variable_length_unsigned_32:
-            case TypeIdentifierEnumeration::Type::integer_variable_length_unsigned_32_equivalent:
+            write_string<write_key>(context, string_index[index]);
+            return;
+        }
+
+        template <auto write_key>
+        inline static auto exchange_string_rtid(
+            Context &context) -> void
+        {
+            switch (RTIDTypeIdentifierEnumeration::Type{read<std::uint8_t, true>(context)})
             {
-                value.WriteValue(stream.readVarInt32());
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::integer_variable_length_signed_32:
+            case RTIDTypeIdentifierEnumeration::Type::null:
             {
-                value.WriteValue(stream.readZigZag32());
+                write_string<write_key>(context, RTIDString::null);
                 break;
             }
-            case TypeIdentifierEnumeration::Type::integer_variable_length_unsigned_64:
-            case TypeIdentifierEnumeration::Type::integer_variable_length_unsigned_64_equivalent:
+            case RTIDTypeIdentifierEnumeration::Type::uid:
             {
-                value.WriteValue(stream.readVarInt64());
+                read_varint<std::uint32_t, true>(context);
+                auto sheet_content = read_string(context);
+                auto uid_middle = static_cast<std::int32_t>(read_varint<std::uint32_t, true>(context));
+                auto uid_first = static_cast<std::int32_t>(read_varint<std::uint32_t, true>(context));
+                auto uid_last = read<std::uint32_t, true>(context);
+                context.rtid.clear();
+                fmt::format_to(std::back_inserter(context.rtid), RTIDString::uid, uid_first, uid_middle, uid_last, sheet_content);
+                write_string<write_key>(context, context.rtid);
                 break;
             }
-            case TypeIdentifierEnumeration::Type::integer_variable_length_signed_64:
+            case RTIDTypeIdentifierEnumeration::Type::alias:
             {
-                value.WriteValue(stream.readZigZag64());
+                read_varint<std::uint32_t, true>(context);
+                auto sheet_content = read_string(context);
+                read_varint<std::uint32_t, true>(context);
+                auto alias_content = read_string(context);
+                context.rtid.clear();
+                fmt::format_to(std::back_inserter(context.rtid), RTIDString::alias, alias_content, sheet_content);
+                write_string<write_key>(context, context.rtid);
                 break;
             }
-            case TypeIdentifierEnumeration::Type::string_native:
-            {
-                if constexpr (write_key)
-                {
-                    value.WritePropertyName(stream.readStringByVarInt32());
-                }
-                else
-                {
-                    value.WriteValue(stream.readStringByVarInt32());
-                }
-                break;
+            default:
+                fail_bytecode(context);
             }
-            case TypeIdentifierEnumeration::Type::string_native_indexing:
-            {
+            return;
+        }
 
-                auto content = stream.readStringByVarInt32();
-                if constexpr (write_key)
-                {
-                    value.WritePropertyName(content);
-                }
-                else
-                {
-                    value.WriteValue(content);
-                }
-                native_string_index.emplace_back(content);
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::string_native_indexed:
-            {
-                auto index = stream.readVarInt32();
-                if constexpr (write_key)
-                {
-                    value.WritePropertyName(native_string_index[index]);
-                }
-                else
-                {
-                    value.WriteValue(native_string_index[index]);
-                }
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::string_unicode:
-            {
-                auto length = stream.readVarInt32();
-                auto content = stream.readStringByVarInt32();
-                if constexpr (write_key)
-                {
-                    value.WritePropertyName(content);
-                }
-                else
-                {
-                    value.WriteValue(content);
-                }
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::string_unicode_indexing:
+        template <auto write_key>
+        inline static auto exchange_string_rtid_null(
+            Context &context) -> void
+        {
+            write_string<write_key>(context, RTIDString::null);
+            return;
+        }
+
+        inline static auto exchange_array(
+            Context &context) -> void
+        {
+            context.value.WriteStartArray();
+            if (Type{read<std::uint8_t, true>(context)} != Type::array_size)
             {
-                auto length = stream.readVarInt32();
-                auto content = stream.readStringByVarInt32();
-                if constexpr (write_key)
-                {
-                    value.WritePropertyName(content);
-                }
-                else
-                {
-                    value.WriteValue(content);
-                }
-                unicode_string_index.emplace_back(content);
-                break;
+                throw Exception(fmt::format("{} {:02x}. {}: {:02x}", Kernel::Language::get("popcap.rton.decode.invalid_rton_array_starts"), static_cast<uint8_t>(Type::array_size), Kernel::Language::get("offset"), position(context)), std::source_location::current(), "exchange_value");
             }
-            case TypeIdentifierEnumeration::Type::string_unicode_indexed:
+            read_varint<std::uint32_t, true>(context);
+            while (true)
             {
-                auto index = stream.readVarInt32();
-                if constexpr (write_key)
-                {
-                    value.WritePropertyName(unicode_string_index[index]);
-                }
-                else
+                auto type = read<std::uint8_t, true>(context);
+                if (Type{type} == Type::array_end)
                 {
-                    value.WriteValue(unicode_string_index[index]);
+                    break;
                 }
-                break;
+                exchange_value<false>(context, type);
             }
-            case TypeIdentifierEnumeration::Type::string_rtid:
+            context.value.WriteEndArray();
+            return;
+        }
+
+        inline static auto exchange_object(
+            Context &context) -> void
+        {
+            context.value.WriteStartObject();
+            while (true)
             {
-                switch (RTIDTypeIdentifierEnumeration::Type{stream.readUint8()})
-                {
-                case RTIDTypeIdentifierEnumeration::Type::null:
+                auto key_type = read<std::uint8_t, true>(context);
+                if (Type{key_type} == Type::object_end)
                 {
-                    if constexpr (write_key)
-                    {
-                        value.WritePropertyName(RTIDString::null);
-                    }
-                    else
-                    {
-                        value.WriteValue(RTIDString::null);
-                    }
                     break;
                 }
-                case RTIDTypeIdentifierEnumeration::Type::uid:
-                {
-                    auto sheet_length = stream.readVarInt32();
-                    auto sheet_content = stream.readStringByVarInt32();
-                    auto uid_middle = stream.readVarInt32();
-                    auto uid_first = stream.readVarInt32();
-                    auto uid_last = stream.readUint32();
-                    if constexpr (write_key)
-                    {
-                        value.WritePropertyName(fmt::format(RTIDString::uid, uid_first, uid_middle, uid_last, sheet_content));
-                    }
-                    else
-                    {
-                        value.WriteValue(fmt::format(RTIDString::uid, uid_first, uid_middle, uid_last, sheet_content));
-                    }
+                exchange_value<true>(context, key_type);
+                exchange_value<false>(context, read<std::uint8_t, true>(context));
+            }
+            context.value.WriteEndObject();
+            return;
+        }
 
-                    break;
-                }
-                case RTIDTypeIdentifierEnumeration::Type::alias:
-                {
-                    auto sheet_length = stream.readVarInt32();
-                    auto sheet_content = stream.readStringByVarInt32();
-                    auto alias_length = stream.readVarInt32();
-                    auto alias_content = stream.readStringByVarInt32();
-                    if constexpr (write_key)
-                    {
-                        value.WritePropertyName(fmt::format(RTIDString::alias, alias_content, sheet_content));
-                    }
-                    else
-                    {
-                        value.WriteValue(fmt::format(RTIDString::alias, alias_content, sheet_content));
-                    }
+        /**
+         * Every type identifier map to its handler at compile-time, unknown ones throw
+         * Scalar handlers come in a checked and an unchecked flavour, the unchecked table is only
+         * used while k_scalar_margin bytes are left so the payload read skip its bound checks
+         */
 
-                    break;
-                }
-                default:
-                    assert_conditional(false, fmt::format("{}. {}: 0x{:02x}", Kernel::Language::get("popcap.rton.decode.invalid_bytecode"), Kernel::Language::get("offset"), stream.read_pos), "exchange_value");
-                }
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::string_rtid_null:
-            {
-                value.WriteValue(RTIDString::null);
-                break;
-            }
-            case TypeIdentifierEnumeration::Type::array_begin:
+        template <auto write_key, auto checked>
+        inline static consteval auto make_handler_table() -> std::array<Handler, 256_size>
+        {
+            auto table = std::array<Handler, 256_size>{};
+            table.fill(&exchange_invalid);
+            auto set = [&](Type type, Handler handler)
+            {
+                table[static_cast<std::size_t>(type)] = handler;
+            };
+            set(Type::boolean_false, &exchange_boolean<false>);
+            set(Type::boolean_true, &exchange_boolean<true>);
+            set(Type::integer_signed_8, &exchange_fixed<std::int8_t, checked>);
+            set(Type::integer_signed_8_zero, &exchange_zero<std::int8_t>);
+            set(Type::integer_unsigned_8, &exchange_fixed<std::uint8_t, checked>);
+            set(Type::integer_unsigned_8_zero, &exchange_zero<std::uint8_t>);
+            set(Type::integer_signed_16, &exchange_fixed<std::int16_t, checked>);
+            set(Type::integer_signed_16_zero, &exchange_zero<std::int16_t>);
+            set(Type::integer_unsigned_16, &exchange_fixed<std::uint16_t, checked>);
+            set(Type::integer_unsigned_16_zero, &exchange_zero<std::uint16_t>);
+            set(Type::integer_signed_32, &exchange_fixed<std::int32_t, checked>);
+            set(Type::integer_signed_32_zero, &exchange_zero<std::int32_t>);
+            set(Type::integer_unsigned_32, &exchange_fixed<std::uint32_t, checked>);
+            set(Type::integer_unsigned_32_zero, &exchange_zero<std::uint32_t>);
+            set(Type::integer_signed_64, &exchange_fixed<std::int64_t, checked>);
+            set(Type::integer_signed_64_zero, &exchange_zero<std::int64_t>);
+            set(Type::integer_unsigned_64, &exchange_fixed<std::uint64_t, checked>);
+            set(Type::integer_unsigned_64_zero, &exchange_zero<std::uint64_t>);
+            set(Type::floater_signed_32, &exchange_fixed<float, checked>);
+            set(Type::floater_signed_32_zero, &exchange_zero<float>);
+            set(Type::floater_signed_64, &exchange_fixed<double, checked>);
+            set(Type::floater_signed_64_zero, &exchange_zero<double>);
+            set(Type::integer_variable_length_unsigned_32, &exchange_varint<std::int32_t, false, checked>);
+            set(Type::integer_variable_length_unsigned_32_equivalent, &exchange_varint<std::int32_t, false, checked>);
+            set(Type::integer_variable_length_signed_32, &exchange_varint<std::int32_t, true, checked>);
+            set(Type::integer_variable_length_unsigned_64, &exchange_varint<std::int64_t, false, checked>);
+            set(Type::integer_variable_length_unsigned_64_equivalent, &exchange_varint<std::int64_t, false, checked>);
+            set(Type::integer_variable_length_signed_64, &exchange_varint<std::int64_t, true, checked>);
+            set(Type::string_native, &exchange_string_native<write_key>);
+            set(Type::string_native_indexing, &exchange_string_native_indexing<write_key>);
+            set(Type::string_native_indexed, &exchange_string_indexed<write_key, false>);
+            set(Type::string_unicode, &exchange_string_unicode<write_key>);
+            set(Type::string_unicode_indexing, &exchange_string_unicode_indexing<write_key>);
+            set(Type::string_unicode_indexed, &exchange_string_indexed<write_key, true>);
+            set(Type::string_rtid, &exchange_string_rtid<write_key>);
+            set(Type::string_rtid_null, &exchange_string_rtid_null<write_key>);
+            set(Type::array_begin, &exchange_array);
+            set(Type::object_begin, &exchange_object);
+            return table;
+        }
+
+        template <auto write_key, auto checked>
+        inline static constexpr auto k_handler_table = make_handler_table<write_key, checked>();
+
+        template <auto write_key>
+        inline static auto exchange_value(
+            Context &context,
+            std::uint8_t type) -> void
+        {
+            static_assert(write_key == true || write_key == false, "write_key must be true or false");
+            if (static_cast<std::size_t>(context.end - context.cursor) >= k_scalar_margin) [[likely]]
             {
-                value.WriteStartArray();
-                assert_conditional(TypeIdentifierEnumeration::Type{stream.readUint8()} == TypeIdentifierEnumeration::Type::array_size, fmt::format("{} {:02x}. {}: {:02x}", Kernel::Language::get("popcap.rton.decode.invalid_rton_array_starts"), static_cast<uint8_t>(TypeIdentifierEnumeration::Type::array_size), Kernel::Language::get("offset"), stream.read_pos), "exchange_value");
-                auto size = stream.readVarInt32();
-                auto array_size = 0;
-                while (true)
-                {
-                    auto value_type_identifier = TypeIdentifierEnumeration::Type{stream.readUint8()};
-                    if (value_type_identifier == TypeIdentifierEnumeration::Type::array_end)
-                    {
-                        break;
-                    }
-                    ++array_size;
-                    exchange_value<false>(stream, value, native_string_index, unicode_string_index, value_type_identifier);
-                }
-                assert(array_size == size);
-                value.WriteEndArray();
-                break;
+                k_handler_table<write_key, false>[type](context);
             }
-            case TypeIdentifierEnumeration::Type::object_begin:
+            else
             {
-                value.WriteStartObject();
-                while (true)
-                {
-                    auto key_type_identifier = TypeIdentifierEnumeration::Type{stream.readUint8()};
-                    if (key_type_identifier == TypeIdentifierEnumeration::Type::object_end)
-                    {
-                        break;
-                    }
-                    exchange_value<true>(stream, value, native_string_index, unicode_string_index, key_type_identifier);
-                    auto value_type_identifier = TypeIdentifierEnumeration::Type{stream.readUint8()};
-                    exchange_value<false>(stream, value, native_string_index, unicode_string_index, value_type_identifier);
-                }
-                value.WriteEndObject();
-                break;
-            }
-            default:
-                assert_conditional(false, fmt::format("{}. {}: 0x{:02x}", Kernel::Language::get("popcap.rton.decode.invalid_bytecode"), Kernel::Language::get("offset"), stream.read_pos), "exchange_value");
+                k_handler_table<write_key, true>[type](context);
             }
             return;
         }
 
     public:
+        // the string tables are cleared first and hold views into the stream, so they are only valid while it is alive
+
         inline static auto process_whole(
             DataStreamView &stream,
-            JsonWriter &value) -> void
+            JsonWriter &value,
+            std::vector<std::string_view> &native_string_index,
+            std::vector<std::string_view> &unicode_string_index) -> void
         {
             assert_conditional(stream.readString(4) == k_magic_identifier, fmt::format("{}", Kernel::Language::get("popcap.rton.decode.invalid_rton_magic")), "process_whole");
             {
                 auto version = stream.readUint32();
                 assert_conditional(version == k_version, String::format(fmt::format("{}", Language::get("popcap.rton.version_is_invalid")), std::to_string(version)), "process_whole");
             }
-            auto native_string_index = std::vector<std::string>{};
-            auto unicode_string_index = std::vector<std::string>{};
-            exchange_value<false>(stream, value, native_string_index, unicode_string_index, TypeIdentifierEnumeration::Type::object_begin);
+            native_string_index.clear();
+            unicode_string_index.clear();
+            auto offset = stream.read_pos;
+            auto size = stream.size() - offset;
+            auto data = stream.read_block(size);
+            auto context = Context{
+                .begin = data,
+                .cursor = data,
+                .end = data + size,
+                .offset = offset,
+                .value = value,
+                .native_string_index = native_string_index,
+                .unicode_string_index = unicode_string_index,
+            };
+            exchange_object(context);
+            stream.change_read_pos(position(context));
             assert_conditional(stream.readString(4) == k_done_identifier, fmt::format("{}", Language::get("popcap.rton.done_invalid")), "process_whole");
             return;
         }
 
+        inline static auto process_whole(
+            DataStreamView &stream,
+            JsonWriter &value) -> void
+        {
+            auto native_string_index = std::vector<std::string_view>{};
+            auto unicode_string_index = std::vector<std::string_view>{};
+            process_whole(stream, value, native_string_index, unicode_string_index);
+            return;
+        }
+
         inline static auto process_fs(
             std::string_view source,
             std::string_view definition) -> void
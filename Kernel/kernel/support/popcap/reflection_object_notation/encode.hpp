@@ -15,8 +15,8 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
         inline static auto exchange_string(
             DataStreamView &stream,
             std::string_view value,
-            std::unordered_map<std::string_view, int> &native_string_index,
-            std::unordered_map<std::string_view, int> &unicode_string_index) -> void
+            StringTable &native_string_index,
+            StringTable &unicode_string_index) -> void
         {
             auto is_rtid = false;
             if (value.size() > "RTID(0)"_sv.size() && value.starts_with("RTID("_sv) && value.ends_with(")"_sv))
@@ -65,33 +65,32 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
             }
             if (!is_rtid)
             {
-                if (auto string_length = compute_utf8_character_length(value) == value.size())
+                auto string_length = compute_utf8_character_length(value);
+                if (string_length == value.size())
                 {
-                    if (auto indexed_string = native_string_index.find(value); indexed_string != native_string_index.end())
+                    if (auto [index, inserted] = native_string_index.insert(value); !inserted)
                     {
                         stream.writeUint8(static_cast<uint8_t>(TypeIdentifierEnumeration::Type::string_native_indexed));
-                        stream.writeVarInt32(indexed_string->second);
+                        stream.writeVarInt32(static_cast<int>(index));
                     }
                     else
                     {
                         stream.writeUint8(static_cast<uint8_t>(TypeIdentifierEnumeration::Type::string_native_indexing));
                         stream.writeStringByVarInt32(value);
-                        native_string_index[value] = native_string_index.size();
                     }
                 }
                 else
                 {
-                    if (auto indexed_string = unicode_string_index.find(value); indexed_string != unicode_string_index.end())
+                    if (auto [index, inserted] = unicode_string_index.insert(value); !inserted)
                     {
                         stream.writeUint8(static_cast<uint8_t>(TypeIdentifierEnumeration::Type::string_unicode_indexed));
-                        stream.writeVarInt32(static_cast<int>(std::distance(unicode_string_index.begin(), indexed_string)));
+                        stream.writeVarInt32(static_cast<int>(index));
                     }
                     else
                     {
                         stream.writeUint8(static_cast<uint8_t>(TypeIdentifierEnumeration::Type::string_unicode_indexing));
-                        stream.writeVarInt32(string_length);
+                        stream.writeVarInt32(static_cast<int>(string_length));
                         stream.writeStringByVarInt32(value);
-                        unicode_string_index[value] = unicode_string_index.size();
                     }
                 }
             }
@@ -192,8 +191,8 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
         inline static auto exchange_value(
             DataStreamView &stream,
             ondemand::value value,
-            std::unordered_map<std::string_view, int> &native_string_index,
-            std::unordered_map<std::string_view, int> &unicode_string_index) -> void
+            StringTable &native_string_index,
+            StringTable &unicode_string_index) -> void
         {
             static_assert(remove_start_object == true || remove_start_object == false, "remove_start_object must be true or false");
             switch (value.type())
@@ -252,22 +251,40 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
         }
 
     public:
+        /**
+         * content: json text, the view must own SIMDJSON_PADDING readable bytes after its end
+         * ondemand_parser, native_string_index, unicode_string_index: reused between calls, the tables are cleared first
+         */
+
         inline static auto process_whole(
             DataStreamView &stream,
-            std::string const &content) -> void
+            simdjson::padded_string_view content,
+            ondemand::parser &ondemand_parser,
+            StringTable &native_string_index,
+            StringTable &unicode_string_index) -> void
         {
-            auto ondemand_parser = ondemand::parser{};
-            auto padded_string = simdjson::padded_string(content);
-            auto document = static_cast<ondemand::document>(ondemand_parser.iterate(padded_string));
+            auto document = static_cast<ondemand::document>(ondemand_parser.iterate(content));
             stream.writeString(k_magic_identifier);
             stream.writeUint32(k_version);
-            auto native_string_index = std::unordered_map<std::string_view, int>{};
-            auto unicode_string_index = std::unordered_map<std::string_view, int>{};
+            native_string_index.clear();
+            unicode_string_index.clear();
             exchange_value<true>(stream, document.get_value(), native_string_index, unicode_string_index);
             stream.writeString(k_done_identifier);
             return;
         }
 
+        inline static auto process_whole(
+            DataStreamView &stream,
+            std::string const &content) -> void
+        {
+            auto ondemand_parser = ondemand::parser{};
+            auto padded_string = simdjson::padded_string(content);
+            auto native_string_index = StringTable{};
+            auto unicode_string_index = StringTable{};
+            process_whole(stream, padded_string, ondemand_parser, native_string_index, unicode_string_index);
+            return;
+        }
+
         inline static auto process_fs(
             std::string_view source,
             std::string_view destination) -> void
@@ -59,21 +59,14 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
             return;
         }
 
+        // every pair is [source, destination], pairs run on a bounded pool instead of one thread each
+
         inline static auto decode_fs_as_multiple_threads(
             const std::vector<std::vector<std::string>> &paths) -> void
         {
-            auto threads = std::vector<std::thread>{};
-            auto file_mutexes = std::map<std::string, std::mutex>{};
-            for (const auto & data : paths) {
-                threads.emplace_back([=, &file_mutexes]() { 
-                auto lock_source = std::lock_guard<std::mutex>(file_mutexes[data[0]]);
-                auto lock_destination = std::lock_guard<std::mutex>(file_mutexes[data[1]]);
-                    Decode::process_fs(data[0], data[1]); 
-                });
-            }
-            for (auto & thread : threads) {
-                thread.join();
-            }
+            parallel_for(paths.size(), [&](std::size_t index) {
+                Decode::process_fs(paths[index][0], paths[index][1]);
+            });
             return;
         }
 
@@ -127,20 +120,9 @@ namespace Sen::Kernel::Support::PopCap::ReflectionObjectNotation
         inline static auto encode_fs_as_multiple_threads(
             const std::vector<std::vector<std::string>> &paths) -> void
         {
-            auto threads = std::vector<std::thread>{};
-            auto file_mutexes = std::map<std::string, std::mutex>{};
-            for (const auto &data : paths)
-            {
-                threads.emplace_back([=, &file_mutexes]()
-                                     { 
-                auto lock_source = std::lock_guard<std::mutex>(file_mutexes[data[0]]);
-                auto lock_destination = std::lock_guard<std::mutex>(file_mutexes[data[1]]);
-                    Encode::process_fs(data[0], data[1]); });
-            }
-            for (auto &thread : threads)
-            {
-                thread.join();
-            }
+            parallel_for(paths.size(), [&](std::size_t index) {
+                Encode::process_fs(paths[index][0], paths[index][1]);
+            });
             return;
         }
     };
@@ -3,6 +3,7 @@
 #include "kernel/definition/utility.hpp"
 #include "kernel/support/popcap/resource_group/convert.hpp"
 #include "kernel/support/popcap/resource_group/common.hpp"
+#include "kernel/support/popcap/res_info/definition.hpp"
 
 namespace Sen::Kernel::Support::PopCap::ResInfo {
 	
@@ -10,45 +11,6 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 
 	using namespace Definition;
 
-	// sub information
-
-	class SubInformation {
-
-		public:
-
-			// id
-
-			std::string_view id;
-
-			// parent
-
-			std::string_view parent;
-
-			// constructor
-
-			explicit SubInformation(
-
-			) = default;
-
-			// should use this constructor
-
-			explicit SubInformation(
-				std::string_view id,
-				std::string_view parent
-			) : id(id), parent(parent)
-			{
-
-			}
-			
-			// destructor
-
-			~SubInformation(
-
-			) = default;
-
-
-	};
-
 	// using namespace resource group
 
 	using namespace ResourceGroup;
@@ -71,164 +33,266 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 
 			inline static auto constexpr Simple = std::string_view{"simple"};
 
+			using SlotIndex = std::unordered_map<std::string_view, std::size_t>;
+
 			// constructor
 
 		protected:
 
 			/**
 			 * Generate composite for object
-			 * id: current id
-			 * composite: composite json object
-			 * return: new json object that has been generated
+			 * group: composite group
+			 * value: json writer
 			*/
 
-			inline auto generate_composite(
-				std::string_view id,
-    			const nlohmann::ordered_json & composite
-			) -> nlohmann::ordered_json
+			inline static auto generate_composite(
+				const GroupInformation & group,
+				JsonWriter & value
+			) -> void
 			{
-				auto result = nlohmann::ordered_json{
-					{ "type", Convert::Composite },
-					{ "id", id },
-					{ "subgroups", nlohmann::ordered_json::array() }
-				};
-				for(auto & [element, value] : composite["subgroup"].items()) {
-					auto subgroup = nlohmann::ordered_json {
-						{"id", element}
-					};
-					if(!composite["subgroup"][element]["type"].is_null() and composite["subgroup"][element]["type"].get<std::string_view>() != Convert::emptyType){
-						subgroup["res"] = composite["subgroup"][element]["type"].get<std::string_view>();
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"type"});
+				value.WriteValue(std::string{Convert::Composite});
+				value.WritePropertyName(std::string{"id"});
+				value.WriteValue(group.id);
+				value.WritePropertyName(std::string{"subgroups"});
+				value.WriteStartArray();
+				for (auto & subgroup : group.subgroup) {
+					value.WriteStartObject();
+					value.WritePropertyName(std::string{"id"});
+					value.WriteValue(subgroup.id);
+					if (subgroup.is_image()) {
+						value.WritePropertyName(std::string{"res"});
+						value.WriteValue(subgroup.type.value());
 					}
-					if (composite["subgroup"][element].find("loc") != composite["subgroup"][element].end()) {
-						subgroup["loc"] = composite["subgroup"][element]["loc"];
+					if (subgroup.loc.has_value()) {
+						value.WritePropertyName(std::string{"loc"});
+						value.WriteValue(subgroup.loc.value());
 					}
-					result["subgroups"].emplace_back(subgroup);
+					value.WriteEndObject();
 				}
-				return result;
+				value.WriteEndArray();
+				value.WriteEndObject();
+				return;
+			}
+
+			template <auto use_string_for_style>
+			inline static auto generate_path(
+				const std::string & path,
+				JsonWriter & value
+			) -> void
+			{
+				static_assert(use_string_for_style == true or use_string_for_style == false);
+				value.WritePropertyName(std::string{"path"});
+				if constexpr (use_string_for_style) {
+					value.WriteValue(String::replaceAll(path, ResourceGroup::Common::PosixStyle, ResourceGroup::Common::WindowStyle));
+				}
+				else {
+					value.WriteStartArray();
+					for (auto & element : String::split(path, ResourceGroup::Common::PosixStyle)) {
+						value.WriteValue(element);
+					}
+					value.WriteEndArray();
+				}
+				return;
+			}
+
+			// type, slot and id open every resource
+
+			inline static auto generate_resource_head(
+				const std::string & type,
+				const std::string & id,
+				const SlotIndex & slot,
+				JsonWriter & value
+			) -> void
+			{
+				value.WritePropertyName(std::string{"type"});
+				value.WriteValue(type);
+				value.WritePropertyName(std::string{"slot"});
+				value.WriteValue(slot.at(id));
+				value.WritePropertyName(std::string{"id"});
+				value.WriteValue(id);
+				return;
 			}
 
 			/**
 			 * Generate common file information
-			 * extra information: necessary information, parent can be empty btw
-			 * resource_information: necessary resource information
-			 * return: generated common information
+			 * subgroup: common subgroup
+			 * parent: parent id, can be empty
+			 * slot: slot of every resource id
+			 * value: json writer
 			*/
+
 			template <auto use_string_for_style>
-			inline auto generate_common(
-				const SubInformation & extra_information,
-				const nlohmann::ordered_json & resource_information
-			) -> nlohmann::ordered_json
+			inline static auto generate_common(
+				const SubgroupInformation & subgroup,
+				std::string_view parent,
+				const SlotIndex & slot,
+				JsonWriter & value
+			) -> void
 			{
-				static_assert(use_string_for_style == true or use_string_for_style == false);
-				static_assert(sizeof(use_string_for_style) == sizeof(bool));
-				auto result = nlohmann::ordered_json {
-					{"type", Simple},
-					{"id", extra_information.id}
-				};
-				if (resource_information.find("loc") != resource_information.end()) {
-					result["loc"] = resource_information["loc"];
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"type"});
+				value.WriteValue(std::string{Simple});
+				value.WritePropertyName(std::string{"id"});
+				value.WriteValue(subgroup.id);
+				if (subgroup.loc.has_value()) {
+					value.WritePropertyName(std::string{"loc"});
+					value.WriteValue(subgroup.loc.value());
 				}
-				result["resources"] = nlohmann::ordered_json::array();
-				if(!extra_information.parent.empty()){
-					result["parent"] = extra_information.parent;
+				value.WritePropertyName(std::string{"resources"});
+				value.WriteStartArray();
+				for (auto & element : subgroup.file) {
+					value.WriteStartObject();
+					generate_resource_head(element.type, element.id, slot, value);
+					generate_path<use_string_for_style>(element.path, value);
+					value.WriteEndObject();
 				}
-				for(auto & [key, value] : resource_information["packet"]["data"].items()){
-					auto resource = nlohmann::ordered_json {
-						{"type", value["type"].get<std::string>()},
-						{"slot", 0},
-						{"id", key}
-					};
-					if constexpr (use_string_for_style){
-						resource["path"] = String::replaceAll(value["path"].get<std::string>(), ResourceGroup::Common::PosixStyle, ResourceGroup::Common::WindowStyle);
-					}
-					else{
-						resource["path"] = String::split(value["path"].get<std::string>(), ResourceGroup::Common::PosixStyle);
-					}
-					result["resources"].emplace_back(resource);
+				value.WriteEndArray();
+				if (!parent.empty()) {
+					value.WritePropertyName(std::string{"parent"});
+					value.WriteValue(std::string{parent});
 				}
-				return result;
+				value.WriteEndObject();
+				return;
 			}
 
 			/**
 			 * Generate atlas information
-			 * extra information: necessary information, parent can not be empty
-			 * resource_information: necessary resource information
-			 * return: generated atlas information
+			 * subgroup: image subgroup
+			 * parent: parent id, can not be empty
+			 * slot: slot of every resource id
+			 * value: json writer
 			*/
+
 			template <auto use_string_for_style>
-			inline auto generate_image(
-				const SubInformation & extra_information,
-				const nlohmann::ordered_json & resource_information
-			) -> nlohmann::ordered_json
+			inline static auto generate_image(
+				const SubgroupInformation & subgroup,
+				std::string_view parent,
+				const SlotIndex & slot,
+				JsonWriter & value
+			) -> void
 			{
-				static_assert(use_string_for_style == true or use_string_for_style == false);
-				static_assert(sizeof(use_string_for_style) == sizeof(bool));
-				auto result = nlohmann::ordered_json {
-					{"type", Simple},
-					{"id", extra_information.id},
-					{"res", resource_information["type"].get<std::string>()},
-					{"parent", extra_information.parent},
-					{"resources", nlohmann::ordered_json::array()}
-				};
-				for(auto & [key, value] : resource_information["packet"].items()){
-					auto resource = nlohmann::ordered_json {
-						{"type", value["type"].get<std::string>()},
-						{"slot", 0},
-						{"id", key},
-						{"atlas", true},
-						{"runtime", true},
-						{"width", value["dimension"]["width"].get<int>()},
-						{"height", value["dimension"]["height"].get<int>()}
-					};
-					if constexpr (use_string_for_style){
-						resource["path"] = String::replaceAll(value["path"].get<std::string>(), ResourceGroup::Common::PosixStyle, ResourceGroup::Common::WindowStyle);
-					}
-					else{
-						resource["path"] = String::split(value["path"].get<std::string>(), Common::PosixStyle);
-					}
-					result["resources"].emplace_back(resource);
-					for(auto & [sub, sub_value] : value["data"].items()){
-						auto sub_resource = nlohmann::ordered_json {
-							{"type", sub_value["type"].get<std::string>()},
-							{"slot", 0},
-							{"id", sub},
-							{"parent", key}
-						};
-						if constexpr (use_string_for_style){
-							sub_resource["path"] = String::replaceAll(sub_value["path"].get<std::string>(), Common::PosixStyle , ResourceGroup::Common::WindowStyle);
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"type"});
+				value.WriteValue(std::string{Simple});
+				value.WritePropertyName(std::string{"id"});
+				value.WriteValue(subgroup.id);
+				value.WritePropertyName(std::string{"res"});
+				value.WriteValue(subgroup.type.value());
+				value.WritePropertyName(std::string{"parent"});
+				value.WriteValue(std::string{parent});
+				value.WritePropertyName(std::string{"resources"});
+				value.WriteStartArray();
+				for (auto & atlas : subgroup.atlas) {
+					value.WriteStartObject();
+					generate_resource_head(atlas.type, atlas.id, slot, value);
+					value.WritePropertyName(std::string{"atlas"});
+					value.WriteBoolean(true);
+					value.WritePropertyName(std::string{"runtime"});
+					value.WriteBoolean(true);
+					value.WritePropertyName(std::string{"width"});
+					value.WriteValue(atlas.width);
+					value.WritePropertyName(std::string{"height"});
+					value.WriteValue(atlas.height);
+					generate_path<use_string_for_style>(atlas.path, value);
+					value.WriteEndObject();
+					for (auto & sprite : atlas.data) {
+						value.WriteStartObject();
+						generate_resource_head(sprite.type, sprite.id, slot, value);
+						value.WritePropertyName(std::string{"parent"});
+						value.WriteValue(atlas.id);
+						generate_path<use_string_for_style>(sprite.path, value);
+						if (sprite.x.has_value() and sprite.x.value() != ResourceGroup::Common::DefaultCoordinateOffset) {
+							value.WritePropertyName(std::string{"x"});
+							value.WriteValue(sprite.x.value());
 						}
-						else{
-							sub_resource["path"] = String::split(sub_value["path"].get<std::string>(), Common::PosixStyle);
+						if (sprite.y.has_value() and sprite.y.value() != ResourceGroup::Common::DefaultCoordinateOffset) {
+							value.WritePropertyName(std::string{"y"});
+							value.WriteValue(sprite.y.value());
 						}
-						if (sub_value["default"].find("x") != sub_value["default"].end() and sub_value["default"]["x"].get<int>() != ResourceGroup::Common::DefaultCoordinateOffset) {
-							sub_resource["x"] =  sub_value["default"]["x"].get<int>();
+						if (sprite.rows.has_value() and sprite.rows.value() != ResourceGroup::Common::DefaultLayoutOffset) {
+							value.WritePropertyName(std::string{"rows"});
+							value.WriteValue(sprite.rows.value());
 						}
-						if (sub_value["default"].find("y") != sub_value["default"].end() and sub_value["default"]["y"].get<int>() != ResourceGroup::Common::DefaultCoordinateOffset) {
-							sub_resource["y"] =  sub_value["default"]["y"].get<int>();
+						if (sprite.cols.has_value() and sprite.cols.value() != ResourceGroup::Common::DefaultLayoutOffset) {
+							value.WritePropertyName(std::string{"cols"});
+							value.WriteValue(sprite.cols.value());
 						}
-						if (sub_value["default"].find("rows") != sub_value["default"].end() and sub_value["default"]["rows"].get<int>() != ResourceGroup::Common::DefaultLayoutOffset) {
-							sub_resource["rows"] =  sub_value["default"]["rows"].get<int>();
+						value.WritePropertyName(std::string{"ax"});
+						value.WriteValue(sprite.ax);
+						value.WritePropertyName(std::string{"ay"});
+						value.WriteValue(sprite.ay);
+						value.WritePropertyName(std::string{"aw"});
+						value.WriteValue(sprite.aw);
+						value.WritePropertyName(std::string{"ah"});
+						value.WriteValue(sprite.ah);
+						value.WriteEndObject();
+					}
+				}
+				value.WriteEndArray();
+				value.WriteEndObject();
+				return;
+			}
+
+			/**
+			 * Slot are shared by resource id, first seen first numbered
+			 * res_info: typed res info
+			 * return: slot of every resource id
+			*/
+
+			inline static auto generate_slot(
+				const ResInfoInformation & res_info
+			) -> SlotIndex
+			{
+				auto result = SlotIndex{};
+				auto insert = [&](std::string_view id) -> void {
+					result.try_emplace(id, result.size());
+					return;
+				};
+				for (auto & group : res_info.groups) {
+					for (auto & subgroup : group.subgroup) {
+						for (auto & element : subgroup.file) {
+							insert(element.id);
 						}
-						if (sub_value["default"].find("cols") != sub_value["default"].end() and sub_value["default"]["cols"].get<int>() != ResourceGroup::Common::DefaultLayoutOffset) {
-							sub_resource["cols"] =  sub_value["default"]["cols"].get<int>();
+						for (auto & atlas : subgroup.atlas) {
+							insert(atlas.id);
+							for (auto & sprite : atlas.data) {
+								insert(sprite.id);
+							}
 						}
-						sub_resource["ax"] = sub_value["default"]["ax"].get<int>();
-						sub_resource["ay"] = sub_value["default"]["ay"].get<int>();
-						sub_resource["aw"] = sub_value["default"]["aw"].get<int>();
-						sub_resource["ah"] = sub_value["default"]["ah"].get<int>();
-						result["resources"].emplace_back(sub_resource);
 					}
 				}
 				return result;
 			}
 
-
-		private:
-
-			// use windows path : new style
-
-			bool use_string_for_style;
-
+			template <auto use_string_for_style>
+			inline static auto generate_group(
+				const ResInfoInformation & res_info,
+				const SlotIndex & slot,
+				JsonWriter & value
+			) -> void
+			{
+				for (auto & group : res_info.groups) {
+					if (group.is_composite) {
+						generate_composite(group, value);
+						for (auto & subgroup : group.subgroup) {
+							if (subgroup.is_image()) {
+								generate_image<use_string_for_style>(subgroup, group.id, slot, value);
+							}
+							else {
+								generate_common<use_string_for_style>(subgroup, group.id, slot, value);
+							}
+						}
+					}
+					else {
+						for (auto & subgroup : group.subgroup) {
+							generate_common<use_string_for_style>(subgroup, Convert::emptyString, slot, value);
+						}
+					}
+				}
+				return;
+			}
 
 		public:
 
@@ -247,102 +311,35 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 			/**
 			 * This method do everything 
 			 * res_info: Res Info after deserialized as object
-			 * return: Resource Group
+			 * value: json writer that receive Resource Group
 			*/
 
-			inline auto process(
+			inline static auto process(
 				const nlohmann::ordered_json & res_info,
-				nlohmann::ordered_json &result
+				JsonWriter & value
 			) -> void
 			{
 				assert_conditional(res_info.find("expand_path") != res_info.end(), fmt::format("{}", Kernel::Language::get("popcap.res_info.convert.expand_path_is_null_in_res_info")), "process");
 				assert_conditional(res_info.find("groups") != res_info.end(), fmt::format("{}", Kernel::Language::get("popcap.res_info.convert.groups_is_null_in_res_info")), "process");
-				if(res_info["expand_path"].get<std::string>() == "string"){
-					thiz.use_string_for_style = true;
+				auto information = parse_res_info(res_info);
+				auto slot = generate_slot(information);
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"version"});
+				value.WriteValue(1);
+				value.WritePropertyName(std::string{"content_version"});
+				value.WriteValue(1);
+				value.WritePropertyName(std::string{"slot_count"});
+				value.WriteValue(slot.size());
+				value.WritePropertyName(std::string{"groups"});
+				value.WriteStartArray();
+				if (information.use_string_for_style) {
+					generate_group<true>(information, slot, value);
 				}
-				else{
-					thiz.use_string_for_style = false;
+				else {
+					generate_group<false>(information, slot, value);
 				}
-				for(auto & [composite_name, group] : res_info["groups"].items()){
-					if(group["is_composite"].get<bool>()){
-        				result["groups"].emplace_back(thiz.generate_composite(composite_name, group));
-						for(auto & [subgroup_name, subgroup_value] : group["subgroup"].items()){
-							if (!subgroup_value["type"].is_null() and subgroup_value["type"].get<std::string>() != Convert::emptyType) {
-								if (thiz.use_string_for_style) {
-									result["groups"].emplace_back(
-										thiz.generate_image<true>(
-											SubInformation(subgroup_name, composite_name),
-											subgroup_value
-										)
-									);
-								}
-								else {
-									result["groups"].emplace_back(
-										thiz.generate_image<false>(
-											SubInformation(subgroup_name, composite_name),
-											subgroup_value
-										)
-									);
-								}
-							}
-							else{
-								if (thiz.use_string_for_style) { 
-									result["groups"].emplace_back(
-										thiz.generate_common<true>(
-											SubInformation(subgroup_name, composite_name),
-											subgroup_value
-										)
-									);
-								}
-								else {
-									result["groups"].emplace_back(
-										thiz.generate_common<false>(
-											SubInformation(subgroup_name, composite_name),
-											subgroup_value
-										)
-									);
-								}
-							}
-						}
-					}
-					else{
-						for(auto & [subgroup_name, subgroup_value] : group["subgroup"].items()){
-							if (thiz.use_string_for_style) {
-								result["groups"].emplace_back(
-									thiz.generate_common<true>(
-										SubInformation(subgroup_name, Convert::emptyString),
-										subgroup_value
-									)
-								);
-							}
-							else {
-								result["groups"].emplace_back(
-									thiz.generate_common<false>(
-										SubInformation(subgroup_name, Convert::emptyString),
-										subgroup_value
-									)
-								);
-							}
-						}
-					}
-				}
-				Convert::rewrite_slot_count(result);
-				return;
-			}
-
-			/**
-			 * Quick convert function
-			 * @param res_info: Res-Info object
-			 * @return: nlohmann json object as Resource Group
-			*/
-
-			inline static auto convert (
-				const nlohmann::ordered_json & res_info,
-				nlohmann::ordered_json &destination
-			) -> void
-			{
-				auto converter = Sen::Kernel::Support::PopCap::ResInfo::Convert{};
-				converter.process(res_info, destination);
+				value.WriteEndArray();
+				value.WriteEndObject();
 				return;
 			}
 
@@ -358,14 +355,10 @@ namespace Sen::Kernel::Support::PopCap::ResInfo {
 				std::string_view destination
 			) -> void
 			{
-				auto result = nlohmann::ordered_json {
-					{"version", 1},
-					{"content_version", 1},
-					{"slot_count", 0},
-					{"groups", nlohmann::ordered_json::array()}
-				};
-				Convert::convert(*FileSystem::read_json(source), result);
-				FileSystem::write_json(destination, result);
+				auto writer = JsonWriter{};
+				writer.WriteIndent = true;
+				Convert::process(*FileSystem::read_json(source), writer);
+				FileSystem::write_file(destination, writer.ToString());
 				return;
 			}
 
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ResInfo {
+
+	// use definition
+
+	using namespace Definition;
+
+	// File resource of a common subgroup, path is kept in posix style
+
+	struct FileInformation {
+
+		std::string id;
+
+		std::string type;
+
+		std::string path;
+
+	};
+
+	// Sprite inside an atlas
+
+	struct SpriteInformation {
+
+		std::string id;
+
+		std::string type;
+
+		std::string path;
+
+		std::optional<int> x;
+
+		std::optional<int> y;
+
+		std::optional<int> rows;
+
+		std::optional<int> cols;
+
+		int ax;
+
+		int ay;
+
+		int aw;
+
+		int ah;
+
+	};
+
+	// Atlas of an image subgroup
+
+	struct AtlasInformation {
+
+		std::string id;
+
+		std::string type;
+
+		std::string path;
+
+		int width;
+
+		int height;
+
+		std::vector<SpriteInformation> data;
+
+	};
+
+	struct SubgroupInformation {
+
+		std::string id;
+
+		std::optional<std::string> type;
+
+		std::optional<std::string> loc;
+
+		std::vector<FileInformation> file;
+
+		std::vector<AtlasInformation> atlas;
+
+		inline auto is_image(
+
+		) const -> bool
+		{
+			return thiz.type.has_value() and thiz.type.value() != "0";
+		}
+
+	};
+
+	struct GroupInformation {
+
+		std::string id;
+
+		bool is_composite;
+
+		std::vector<SubgroupInformation> subgroup;
+
+	};
+
+	/**
+	 * Typed res info, parsed once so the conversion never look a key up twice
+	*/
+
+	struct ResInfoInformation {
+
+		bool use_string_for_style;
+
+		std::vector<GroupInformation> groups;
+
+	};
+
+	inline static auto parse_subgroup(
+		std::string const & id,
+		nlohmann::ordered_json const & value
+	) -> SubgroupInformation
+	{
+		auto result = SubgroupInformation{.id = id};
+		if (!value["type"].is_null()) {
+			result.type = value["type"].get<std::string>();
+		}
+		if (value.find("loc") != value.end()) {
+			result.loc = value["loc"].get<std::string>();
+		}
+		if (result.is_image()) {
+			result.atlas.reserve(value["packet"].size());
+			for (auto & [atlas_id, atlas_value] : value["packet"].items()) {
+				auto & atlas = result.atlas.emplace_back(AtlasInformation{
+					.id = atlas_id,
+					.type = atlas_value["type"].get<std::string>(),
+					.path = atlas_value["path"].get<std::string>(),
+					.width = atlas_value["dimension"]["width"].get<int>(),
+					.height = atlas_value["dimension"]["height"].get<int>(),
+				});
+				atlas.data.reserve(atlas_value["data"].size());
+				for (auto & [sprite_id, sprite_value] : atlas_value["data"].items()) {
+					auto & sprite = atlas.data.emplace_back(SpriteInformation{
+						.id = sprite_id,
+						.type = sprite_value["type"].get<std::string>(),
+						.path = sprite_value["path"].get<std::string>(),
+					});
+					auto required = JsonReader::required_key("ax"_sv, "ay"_sv, "aw"_sv, "ah"_sv);
+					for (auto & [key, position] : sprite_value["default"].items()) {
+						required.visit(key);
+						if (key == "x") {
+							sprite.x = position.get<int>();
+						}
+						else if (key == "y") {
+							sprite.y = position.get<int>();
+						}
+						else if (key == "rows") {
+							sprite.rows = position.get<int>();
+						}
+						else if (key == "cols") {
+							sprite.cols = position.get<int>();
+						}
+						else if (key == "ax") {
+							sprite.ax = position.get<int>();
+						}
+						else if (key == "ay") {
+							sprite.ay = position.get<int>();
+						}
+						else if (key == "aw") {
+							sprite.aw = position.get<int>();
+						}
+						else if (key == "ah") {
+							sprite.ah = position.get<int>();
+						}
+					}
+					required.check();
+				}
+			}
+		}
+		else {
+			auto const & data = value["packet"]["data"];
+			result.file.reserve(data.size());
+			for (auto & [file_id, file_value] : data.items()) {
+				result.file.emplace_back(FileInformation{
+					.id = file_id,
+					.type = file_value["type"].get<std::string>(),
+					.path = file_value["path"].get<std::string>(),
+				});
+			}
+		}
+		return result;
+	}
+
+	inline static auto parse_res_info(
+		nlohmann::ordered_json const & res_info
+	) -> ResInfoInformation
+	{
+		auto result = ResInfoInformation{
+			.use_string_for_style = res_info["expand_path"].get<std::string>() == "string",
+		};
+		result.groups.reserve(res_info["groups"].size());
+		for (auto & [group_id, group_value] : res_info["groups"].items()) {
+			auto & group = result.groups.emplace_back(GroupInformation{
+				.id = group_id,
+				.is_composite = group_value["is_composite"].get<bool>(),
+			});
+			group.subgroup.reserve(group_value["subgroup"].size());
+			for (auto & [subgroup_id, subgroup_value] : group_value["subgroup"].items()) {
+				group.subgroup.emplace_back(parse_subgroup(subgroup_id, subgroup_value));
+			}
+		}
+		return result;
+	}
+
+}
@@ -87,11 +87,14 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 					if((c.find("subgroups") != c.end()) || (c.find("resources") != c.end() && c.find("parent") == c.end())){
 						if(c.find("subgroups") != c.end())
 						{
-							content[c["id"].get<std::string>()]["is_composite"] = true;
+							auto & composite = content[c["id"].get<std::string>()];
+							composite["is_composite"] = true;
+							auto & subgroups = composite["subgroups"];
 							for(auto &e : c["subgroups"]){
-								content[c["id"].get<std::string>()]["subgroups"][e["id"].get<std::string>()] = ordered_json{{"type", e["res"]}};
+								auto & subgroup = subgroups[e["id"].get<std::string>()];
+								subgroup = ordered_json{{"type", e["res"]}};
 								if (e.find("loc") != e.end()) {
-									content[c["id"].get<std::string>()]["subgroups"][e["id"].get<std::string>()]["loc"] = e["loc"];
+									subgroup["loc"] = e["loc"];
 								}	
 							}
 						}
@@ -130,25 +133,25 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 				};
 				auto groups = nlohmann::ordered_json::array_t();
 				for(auto & [parent, parent_value] : content.items()){
-					if(content[parent]["is_composite"]){
+					if(parent_value["is_composite"]){
 						auto composite_object = nlohmann::ordered_json{
 							{"id", parent},
 							{"type", "composite"},
 							{"subgroups", nlohmann::ordered_json::array()}
 						};
-						for(auto & [subgroup, subgroup_value] : content[parent]["subgroups"].items()){
+						for(auto & [subgroup, subgroup_value] : parent_value["subgroups"].items()){
 							auto resource_for_subgroup = nlohmann::ordered_json{{"id", subgroup}};
-							if(!content[parent]["subgroups"][subgroup]["type"].is_null()){
-								resource_for_subgroup["res"] = content[parent]["subgroups"][subgroup]["type"];
+							if(!subgroup_value["type"].is_null()){
+								resource_for_subgroup["res"] = subgroup_value["type"];
 							}
-							if (content[parent]["subgroups"][subgroup].find("loc") != content[parent]["subgroups"][subgroup].end()) {
-								resource_for_subgroup["loc"] = content[parent]["subgroups"][subgroup]["loc"];
+							if (subgroup_value.find("loc") != subgroup_value.end()) {
+								resource_for_subgroup["loc"] = subgroup_value["loc"];
 							}
 							composite_object["subgroups"].emplace_back(resource_for_subgroup);
 						}
 						groups.emplace_back(composite_object);
 					}
-					for(auto & [subgroup, subgroup_value] : content[parent]["subgroups"].items()){
+					for(auto & [subgroup, subgroup_value] : parent_value["subgroups"].items()){
 						auto resource_json_path = Path::normalize(fmt::format("{}/subgroup/{}.json", source, subgroup));
 						auto resource_content = *FileSystem::read_json(resource_json_path);
 						assert_conditional(resource_content.find("resources") != resource_content.end(), String::format(fmt::format("{}", Language::get("popcap.resource_group.property_cannot_be_null")), std::string{"groups"}), "merge");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "kernel/definition/utility.hpp"
+#include "kernel/support/popcap/resource_group/definition.hpp"
 
 namespace Sen::Kernel::Support::PopCap::ResourceGroup { 
 
@@ -86,213 +87,254 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 
 			/**
 			 * This function will convert atlas
-			 * subgroup: the subgroup json object
-			 * return: the newly converted json
+			 * subgroup: the subgroup
+			 * value: json writer
 			*/
 
-			inline auto convert_atlas(
-				const nlohmann::ordered_json & subgroup
-			) -> nlohmann::ordered_json
+			inline static auto convert_atlas(
+				const GroupInformation & subgroup,
+				JsonWriter & value
+			) -> void
 			{
-				auto result = nlohmann::ordered_json {
-					{"type", subgroup["res"]}
-				};
-				auto atlas = std::vector<nlohmann::ordered_json>{};
-				for(auto & element : subgroup["resources"]){
-					if(element.find("atlas") != element.end() && element["atlas"].get<bool>()){
-						atlas.emplace_back(element);
-					}
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"type"});
+				write_optional(value, subgroup.res);
+				if (!subgroup.resources.has_value()) {
+					value.WriteEndObject();
+					return;
 				}
-				for(auto & parent : atlas) {
-					auto atlas_data = nlohmann::ordered_json{};
-					if constexpr (use_string_for_style) {
-						atlas_data =  nlohmann::ordered_json{
-							{"type", parent["type"].get<std::string>()},
-							{"path", String::replaceAll(parent["path"].get<std::string>(), Common::WindowStyle, Common::PosixStyle)},
-							{"dimension", nlohmann::ordered_json {
-								{"width", parent["width"].get<int>() },
-								{"height", parent["height"].get<int>() }
-							}}
-						};
+				// children are grouped by parent in one pass
+				auto atlas = std::vector<ResourceInformation const *>{};
+				auto children = std::unordered_map<std::string_view, std::vector<ResourceInformation const *>>{};
+				for (auto & element : subgroup.resources.value()) {
+					if (element.atlas) {
+						atlas.emplace_back(&element);
 					}
-					else {
-						atlas_data =  nlohmann::ordered_json{
-							{"type", parent["type"].get<std::string>()},
-							{"path", String::join(parent["path"].get<std::vector<std::string>>(), Common::PosixStyle)},
-							{"dimension", nlohmann::ordered_json {
-								{"width", parent["width"].get<int>() },
-								{"height", parent["height"].get<int>() }
-							}}
-						};
+					if (element.parent.has_value()) {
+						children[element.parent.value()].emplace_back(&element);
 					}
-					auto children_in_current_parent = std::vector<nlohmann::ordered_json>{};
-					for(auto & element : subgroup["resources"]) {
-						if(element.find("parent") != element.end() and element["parent"].get<std::string>() == parent["id"].get<std::string>()) {
-							children_in_current_parent.emplace_back(element);
-						}
-					}
-					for(auto & element : children_in_current_parent) {
-						auto children_data = nlohmann::ordered_json{};
-						if constexpr (use_string_for_style) {
-							children_data = nlohmann::ordered_json {
-								{"type", element["type"].get<std::string>()},
-								{"path", String::replaceAll(element["path"].get<std::string>(), Common::WindowStyle, Common::PosixStyle)},
-								{
-									"default", nlohmann::ordered_json {
-										{"ax", element["ax"].get<int>()},
-										{"ay", element["ay"].get<int>()},
-										{"aw", element["aw"].get<int>()},
-										{"ah", element["ah"].get<int>()}
-								}}
-							};
-						}
-						else {
-							children_data = nlohmann::ordered_json {
-								{"type", element["type"].get<std::string>()},
-								{"path", String::join(element["path"].get<std::vector<std::string>>(), Common::PosixStyle)},
-								{
-									"default", nlohmann::ordered_json {
-										{"ax", element["ax"].get<int>()},
-										{"ay", element["ay"].get<int>()},
-										{"aw", element["aw"].get<int>()},
-										{"ah", element["ah"].get<int>()}
-								}}
-							};
-						}
-						if(element.find("x") != element.end() and element["x"] != Common::DefaultCoordinateOffset){
-							children_data["default"]["x"] = element["x"].get<int>();
-						}
-						else{
-							children_data["default"]["x"] = Common::DefaultCoordinateOffset;
-						}
-						if(element.find("y") != element.end() and element["y"] != Common::DefaultCoordinateOffset){
-							children_data["default"]["y"] = element["y"].get<int>();
-						}
-						else{
-							children_data["default"]["y"] = Common::DefaultCoordinateOffset;
-						}
-						if(element.find("rows") != element.end() and element["rows"] != Common::DefaultLayoutOffset){
-							children_data["default"]["rows"] = element["rows"].get<int>();
-						}
-						if(element.find("cols") != element.end() and element["cols"] != Common::DefaultLayoutOffset){
-							children_data["default"]["cols"] = element["cols"].get<int>();
+				}
+				if (!atlas.empty()) {
+					value.WritePropertyName(std::string{"packet"});
+					value.WriteStartObject();
+					for (auto index : unique_key(atlas, [](auto & resource) -> std::string_view { return resource->id; })) {
+						auto & parent = atlas[index];
+						value.WritePropertyName(parent->id);
+						value.WriteStartObject();
+						value.WritePropertyName(std::string{"type"});
+						value.WriteValue(parent->type);
+						value.WritePropertyName(std::string{"path"});
+						value.WriteValue(parent->path);
+						value.WritePropertyName(std::string{"dimension"});
+						value.WriteStartObject();
+						value.WritePropertyName(std::string{"width"});
+						value.WriteValue(parent->width);
+						value.WritePropertyName(std::string{"height"});
+						value.WriteValue(parent->height);
+						value.WriteEndObject();
+						if (auto element = children.find(parent->id); element != children.end()) {
+							value.WritePropertyName(std::string{"data"});
+							value.WriteStartObject();
+							for (auto position : unique_key(element->second, [](auto & resource) -> std::string_view { return resource->id; })) {
+								auto & child = element->second[position];
+								auto const & rectangle = child->default_rectangle.value();
+								value.WritePropertyName(child->id);
+								value.WriteStartObject();
+								value.WritePropertyName(std::string{"type"});
+								value.WriteValue(child->type);
+								value.WritePropertyName(std::string{"path"});
+								value.WriteValue(child->path);
+								value.WritePropertyName(std::string{"default"});
+								value.WriteStartObject();
+								value.WritePropertyName(std::string{"ax"});
+								value.WriteValue(rectangle[0]);
+								value.WritePropertyName(std::string{"ay"});
+								value.WriteValue(rectangle[1]);
+								value.WritePropertyName(std::string{"aw"});
+								value.WriteValue(rectangle[2]);
+								value.WritePropertyName(std::string{"ah"});
+								value.WriteValue(rectangle[3]);
+								value.WritePropertyName(std::string{"x"});
+								value.WriteValue(child->x);
+								value.WritePropertyName(std::string{"y"});
+								value.WriteValue(child->y);
+								if (child->rows.has_value() and child->rows.value() != Common::DefaultLayoutOffset) {
+									value.WritePropertyName(std::string{"rows"});
+									value.WriteValue(child->rows.value());
+								}
+								if (child->cols.has_value() and child->cols.value() != Common::DefaultLayoutOffset) {
+									value.WritePropertyName(std::string{"cols"});
+									value.WriteValue(child->cols.value());
+								}
+								value.WriteEndObject();
+								value.WriteEndObject();
+							}
+							value.WriteEndObject();
 						}
-						atlas_data["data"][element["id"].get<std::string>()] = children_data;
+						value.WriteEndObject();
 					}
-					result["packet"][parent["id"].get<std::string>()] = atlas_data;
+					value.WriteEndObject();
 				}
-				return result;
+				value.WriteEndObject();
+				return;
 			}
 
 			/**
 			 * This function will convert common data to json map
 			 * subgroup: subgroup data
-			 * return: map
+			 * value: json writer
 			*/
 
-			inline auto convert_common(
-				const nlohmann::ordered_json & subgroup
-			) -> nlohmann::ordered_json
+			inline static auto convert_common(
+				const GroupInformation & subgroup,
+				JsonWriter & value
+			) -> void
 			{
-				auto result = nlohmann::ordered_json {
-					{"type", nullptr}
-				};
-				if (subgroup.find("loc") != subgroup.end()) {
-					result["loc"] = subgroup["loc"];
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"type"});
+				value.WriteNull();
+				if (subgroup.loc.has_value()) {
+					value.WritePropertyName(std::string{"loc"});
+					value.WriteValue(subgroup.loc.value());
 				}
-				result["packet"] = nlohmann::ordered_json{{"type", "File"}};
-				auto data = nlohmann::ordered_json{};
-				for(auto & element : subgroup["resources"]) {
-					auto sub_data = nlohmann::ordered_json{};
-					if constexpr (use_string_for_style)
-					{
-						sub_data = nlohmann::ordered_json {
-							{"type", element["type"].get<std::string>()},
-							{"path", String::replaceAll(element["path"].get<std::string>(), Common::WindowStyle, Common::PosixStyle) }
-						};
-					}
-					else {
-						sub_data = nlohmann::ordered_json {
-							{"type", element["type"].get<std::string>()},
-							{"path", String::join(element["path"].get<std::vector<std::string>>(), Common::PosixStyle) }
-						};
+				value.WritePropertyName(std::string{"packet"});
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"type"});
+				value.WriteValue(std::string{"File"});
+				value.WritePropertyName(std::string{"data"});
+				if (!subgroup.resources.has_value() || subgroup.resources.value().empty()) {
+					value.WriteNull();
+				}
+				else {
+					auto const & resources = subgroup.resources.value();
+					value.WriteStartObject();
+					for (auto index : unique_key(resources, [](auto & resource) -> std::string_view { return resource.id; })) {
+						auto & element = resources[index];
+						value.WritePropertyName(element.id);
+						value.WriteStartObject();
+						value.WritePropertyName(std::string{"type"});
+						value.WriteValue(element.type);
+						value.WritePropertyName(std::string{"path"});
+						value.WriteValue(element.path);
+						value.WriteEndObject();
 					}
-					data[element["id"].get<std::string>()] = sub_data;
+					value.WriteEndObject();
 				}
-				result["packet"]["data"] = data;
-				return result;
+				value.WriteEndObject();
+				value.WriteEndObject();
+				return;
+			}
+
+			inline static auto write_optional(
+				JsonWriter & value,
+				const std::optional<std::string> & data
+			) -> void
+			{
+				if (data.has_value()) {
+					value.WriteValue(data.value());
+				}
+				else {
+					value.WriteNull();
+				}
+				return;
 			}
 
 			/**
-			 * This function will find the first subgroup in the resource group
-			 * resource_group: resource group
-			 * id: the parent id
-			 * return: the subgroup
+			 * Position of the element to write for each key of a json object
+			 * A repeated key keep its first position and take its last value, as assigning into the object did
+			 * list: elements in order
+			 * key: key of an element
 			*/
 
-			inline static auto first_where(
-				const nlohmann::ordered_json & resource_group,
-				const std::string & id
-			) -> nlohmann::ordered_json
+			template <typename Element, typename Key>
+			inline static auto unique_key(
+				const std::vector<Element> & list,
+				const Key & key
+			) -> std::vector<std::size_t>
 			{
-				for(auto & element : resource_group["groups"]){
-					if(element["id"] == id) {
-						return element;
+				auto position = std::unordered_map<std::string_view, std::size_t>{};
+				auto result = std::vector<std::size_t>{};
+				result.reserve(list.size());
+				for (auto index : Range(list.size())) {
+					auto [element, inserted] = position.try_emplace(key(list[index]), result.size());
+					if (inserted) {
+						result.emplace_back(index);
+					}
+					else {
+						result[element->second] = index;
 					}
 				}
-				throw Exception(String::format(fmt::format("{}", Language::get("popcap.resource_group.convert.cannot_find_id")), id), std::source_location::current(), "first_where");
+				return result;
 			}
 
-		
 		public:
 
 			/**
 			 * This function will convert whole resource group to res info
-			 * source: resource group after deserialized
-			 * return: res info
+			 * resource_group: typed resource group
+			 * value: json writer that receive res info
 			*/
 
-			inline auto convert_whole(
-				const nlohmann::ordered_json & resource_group
-			) -> nlohmann::ordered_json
+			inline static auto convert_whole(
+				const ResourceGroupInformation & resource_group,
+				JsonWriter & value
+			) -> void
 			{
-				assert_conditional(resource_group.find("groups") != resource_group.end(), fmt::format("\"{}\" cannot be null in resource group", "groups"), "convert_whole");
-				auto result = nlohmann::ordered_json{};
+				value.WriteStartObject();
+				value.WritePropertyName(std::string{"expand_path"});
 				if constexpr (use_string_for_style) {
-					result = nlohmann::ordered_json{
-						{"expand_path", Common::String
-					}};
+					value.WriteValue(Common::String);
 				}
 				else {
-					result = nlohmann::ordered_json{
-						{"expand_path", Common::Array
-					}};
+					value.WriteValue(Common::Array);
+				}
+				// a group both composite and common was written twice, the common one last
+				auto groups = std::vector<GroupInformation const *>{};
+				for (auto & element : resource_group.groups) {
+					if (element.subgroups.has_value() || (!element.parent.has_value() && element.resources.has_value())) {
+						groups.emplace_back(&element);
+					}
+				}
+				if (!groups.empty()) {
+					value.WritePropertyName(std::string{"groups"});
+					value.WriteStartObject();
 				}
-				for(auto & element : resource_group["groups"]) {
-					if(element.find("subgroups") != element.end()){
-						auto subgroup = nlohmann::ordered_json {
-							{"is_composite", true}
-						};
-						for(auto & k : element["subgroups"]) {
-							if (k.find("res") != k.end() and k["res"].get<std::string>() != "0") {
-								subgroup["subgroup"][k["id"].get<std::string>()] = thiz.convert_atlas(thiz.first_where(resource_group, k["id"]));
+				for (auto index : unique_key(groups, [](auto & group) -> std::string_view { return group->id; })) {
+					auto & element = *groups[index];
+					auto is_composite = element.subgroups.has_value() && !(!element.parent.has_value() && element.resources.has_value());
+					value.WritePropertyName(element.id);
+					value.WriteStartObject();
+					value.WritePropertyName(std::string{"is_composite"});
+					value.WriteBoolean(is_composite);
+					value.WritePropertyName(std::string{"subgroup"});
+					if (is_composite) {
+						auto const & subgroups = element.subgroups.value();
+						value.WriteStartObject();
+						for (auto subgroup : unique_key(subgroups, [](auto & reference) -> std::string_view { return reference.id; })) {
+							auto & k = subgroups[subgroup];
+							value.WritePropertyName(k.id);
+							if (k.res.has_value() and k.res.value() != Common::emptyType) {
+								convert_atlas(resource_group.find(k.id), value);
 							}
 							else {
-								subgroup["subgroup"][k["id"].get<std::string>()] = thiz.convert_common(thiz.first_where(resource_group, k["id"]));
+								convert_common(resource_group.find(k.id), value);
 							}
 						}
-						result["groups"][element["id"].get<std::string>()] = subgroup;
+						value.WriteEndObject();
 					}
-					if(element.find("parent") == element.end() && element.find("resources") != element.end()) {
-						auto subgroup = nlohmann::ordered_json {
-							{"is_composite", false}
-						};
-						subgroup["subgroup"][element["id"].get<std::string>()] = thiz.convert_common(element);
-						result["groups"][element["id"].get<std::string>()] = subgroup;
+					else {
+						value.WriteStartObject();
+						value.WritePropertyName(element.id);
+						convert_common(element, value);
+						value.WriteEndObject();
 					}
-					
+					value.WriteEndObject();
 				}
-				return result;
+				if (!groups.empty()) {
+					value.WriteEndObject();
+				}
+				value.WriteEndObject();
+				return;
 			}
 
 			// convert method
@@ -310,8 +352,12 @@ namespace Sen::Kernel::Support::PopCap::ResourceGroup {
 				std::string_view destination
 			) -> void 
 			{
-				auto view = std::make_unique<ResourceGroup::Convert<use_string_for_style>>();
-				FileSystem::write_json(destination, view->convert_whole(*FileSystem::read_json(source)));
+				auto resource_group = FileSystem::read_json(source);
+				assert_conditional(resource_group->find("groups") != resource_group->end(), fmt::format("\"{}\" cannot be null in resource group", "groups"), "convert_fs");
+				auto writer = JsonWriter{};
+				writer.WriteIndent = true;
+				convert_whole(parse_resource_group<use_string_for_style>(*resource_group), writer);
+				FileSystem::write_file(destination, writer.ToString());
 				return;
 			}
 
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ResourceGroup {
+
+	// use definition
+
+	using namespace Definition;
+
+	// Resource entry inside a subgroup, path is kept in posix style
+
+	struct ResourceInformation {
+
+		std::string id;
+
+		std::string type;
+
+		std::string path;
+
+		std::optional<std::string> parent;
+
+		bool atlas;
+
+		int width;
+
+		int height;
+
+		int x;
+
+		int y;
+
+		std::optional<int> rows;
+
+		std::optional<int> cols;
+
+		std::optional<std::array<int, 4>> default_rectangle;
+
+	};
+
+	// Subgroup reference of a composite group
+
+	struct SubgroupReference {
+
+		std::string id;
+
+		std::optional<std::string> res;
+
+		std::optional<std::string> loc;
+
+	};
+
+	// Group entry of resources.json
+
+	struct GroupInformation {
+
+		std::string id;
+
+		std::optional<std::string> res;
+
+		std::optional<std::string> loc;
+
+		std::optional<std::string> parent;
+
+		std::optional<std::vector<SubgroupReference>> subgroups;
+
+		std::optional<std::vector<ResourceInformation>> resources;
+
+	};
+
+	/**
+	 * Typed resources.json, groups can be found by id in constant time
+	*/
+
+	struct ResourceGroupInformation {
+
+		std::vector<GroupInformation> groups;
+
+		std::unordered_map<std::string_view, std::size_t> index;
+
+		inline auto find(
+			std::string_view id
+		) const -> GroupInformation const &
+		{
+			auto element = thiz.index.find(id);
+			if (element == thiz.index.end()) {
+				throw Exception(String::format(fmt::format("{}", Language::get("popcap.resource_group.convert.cannot_find_id")), std::string{id}), std::source_location::current(), "find");
+			}
+			return thiz.groups[element->second];
+		}
+
+	};
+
+	// Parse resources.json once into the typed structure
+
+	template <auto use_string_for_style>
+	inline static auto parse_resource(
+		nlohmann::ordered_json const & element
+	) -> ResourceInformation
+	{
+		static_assert(use_string_for_style == true or use_string_for_style == false);
+		auto result = ResourceInformation{
+			.id = element["id"].get<std::string>(),
+			.type = element["type"].get<std::string>(),
+			.atlas = false,
+			.width = 0,
+			.height = 0,
+			.x = 0,
+			.y = 0,
+		};
+		if constexpr (use_string_for_style) {
+			result.path = String::replaceAll(element["path"].get<std::string>(), std::string{"\\"}, std::string{"/"});
+		}
+		else {
+			result.path = String::join(element["path"].get<std::vector<std::string>>(), std::string{"/"});
+		}
+		for (auto & item : element.items()) {
+			auto const & key = item.key();
+			auto const & value = item.value();
+			if (key == "parent") {
+				result.parent = value.get<std::string>();
+			}
+			else if (key == "atlas") {
+				result.atlas = value.get<bool>();
+			}
+			else if (key == "width") {
+				result.width = value.get<int>();
+			}
+			else if (key == "height") {
+				result.height = value.get<int>();
+			}
+			else if (key == "x") {
+				result.x = value.get<int>();
+			}
+			else if (key == "y") {
+				result.y = value.get<int>();
+			}
+			else if (key == "rows") {
+				result.rows = value.get<int>();
+			}
+			else if (key == "cols") {
+				result.cols = value.get<int>();
+			}
+		}
+		if (element.find("ax") != element.end()) {
+			result.default_rectangle = std::array<int, 4>{element["ax"].get<int>(), element["ay"].get<int>(), element["aw"].get<int>(), element["ah"].get<int>()};
+		}
+		return result;
+	}
+
+	template <auto use_string_for_style>
+	inline static auto parse_resource_group(
+		nlohmann::ordered_json const & resource_group
+	) -> ResourceGroupInformation
+	{
+		auto result = ResourceGroupInformation{};
+		auto const & groups = resource_group["groups"];
+		result.groups.reserve(groups.size());
+		for (auto & element : groups) {
+			auto & group = result.groups.emplace_back(GroupInformation{.id = element["id"].get<std::string>()});
+			for (auto & item : element.items()) {
+				auto const & key = item.key();
+				auto const & value = item.value();
+				if (key == "res") {
+					group.res = value.get<std::string>();
+				}
+				else if (key == "loc") {
+					group.loc = value.get<std::string>();
+				}
+				else if (key == "parent") {
+					group.parent = value.get<std::string>();
+				}
+				else if (key == "subgroups") {
+					auto & subgroups = group.subgroups.emplace();
+					subgroups.reserve(value.size());
+					for (auto & reference : value) {
+						auto & subgroup = subgroups.emplace_back(SubgroupReference{.id = reference["id"].get<std::string>()});
+						if (reference.find("res") != reference.end()) {
+							subgroup.res = reference["res"].get<std::string>();
+						}
+						if (reference.find("loc") != reference.end()) {
+							subgroup.loc = reference["loc"].get<std::string>();
+						}
+					}
+				}
+				else if (key == "resources") {
+					auto & resources = group.resources.emplace();
+					resources.reserve(value.size());
+					for (auto & resource : value) {
+						resources.emplace_back(parse_resource<use_string_for_style>(resource));
+					}
+				}
+			}
+		}
+		result.index.reserve(result.groups.size());
+		for (auto i : Range<std::size_t>(result.groups.size())) {
+			result.index.try_emplace(result.groups[i].id, i);
+		}
+		return result;
+	}
+
+}
@@ -304,30 +304,38 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
             uint32_t texture_resource_begin;
         };
 
+        // numeric part of the basic subgroup block, read and written as one record
+
+        using BasicSubgroupRecord = Record<
+            &BasicSubgroupInformation::offset,
+            &BasicSubgroupInformation::size,
+            &BasicSubgroupInformation::pool,
+            &BasicSubgroupInformation::resource_data_section_compression,
+            &BasicSubgroupInformation::information_section_size,
+            &BasicSubgroupInformation::general_resource_data_section_offset,
+            &BasicSubgroupInformation::general_resource_data_section_size,
+            &BasicSubgroupInformation::general_resource_data_section_size_original,
+            &BasicSubgroupInformation::general_resource_data_section_size_pool,
+            &BasicSubgroupInformation::texture_resource_data_section_offset,
+            &BasicSubgroupInformation::texture_resource_data_section_size,
+            &BasicSubgroupInformation::texture_resource_data_section_size_original,
+            &BasicSubgroupInformation::texture_resource_data_section_size_pool,
+            Padding<16_size>{}>;
+
+        using BasicSubgroupTextureRecord = Record<
+            &BasicSubgroupInformation::texture_resource_count,
+            &BasicSubgroupInformation::texture_resource_begin>;
+
         template <auto t_version>
         inline static auto exchange_to_basic_subgroup(
             DataStreamView &stream,
             BasicSubgroupInformation &value) -> void
         {
             value.id = exchange_string_block<k_subgroup_name_string_block_size>(stream);
-            value.offset = stream.readUint32();
-            value.size = stream.readUint32();
-            value.pool = stream.readUint32();
-            value.resource_data_section_compression = stream.readUint32();
-            value.information_section_size = stream.readUint32();
-            value.general_resource_data_section_offset = stream.readUint32();
-            value.general_resource_data_section_size = stream.readUint32();
-            value.general_resource_data_section_size_original = stream.readUint32();
-            value.general_resource_data_section_size_pool = stream.readUint32();
-            value.texture_resource_data_section_offset = stream.readUint32();
-            value.texture_resource_data_section_size = stream.readUint32();
-            value.texture_resource_data_section_size_original = stream.readUint32();
-            value.texture_resource_data_section_size_pool = stream.readUint32();
-            stream.read_pos += 16_size;
+            BasicSubgroupRecord::read(stream, value);
             if constexpr (t_version >= 3_size)
             {
-                value.texture_resource_count = stream.readUint32();
-                value.texture_resource_begin = stream.readUint32();
+                BasicSubgroupTextureRecord::read(stream, value);
             }
             return;
         }
@@ -339,24 +347,10 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         {
             static_assert(sizeof(t_version) == sizeof(uint32_t));
             exchange_string_block<k_subgroup_name_string_block_size>(stream, value.id);
-            stream.writeUint32(value.offset);
-            stream.writeUint32(value.size);
-            stream.writeUint32(value.pool);
-            stream.writeUint32(value.resource_data_section_compression);
-            stream.writeUint32(value.information_section_size);
-            stream.writeUint32(value.general_resource_data_section_offset);
-            stream.writeUint32(value.general_resource_data_section_size);
-            stream.writeUint32(value.general_resource_data_section_size_original);
-            stream.writeUint32(value.general_resource_data_section_size_pool);
-            stream.writeUint32(value.texture_resource_data_section_offset);
-            stream.writeUint32(value.texture_resource_data_section_size);
-            stream.writeUint32(value.texture_resource_data_section_size_original);
-            stream.writeUint32(value.texture_resource_data_section_size_pool);
-            stream.writeNull(16);
+            BasicSubgroupRecord::write(stream, value);
             if constexpr (t_version >= 3_size)
             {
-                stream.writeUint32(value.texture_resource_count);
-                stream.writeUint32(value.texture_resource_begin);
+                BasicSubgroupTextureRecord::write(stream, value);
             }
             return;
         }
@@ -52,6 +52,34 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        SimpleCategoryInformation &result) -> void
+    {
+        auto required = JsonReader::required_key("resolution"_sv, "locale"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            auto field_value = field.value().value();
+            if (JsonReader::is_null(field_value))
+            {
+                continue;
+            }
+            if (key == "resolution")
+            {
+                JsonReader::read(field_value, result.resolution);
+                result.is_image = true;
+            }
+            else if (key == "locale")
+            {
+                JsonReader::read(field_value, result.locale);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct SubgroupInformation
     {
         SimpleCategoryInformation category;
@@ -87,6 +115,36 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        SubgroupInformation &result) -> void
+    {
+        auto required = JsonReader::required_key("category"_sv, "compression"_sv, "resource"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "category")
+            {
+                auto field_value = field.value().value();
+                if (!JsonReader::is_null(field_value))
+                {
+                    JsonReader::read(field_value, result.category);
+                }
+            }
+            else if (key == "compression")
+            {
+                JsonReader::read(field.value(), result.compression);
+            }
+            else if (key == "resource")
+            {
+                JsonReader::read(field.value(), result.resource);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct GroupInformation
     {
         bool composite;
@@ -111,6 +169,28 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        GroupInformation &result) -> void
+    {
+        auto required = JsonReader::required_key("composite"_sv, "subgroup"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "composite")
+            {
+                JsonReader::read(field.value(), result.composite);
+            }
+            else if (key == "subgroup")
+            {
+                JsonReader::read(field.value(), result.subgroup);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct BundleStructure
     {
         uint32_t version;
@@ -139,6 +219,34 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        BundleStructure &result) -> void
+    {
+        auto required = JsonReader::required_key("version"_sv, "texture_information_version"_sv, "group"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "version")
+            {
+                JsonReader::read(field.value(), result.version);
+            }
+            else if (key == "texture_information_version")
+            {
+                auto texture_information_version = Common::TextureInformationVersion{};
+                JsonReader::read(field.value(), texture_information_version);
+                result.texture_information_section_size = Common::exchange_texture_information_version(texture_information_version);
+            }
+            else if (key == "group")
+            {
+                JsonReader::read(field.value(), result.group);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct ManifestResource {
         std::string path;
         uint16_t type;
@@ -165,6 +273,32 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        ManifestResource &result) -> void
+    {
+        auto required = JsonReader::required_key("path"_sv, "type"_sv, "property"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "path")
+            {
+                JsonReader::read(field.value(), result.path);
+            }
+            else if (key == "type")
+            {
+                JsonReader::read(field.value(), result.type);
+            }
+            else if (key == "property")
+            {
+                JsonReader::read(field.value(), result.property);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct ManifestSubgroupInformation {
         SimpleCategoryInformation category;
         std::map<std::string, ManifestResource> resource;
@@ -188,6 +322,28 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        ManifestSubgroupInformation &result) -> void
+    {
+        auto required = JsonReader::required_key("category"_sv, "resource"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "category")
+            {
+                JsonReader::read(field.value(), result.category);
+            }
+            else if (key == "resource")
+            {
+                JsonReader::read(field.value(), result.resource);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct ManifestGroupInformation {
         bool composite;
         std::map<std::string, ManifestSubgroupInformation> subgroup;
@@ -211,6 +367,28 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        ManifestGroupInformation &result) -> void
+    {
+        auto required = JsonReader::required_key("composite"_sv, "subgroup"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "composite")
+            {
+                JsonReader::read(field.value(), result.composite);
+            }
+            else if (key == "subgroup")
+            {
+                JsonReader::read(field.value(), result.subgroup);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct ManifestStructure {
         bool manifest_has;
         std::map<std::string, ManifestGroupInformation> group;
@@ -231,4 +409,23 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
         nlohmann_json_j.at("group").get_to(nlohmann_json_t.group);
         return;
     }
+
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        ManifestStructure &result) -> void
+    {
+        auto required = JsonReader::required_key("group"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "group")
+            {
+                JsonReader::read(field.value(), result.group);
+            }
+        }
+        required.check();
+        return;
+    }
 }
+
@@ -18,7 +18,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
         {
             auto packet_stream = DataStreamView{};
             ResourceStreamGroup::Pack::process_whole(packet_stream, packet_structure, source);
-            return packet_stream.toBytes();
+            return packet_stream.release();
         }
 
         inline static auto process(
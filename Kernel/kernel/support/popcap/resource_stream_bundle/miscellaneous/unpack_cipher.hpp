@@ -25,24 +25,10 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle::Miscellaneous
 			Common::BasicSubgroupInformation &value) -> void
 		{
 			stream.read_pos += Common::k_subgroup_name_string_block_size;
-			value.offset = stream.readUint32();
-			value.size = stream.readUint32();
-			value.pool = stream.readUint32();
-			value.resource_data_section_compression = stream.readUint32();
-			value.information_section_size = stream.readUint32();
-			value.general_resource_data_section_offset = stream.readUint32();
-			value.general_resource_data_section_size = stream.readUint32();
-			value.general_resource_data_section_size_original = stream.readUint32();
-			value.general_resource_data_section_size_pool = stream.readUint32();
-			value.texture_resource_data_section_offset = stream.readUint32();
-			value.texture_resource_data_section_size = stream.readUint32();
-			value.texture_resource_data_section_size_original = stream.readUint32();
-			value.texture_resource_data_section_size_pool = stream.readUint32();
-			stream.read_pos += 16_size;
+			Common::BasicSubgroupRecord::read(stream, value);
 			if constexpr (t_version >= 3_size)
 			{
-				value.texture_resource_count = stream.readUint32();
-				value.texture_resource_begin = stream.readUint32();
+				Common::BasicSubgroupTextureRecord::read(stream, value);
 			}
 			return;
 		}
@@ -123,11 +123,11 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
                 exchange_from_group_manifest(group_manifest_information_structure_stream, group_manifest_information_structure);
             }
             header_structure.group_manifest_information_section_offset = stream.write_pos;
-            stream.writeBytes(group_manifest_information_structure_stream.toBytes());
+            stream.writeBytes(group_manifest_information_structure_stream.get());
             header_structure.resource_manifest_information_section_offset = stream.write_pos;
-            stream.writeBytes(resource_manifest_information_data_stream.toBytes());
+            stream.writeBytes(resource_manifest_information_data_stream.get());
             header_structure.string_manifest_information_section_offset = stream.write_pos;
-            stream.writeBytes(string_manifest_information_data_stream.toBytes());
+            stream.writeBytes(string_manifest_information_data_stream.get());
             return;
         }
 
@@ -149,6 +149,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
             auto global_general_resource_index = k_begin_index;
             auto global_texture_resource_index = k_begin_index;
             auto packet_data_section_view_stored = DataStreamView{};
+            packet_data_section_view_stored.spill_next_to(stream);
             for (auto &[group_id, group_information] : definition.group)
             {
                 auto standard_group_id = make_standard_group_id(group_id, group_information.composite);
@@ -365,7 +366,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
             information_structure.header.version = definition.version;
             exchange_from_header(stream, information_structure.header);
             stream.write_pos = information_structure.header.information_section_size;
-            stream.writeBytes(packet_data_section_view_stored.toBytes());
+            stream.append(std::move(packet_data_section_view_stored));
             return;
         }
 
@@ -387,14 +388,15 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
             std::string_view destination) -> void
         {
             auto stream = DataStreamView{};
-            BundleStructure definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
+            auto definition = JsonReader::read_fs<BundleStructure>(fmt::format("{}/data.json", source));
             auto manifest = ManifestStructure{};
             if (definition.version <= 3_ui) {
-                manifest = *FileSystem::read_json(fmt::format("{}/resource.json", source));
+                JsonReader::read_fs(fmt::format("{}/resource.json", source), manifest);
             }
             auto source_path = get_string(source);
+            stream.spill(destination);
             process_whole(stream, definition, manifest, source_path);
-            stream.out_file(destination);
+            stream.commit();
             return;
         }
     };
@@ -0,0 +1,390 @@
+#pragma once
+
+#include "kernel/definition/utility.hpp"
+#include "kernel/support/popcap/resource_stream_group/unpack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/definition.hpp"
+
+namespace Sen::Kernel::Support::PopCap::ResourceStreamBundle
+{
+    using namespace Definition;
+
+    /**
+     * Random access over a RSB
+     * Only the information section is held in memory, packets are read from the file on demand
+     * Inflated packets are kept in a LRU cache so repeated lookups in one packet inflate it once
+     */
+
+    class Reader : public Common
+    {
+    public:
+        inline static constexpr auto k_cache_capacity = 8_size;
+
+        inline static constexpr auto k_opened_capacity = 4_size;
+
+    protected:
+        using PacketHeader = ResourceStreamGroup::Common::HeaderInformaiton;
+
+        using PacketResource = ResourceStreamGroup::Common::ResourceInformation;
+
+        struct Packet
+        {
+            std::unordered_map<std::string, PacketResource> resource;
+            std::vector<uint8_t> general;
+            std::vector<uint8_t> texture;
+        };
+
+        std::string source;
+
+        std::filesystem::file_time_type modify_time;
+
+        HeaderInformaiton header;
+
+        std::vector<BasicSubgroupInformation> subgroup_information;
+
+        // normalized path -> subgroup index
+
+        std::unordered_map<std::string, uint32_t> resource_index;
+
+        // every path as it is stored in the bundle
+
+        std::vector<std::string> resource_path;
+
+        // most recently used packet first
+
+        std::list<std::pair<uint32_t, Packet>> cache;
+
+        std::unordered_map<uint32_t, std::list<std::pair<uint32_t, Packet>>::iterator> cache_index;
+
+        std::size_t cache_capacity;
+
+        std::mutex mutex;
+
+        // RSB store paths upper case with windows separator
+
+        inline static auto make_key(
+            std::string_view path) -> std::string
+        {
+            auto key = std::string{path.data(), path.size()};
+            std::transform(key.begin(), key.end(), key.begin(), [](auto c) -> char
+                           { return c == '/' ? '\\' : static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
+            return key;
+        }
+
+        inline static auto open_file(
+            std::string_view source) -> std::ifstream
+        {
+            #if WINDOWS
+            auto file = std::ifstream(String::utf8_to_utf16(fmt::format("\\\\?\\{}", String::to_windows_style(source.data()))).data(), std::ios::binary);
+            #else
+            auto file = std::ifstream(source.data(), std::ios::binary);
+            #endif
+            assert_conditional(file.is_open(), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(source.data())), "open_file");
+            return file;
+        }
+
+        inline auto read_bytes(
+            std::ifstream &file,
+            size_t const &offset,
+            size_t const &size) const -> std::vector<uint8_t>
+        {
+            auto data = std::vector<uint8_t>(size);
+            file.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+            assert_conditional(file.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(size)), fmt::format("{}: {}", Language::get("cannot_read_file"), String::to_posix_style(thiz.source)), "read_bytes");
+            return data;
+        }
+
+        // the header and resource information of a packet, without its data sections
+
+        inline auto read_packet_information(
+            std::ifstream &file,
+            BasicSubgroupInformation const &subgroup,
+            PacketHeader &packet_header,
+            std::map<std::string, PacketResource> &packet_resource) const -> void
+        {
+            auto header_stream = DataStreamView{thiz.read_bytes(file, subgroup.offset, ResourceStreamGroup::Common::information_header_section_size)};
+            ResourceStreamGroup::Common::exchange_header(header_stream, packet_header);
+            assert_conditional(packet_header.magic == ResourceStreamGroup::Common::k_magic_identifier, fmt::format("{}", Language::get("popcap.rsg.unpack.invalid_rsg_magic")), "read_packet_information");
+            auto information_stream = DataStreamView{thiz.read_bytes(file, subgroup.offset, packet_header.information_section_size)};
+            CompiledMapData::decode(information_stream, packet_header.resource_information_section_offset, packet_header.resource_information_section_size, packet_resource, &ResourceStreamGroup::Common::exchange_to_resource_infomation);
+            return;
+        }
+
+        inline auto read_packet_section(
+            std::ifstream &file,
+            BasicSubgroupInformation const &subgroup,
+            size_t const &offset,
+            size_t const &size,
+            size_t const &size_original,
+            bool const &compressed) const -> std::vector<uint8_t>
+        {
+            if (size == k_none_size)
+            {
+                return std::vector<uint8_t>{};
+            }
+            auto data = thiz.read_bytes(file, static_cast<size_t>(subgroup.offset) + offset, size);
+            if (!compressed)
+            {
+                return data;
+            }
+            if (size_original == k_none_size)
+            {
+                return std::vector<uint8_t>{};
+            }
+            return Definition::Compression::Zlib::uncompress(data);
+        }
+
+        inline auto read_packet(
+            uint32_t const &subgroup_index) const -> Packet
+        {
+            auto file = open_file(thiz.source);
+            auto &subgroup = thiz.subgroup_information[subgroup_index];
+            auto packet_header = PacketHeader{};
+            auto packet_resource = std::map<std::string, PacketResource>{};
+            thiz.read_packet_information(file, subgroup, packet_header, packet_resource);
+            auto compression = ResourceStreamGroup::Common::PacketCompression{};
+            ResourceStreamGroup::Common::packet_compression_from_data(packet_header.resource_data_section_compression, compression);
+            auto packet = Packet{};
+            packet.resource.reserve(packet_resource.size());
+            for (auto &[path, resource] : packet_resource)
+            {
+                packet.resource.emplace(make_key(path), resource);
+            }
+            packet.general = thiz.read_packet_section(file, subgroup, packet_header.general_resource_data_section_offset, packet_header.general_resource_data_section_size, packet_header.general_resource_data_section_size_original, compression.general);
+            packet.texture = thiz.read_packet_section(file, subgroup, packet_header.texture_resource_data_section_offset, packet_header.texture_resource_data_section_size, packet_header.texture_resource_data_section_size_original, compression.texture);
+            return packet;
+        }
+
+        inline auto get_packet(
+            uint32_t const &subgroup_index) -> Packet const &
+        {
+            if (auto it = thiz.cache_index.find(subgroup_index); it != thiz.cache_index.end())
+            {
+                thiz.cache.splice(thiz.cache.begin(), thiz.cache, it->second);
+                return it->second->second;
+            }
+            auto packet = thiz.read_packet(subgroup_index);
+            if (thiz.cache.size() >= thiz.cache_capacity)
+            {
+                thiz.cache_index.erase(thiz.cache.back().first);
+                thiz.cache.pop_back();
+            }
+            thiz.cache.emplace_front(subgroup_index, std::move(packet));
+            thiz.cache_index[subgroup_index] = thiz.cache.begin();
+            return thiz.cache.front().second;
+        }
+
+        inline auto load_information(
+        ) -> void
+        {
+            auto file = open_file(thiz.source);
+            auto header_stream = DataStreamView{thiz.read_bytes(file, k_begin_index, information_header_section_size)};
+            exchange_to_header(header_stream, thiz.header);
+            assert_conditional(thiz.header.magic == k_magic_identifier, String::format(fmt::format("{}", Language::get("popcap.rsb.unpack.invalid_rsb_magic")), std::to_string(thiz.header.magic)), "load_information");
+            auto index = std::find(k_version_list.begin(), k_version_list.end(), static_cast<int>(thiz.header.version));
+            assert_conditional((index != k_version_list.end()), String::format(fmt::format("{}", Language::get("popcap.rsb.invalid_rsb_version")), std::to_string(static_cast<int>(thiz.header.version))), "load_information");
+            auto stream = DataStreamView{thiz.read_bytes(file, k_begin_index, thiz.header.information_section_size)};
+            stream.read_pos = thiz.header.subgroup_information_section_offset;
+            if (thiz.header.version == 1_ui)
+            {
+                exchange_list(stream, thiz.subgroup_information, &exchange_to_basic_subgroup<1_ui>, static_cast<size_t>(thiz.header.subgroup_information_section_block_count));
+            }
+            else
+            {
+                exchange_list(stream, thiz.subgroup_information, &exchange_to_basic_subgroup<3_ui>, static_cast<size_t>(thiz.header.subgroup_information_section_block_count));
+            }
+            auto resource_location = std::map<std::string, uint32_t>{};
+            if (thiz.header.resource_path_section_size != k_none_size)
+            {
+                // the compiled map point to a pool, the subgroup that own the pool hold the resource
+                auto pool_location = std::map<std::string, uint32_t>{};
+                CompiledMapData::decode(stream, thiz.header.resource_path_section_offset, thiz.header.resource_path_section_size, pool_location, &exchange_to_index);
+                auto pool_subgroup = std::unordered_map<uint32_t, uint32_t>{};
+                for (auto subgroup_index : Range(thiz.subgroup_information.size()))
+                {
+                    pool_subgroup.emplace(thiz.subgroup_information[subgroup_index].pool, static_cast<uint32_t>(subgroup_index));
+                }
+                for (auto &[path, pool] : pool_location)
+                {
+                    if (auto it = pool_subgroup.find(pool); it != pool_subgroup.end())
+                    {
+                        resource_location.emplace(path, it->second);
+                    }
+                }
+            }
+            else
+            {
+                // stripped bundle, the index is rebuilt from the information section of every packet
+                for (auto subgroup_index : Range(thiz.subgroup_information.size()))
+                {
+                    auto packet_header = PacketHeader{};
+                    auto packet_resource = std::map<std::string, PacketResource>{};
+                    thiz.read_packet_information(file, thiz.subgroup_information[subgroup_index], packet_header, packet_resource);
+                    for (auto &[path, resource] : packet_resource)
+                    {
+                        resource_location.emplace(path, static_cast<uint32_t>(subgroup_index));
+                    }
+                }
+            }
+            thiz.resource_index.reserve(resource_location.size());
+            thiz.resource_path.reserve(resource_location.size());
+            for (auto &[path, subgroup_index] : resource_location)
+            {
+                thiz.resource_index.emplace(make_key(path), subgroup_index);
+                thiz.resource_path.emplace_back(String::to_posix_style(path));
+            }
+            return;
+        }
+
+    public:
+        explicit Reader(
+            std::string_view source,
+            std::size_t cache_capacity = k_cache_capacity) : source(source.data(), source.size()), cache_capacity(std::max(cache_capacity, 1_size))
+        {
+            #if WINDOWS
+            thiz.modify_time = std::filesystem::last_write_time(std::filesystem::path{String::utf8_to_utf16(thiz.source)});
+            #else
+            thiz.modify_time = std::filesystem::last_write_time(std::filesystem::path{thiz.source});
+            #endif
+            thiz.load_information();
+        }
+
+        ~Reader(
+            ) = default;
+
+        /**
+         * @returns: every resource path inside the bundle
+         */
+
+        inline auto list(
+            ) const -> std::vector<std::string> const &
+        {
+            return thiz.resource_path;
+        }
+
+        /**
+         * @param path: resource path, case and separator insensitive
+         * @returns: true if the bundle contain the resource
+         */
+
+        inline auto has(
+            std::string_view path) const -> bool
+        {
+            return thiz.resource_index.contains(make_key(path));
+        }
+
+        /**
+         * @param path: resource path, case and separator insensitive
+         * @returns: the resource data, only the packet holding it is inflated
+         */
+
+        inline auto read(
+            std::string_view path) -> std::vector<uint8_t>
+        {
+            auto key = make_key(path);
+            auto location = thiz.resource_index.find(key);
+            assert_conditional(location != thiz.resource_index.end(), String::format(fmt::format("{}", Language::get("popcap.rsb.reader.cannot_find_resource")), std::string{path.data(), path.size()}), "read");
+            auto lock = std::lock_guard<std::mutex>{thiz.mutex};
+            auto &packet = thiz.get_packet(location->second);
+            auto resource = packet.resource.find(key);
+            assert_conditional(resource != packet.resource.end(), String::format(fmt::format("{}", Language::get("popcap.rsb.reader.cannot_find_resource")), std::string{path.data(), path.size()}), "read");
+            auto &section = resource->second.read_texture_additional ? packet.texture : packet.general;
+            return sub_bytes(section, resource->second.resource_data_section_offset, resource->second.resource_data_section_size);
+        }
+
+        /**
+         * @param path: resource path, case and separator insensitive
+         * @param destination: file to write the resource
+         */
+
+        inline auto read_fs(
+            std::string_view path,
+            std::string_view destination) -> void
+        {
+            write_bytes(std::string{destination.data(), destination.size()}, thiz.read(path));
+            return;
+        }
+
+        /**
+         * Readers stay open between calls so the index and the cache are reused
+         * At most k_opened_capacity readers are kept, the least recently used one is dropped first
+         * A reader is rebuilt when its bundle was modified, callers still holding the old one keep it alive
+         * @param source: bundle path
+         * @returns: the reader of the bundle
+         */
+
+        inline static auto open(
+            std::string_view source) -> std::shared_ptr<Reader>
+        {
+            auto &opened = registry();
+            auto lock = std::lock_guard<std::mutex>{opened.mutex};
+            auto key = std::string{source.data(), source.size()};
+            #if WINDOWS
+            auto modify_time = std::filesystem::last_write_time(std::filesystem::path{String::utf8_to_utf16(key)});
+            #else
+            auto modify_time = std::filesystem::last_write_time(std::filesystem::path{key});
+            #endif
+            auto location = std::find_if(opened.reader.begin(), opened.reader.end(), [&](auto &element) -> bool
+                                         { return element.first == key; });
+            if (location != opened.reader.end())
+            {
+                if (location->second->modify_time == modify_time)
+                {
+                    opened.reader.splice(opened.reader.begin(), opened.reader, location);
+                    return location->second;
+                }
+                opened.reader.erase(location);
+            }
+            auto reader = std::make_shared<Reader>(source);
+            opened.reader.emplace_front(key, reader);
+            if (opened.reader.size() > k_opened_capacity)
+            {
+                opened.reader.pop_back();
+            }
+            return reader;
+        }
+
+        /**
+         * Drop the opened reader of a bundle, so the file is released once no caller holds it
+         * @param source: bundle path
+         */
+
+        inline static auto close(
+            std::string_view source) -> void
+        {
+            auto &opened = registry();
+            auto lock = std::lock_guard<std::mutex>{opened.mutex};
+            opened.reader.remove_if([&](auto &element) -> bool
+                                    { return element.first == source; });
+            return;
+        }
+
+        /**
+         * Drop every opened reader
+         */
+
+        inline static auto clear(
+        ) -> void
+        {
+            auto &opened = registry();
+            auto lock = std::lock_guard<std::mutex>{opened.mutex};
+            opened.reader.clear();
+            return;
+        }
+
+    protected:
+        // most recently used reader first
+
+        struct Opened
+        {
+            std::list<std::pair<std::string, std::shared_ptr<Reader>>> reader;
+            std::mutex mutex;
+        };
+
+        inline static auto registry(
+        ) -> Opened &
+        {
+            static auto value = Opened{};
+            return value;
+        }
+    };
+}
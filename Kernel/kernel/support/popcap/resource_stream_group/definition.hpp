@@ -84,6 +84,28 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        TextureDimension &result) -> void
+    {
+        auto required = JsonReader::required_key("width"_sv, "height"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "width")
+            {
+                JsonReader::read(field.value(), result.width);
+            }
+            else if (key == "height")
+            {
+                JsonReader::read(field.value(), result.height);
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct TextureValue
     {
         int index;
@@ -170,6 +192,50 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        TextureValue &result) -> void
+    {
+        auto required = JsonReader::required_key("dimension"_sv);
+        auto texture_resource_information_section_block_size = size_t{0};
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "dimension")
+            {
+                JsonReader::read(field.value(), result.dimension);
+                continue;
+            }
+            if (key == "format")
+            {
+                JsonReader::read(field.value(), result.texture_infomation.format);
+            }
+            else if (key == "pitch")
+            {
+                JsonReader::read(field.value(), result.texture_infomation.pitch);
+            }
+            else if (key == "alpha_size")
+            {
+                JsonReader::read(field.value(), result.texture_infomation.alpha_size);
+            }
+            else if (key == "scale")
+            {
+                JsonReader::read(field.value(), result.texture_infomation.scale);
+            }
+            else
+            {
+                continue;
+            }
+            texture_resource_information_section_block_size += size_t{4};
+        }
+        if (texture_resource_information_section_block_size != size_t{0}) {
+            result.texture_resource_information_section_block_size = texture_resource_information_section_block_size + size_t{8};
+        }
+        required.check();
+        return;
+    }
+
     struct TextureResourceAdditional
     {
         // std::string_view type = k_texture_type_string;
@@ -236,6 +302,34 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
         return;
     }
 
+    inline auto from_json(
+        simdjson::ondemand::value value,
+        Resource &result) -> void
+    {
+        auto required = JsonReader::required_key("path"_sv);
+        for (auto field : value.get_object())
+        {
+            auto key = static_cast<std::string_view>(field.unescaped_key());
+            required.visit(key);
+            if (key == "path")
+            {
+                JsonReader::read(field.value(), result.path);
+            }
+            else if (key == "additional")
+            {
+                auto additional = field.value().value();
+                if (JsonReader::is_null(additional))
+                {
+                    continue;
+                }
+                JsonReader::read(additional, result.texture_additional.value);
+                result.use_texture_additional_instead = true;
+            }
+        }
+        required.check();
+        return;
+    }
+
     struct PacketStructure
     {
         uint32_t version;
@@ -69,7 +69,7 @@ namespace Sen::Kernel::Support::PopCap::ResourceStreamGroup
             packet_compression_to_data(information_structure_header.resource_data_section_compression, definition.compression);
             for (auto &current_resource_type : std::vector<std::string_view>{k_general_type_string, k_texture_type_string})
             {
-                auto resource_data = resource_data_section_view_stored.contains(current_resource_type) ? resource_data_section_view_stored[current_resource_type].toBytes() : std::vector<uint8_t>{};
+                auto resource_data = resource_data_section_view_stored.contains(current_resource_type) ? resource_data_section_view_stored[current_resource_type].release() : std::vector<uint8_t>{};
                 auto resource_padding_size = k_none_size;
                 auto resource_data_section_offset = static_cast<uint32_t>(stream.write_pos);
                 auto resource_data_section_size_original = static_cast<uint32_t>(resource_data.size());
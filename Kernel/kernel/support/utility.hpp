@@ -1,14 +1,18 @@
 #pragma once
 
 #include "kernel/support/miscellaneous/shared.hpp"
+#include "kernel/support/miscellaneous/batch.hpp"
 #include "kernel/support/texture/invoke.hpp"
+#include "kernel/support/popcap/resource_group/definition.hpp"
 #include "kernel/support/popcap/resource_group/convert.hpp"
 #include "kernel/support/popcap/resource_group/common.hpp"
+#include "kernel/support/popcap/res_info/definition.hpp"
 #include "kernel/support/popcap/res_info/common.hpp"
 #include "kernel/support/popcap/res_info/convert.hpp"
 #include "kernel/support/popcap/zlib/uncompress.hpp"
 #include "kernel/support/popcap/zlib/compress.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/unpack.hpp"
+#include "kernel/support/popcap/resource_stream_bundle/reader.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/miscellaneous/unpack_resource.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/miscellaneous/pack_resource.hpp"
 #include "kernel/support/popcap/resource_stream_bundle/miscellaneous/unpack_cipher.hpp"
@@ -21,6 +25,7 @@
 #include "kernel/support/popcap/reflection_object_notation/decode.hpp"
 #include "kernel/support/popcap/reflection_object_notation/encode.hpp"
 #include "kernel/support/popcap/reflection_object_notation/instance.hpp"
+#include "kernel/support/popcap/reflection_object_notation/batch.hpp"
 #include "kernel/support/popcap/new_type_object_notation/encode.hpp"
 #include "kernel/support/popcap/new_type_object_notation/decode.hpp"
 #include "kernel/support/popcap/compiled_text/decode.hpp"
@@ -42,6 +47,7 @@
 #include "kernel/support/popcap/particles/from_xml.hpp"
 #include "kernel/support/popcap/player_info/encode.hpp"
 #include "kernel/support/popcap/player_info/decode.hpp"
+#include "kernel/support/popcap/player_info/batch.hpp"
 #include "kernel/support/popcap/animation/decode.hpp"
 #include "kernel/support/popcap/animation/encode.hpp"
 #include "kernel/support/popcap/animation/common.hpp"
@@ -51,6 +57,7 @@
 #include "kernel/support/popcap/animation/convert/instance.hpp"
 #include "kernel/support/popcap/animation/convert/resize.hpp"
 #include "kernel/support/popcap/animation/miscellaneous/dump.hpp"
+#include "kernel/support/popcap/animation/miscellaneous/render.hpp"
 #include "kernel/support/popcap/re_animation/decode.hpp"
 #include "kernel/support/popcap/re_animation/encode.hpp"
 #include "kernel/support/popcap/re_animation/common.hpp"
@@ -16,7 +16,28 @@ namespace Sen::Kernel::Support::WWise::SoundBank
 
         inline static constexpr auto k_data_block_padding_size = 0x10_size;
 
-        inline static auto k_bitset_boolean_fill = false;
+        // wem are written and read by at most this many threads, encode also keep at most this many wem in memory
+
+        inline static auto const k_media_thread_limit = std::min(ThreadPool::hardware_concurrency(), 16_size);
+
+        // sink of the unused bits, thread local since hierarchy objects are exchanged in parallel
+
+        inline static thread_local auto k_bitset_boolean_fill = false;
+
+        // fixed layout part of the state manager sections
+
+        using StateGroupCustomTransitionRecord = Record<
+            &StateGroupCustomTransition::from,
+            &StateGroupCustomTransition::to,
+            &StateGroupCustomTransition::time>;
+
+        using GameSynchronizationU1Record = Record<
+            &GameSynchronizationU1::u1,
+            &GameSynchronizationU1::u2,
+            &GameSynchronizationU1::u3,
+            &GameSynchronizationU1::u4,
+            &GameSynchronizationU1::u5,
+            &GameSynchronizationU1::u6>;
 
         struct ChunkSignFlag
         {
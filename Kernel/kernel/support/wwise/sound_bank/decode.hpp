@@ -37,10 +37,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             value.id = stream.readUint32();
             value.default_transition = stream.readUint32();
             exchange_list(stream, value.custom_transition, [](auto &data, auto &value)
-                          {
-                value.from = data.readUint32();
-                value.to = data.readUint32();
-                value.time = data.readUint32(); }, stream.readUint32());
+                          { StateGroupCustomTransitionRecord::read(data, value); }, stream.readUint32());
             return;
         }
 
@@ -91,12 +88,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             value.id = stream.readUint32();
             if (k_version >= 140_ui)
             {
-                value.u1 = stream.readFloat();
-                value.u2 = stream.readFloat();
-                value.u3 = stream.readFloat();
-                value.u4 = stream.readFloat();
-                value.u5 = stream.readFloat();
-                value.u6 = stream.readFloat();
+                GameSynchronizationU1Record::read(stream, value);
             }
             return;
         }
@@ -182,12 +174,15 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             auto data_sign = ChunkSign{};
             exchange_chuck_sign(stream, data_sign);
             assert_conditional(data_sign.id == ChunkSignFlag::data, fmt::format("{}", Kernel::Language::get("wwise.soundbank.decode.invalid_wem_data_bank")), "exchange_media");
-            auto data_stream = DataStreamView{stream.readBytes(static_cast<size_t>(data_sign.size))};
-            for (auto data_index : Range(data_list.size()))
+            auto data_size = static_cast<size_t>(data_sign.size);
+            auto data_view = stream.read_block(data_size);
+            for (auto &element : data_list)
             {
-                auto data = data_stream.getBytes(data_list[data_index].pos, data_list[data_index].pos + data_list[data_index].size);
-                write_bytes(fmt::format("{}/media/{}.wem", destination, value.at(data_index)), data);
+                assert_conditional(static_cast<size_t>(element.pos) + static_cast<size_t>(element.size) <= data_size, fmt::format("{}", Kernel::Language::get("wwise.soundbank.decode.invalid_wem_data_bank")), "exchange_media");
             }
+            FileSystem::create_directory(fmt::format("{}/media", destination));
+            parallel_for(data_list.size(), [&](size_t data_index)
+                         { FileSystem::write_binary(fmt::format("{}/media/{}.wem", destination, value[data_index]), std::span<const uint8_t>{data_view + data_list[data_index].pos, static_cast<size_t>(data_list[data_index].size)}); }, k_media_thread_limit);
             return;
         }
 
@@ -3541,111 +3536,81 @@ namespace Sen::Kernel::Support::WWise::SoundBank
 
         //-----------------------------------
 
+        // member of Hierarchy holding the object, one instantiation per HierarchyType
+
+        template <auto member>
+        inline static auto exchange_hierarchy_object(
+            DataStreamView &stream,
+            Hierarchy &value) -> void
+        {
+            exchange_section(stream, value.*member);
+            return;
+        }
+
+        /**
+         * Every object is length prefixed, so the object boundaries are scanned first,
+         * then each object is decoded on its own stream into a pre-sized slot in parallel
+         */
+
         inline static auto exchange_hierarchy(
             DataStreamView &stream,
             std::vector<Hierarchy> &value) -> void
         {
-            exchange_list(
-                stream, value, [](auto &data, auto &value)
-                {
-                    exchange_bit_multi<uint8_t>(data, value.type);
-                    auto next_item_pos = data.read_pos + static_cast<size_t>(data.readUint32());
-                    value.id = data.readUint32();
-                    switch (value.type) {
-                        case HierarchyType::stateful_property_setting: {
-                            exchange_section(data, value.stateful_property_setting);
-                            break;
-                        }
-                        case HierarchyType::event_action: {
-                            exchange_section(data, value.event_action);
-                            break;
-                        }
-                        case HierarchyType::event: {
-                            exchange_section(data, value.event);
-                            break;
-                        }
-                        case HierarchyType::dialogue_event: {
-                            exchange_section(data, value.dialogue_event);
-                            break;
-                        }
-                        case HierarchyType::attenuation: {
-                            exchange_section(data, value.attenuation);
-                            break;
-                        }
-                        case HierarchyType::low_frequency_oscillator_modulator: {
-                            exchange_section(data, value.low_frequency_oscillator_modulator);
-                            break;
-                        }
-                        case HierarchyType::envelope_modulator: {
-                            exchange_section(data, value.envelope_modulator);
-                            break;
-                        }
-                        case HierarchyType::time_modulator: {
-                            exchange_section(data, value.time_modulator);
-                            break;
-                        }
-                        case HierarchyType::effect: {
-                            exchange_section(data, value.effect);
-                            break;
-                        }
-                        case HierarchyType::source: {
-                            exchange_section(data, value.source);
-                            break;
-                        }
-                        case HierarchyType::audio_device: {
-                            exchange_section(data, value.audio_device);
-                            break;
-                        }
-                        case HierarchyType::audio_bus: {
-                            exchange_section(data, value.audio_bus);
-                            break;
-                        }
-                        case HierarchyType::auxiliary_audio_bus: {
-                            exchange_section(data, value.auxiliary_audio_bus);
-                            break;
-                        }
-                        case HierarchyType::sound: {
-                            exchange_section(data, value.sound);
-                            break;
-                        }
-                        case HierarchyType::sound_playlist_container: {
-                            exchange_section(data, value.sound_playlist_container);
-                            break;
-                        }
-                        case HierarchyType::sound_switch_container: {
-                            exchange_section(data, value.sound_switch_container);
-                            break;
-                        }
-                        case HierarchyType::sound_blend_container: {
-                            exchange_section(data, value.sound_blend_container);
-                            break;
-                        }
-                        case HierarchyType::actor_mixer: {
-                            exchange_section(data, value.actor_mixer);
-                            break;
-                        }
-                        case HierarchyType::music_track: {
-                            exchange_section(data, value.music_track);
-                            break;
-                        }
-                        case HierarchyType::music_segment: {
-                            exchange_section(data, value.music_segment);
-                            break;
-                        }
-                        case HierarchyType::music_playlist_container: {
-                            exchange_section(data, value.music_playlist_container);
-                            break;
-                        }
-                        case HierarchyType::music_switch_container: {
-                            exchange_section(data, value.music_switch_container);
-                            break;
-                        }
-                        default: {
-                            auto pos = std::string_view{std::to_string(data.read_pos)};
-                            assert_conditional(false, String::format(fmt::format("{}", Language::get("wwise.soundbank.decode.invalid_hierarchy_type")), magic_enum::enum_name(value.type), pos), "exchange_hierarchy");
-                        }
-                    }
-                    assert_conditional(data.read_pos == next_item_pos, fmt::format("invalid_pos. current: {} | next : {}", data.read_pos, next_item_pos), "exchange_hierarchy"); }, stream.readUint32());
+            // indexed by HierarchyType
+            static constexpr auto exchanger_table = std::array<void (*)(DataStreamView &, Hierarchy &), static_cast<size_t>(HierarchyType::time_modulator) + 1_size>{
+                nullptr,
+                &exchange_hierarchy_object<&Hierarchy::stateful_property_setting>,
+                &exchange_hierarchy_object<&Hierarchy::event_action>,
+                &exchange_hierarchy_object<&Hierarchy::event>,
+                &exchange_hierarchy_object<&Hierarchy::dialogue_event>,
+                &exchange_hierarchy_object<&Hierarchy::attenuation>,
+                &exchange_hierarchy_object<&Hierarchy::effect>,
+                &exchange_hierarchy_object<&Hierarchy::source>,
+                &exchange_hierarchy_object<&Hierarchy::audio_bus>,
+                &exchange_hierarchy_object<&Hierarchy::auxiliary_audio_bus>,
+                &exchange_hierarchy_object<&Hierarchy::sound>,
+                &exchange_hierarchy_object<&Hierarchy::sound_playlist_container>,
+                &exchange_hierarchy_object<&Hierarchy::sound_switch_container>,
+                &exchange_hierarchy_object<&Hierarchy::sound_blend_container>,
+                &exchange_hierarchy_object<&Hierarchy::actor_mixer>,
+                &exchange_hierarchy_object<&Hierarchy::music_track>,
+                &exchange_hierarchy_object<&Hierarchy::music_segment>,
+                &exchange_hierarchy_object<&Hierarchy::music_playlist_container>,
+                &exchange_hierarchy_object<&Hierarchy::music_switch_container>,
+                &exchange_hierarchy_object<&Hierarchy::low_frequency_oscillator_modulator>,
+                &exchange_hierarchy_object<&Hierarchy::envelope_modulator>,
+                &exchange_hierarchy_object<&Hierarchy::audio_device>,
+                &exchange_hierarchy_object<&Hierarchy::time_modulator>};
+            struct ObjectRange
+            {
+                HierarchyType type;
+                size_t pos;
+                size_t size;
+                uint8_t const *data;
+            };
+            auto object_list = std::vector<ObjectRange>(static_cast<size_t>(stream.readUint32()));
+            for (auto &object : object_list)
+            {
+                exchange_bit_multi<uint8_t>(stream, object.type);
+                object.size = static_cast<size_t>(stream.readUint32());
+                object.pos = stream.read_pos;
+                auto type_index = static_cast<size_t>(object.type);
+                if (type_index >= exchanger_table.size() || exchanger_table[type_index] == nullptr)
+                {
+                    assert_conditional(false, String::format(fmt::format("{}", Language::get("wwise.soundbank.decode.invalid_hierarchy_type")), std::string{magic_enum::enum_name(object.type)}, std::to_string(object.pos)), "exchange_hierarchy");
+                }
+                object.data = stream.read_block(object.size);
+            }
+            value.resize(object_list.size());
+            parallel_for(object_list.size(), [&](size_t index)
+                         {
+                auto &object = object_list[index];
+                auto &element = value[index];
+                auto data = DataStreamView{std::vector<uint8_t>(object.data, object.data + object.size)};
+                element.type = object.type;
+                element.id = data.readUint32();
+                exchanger_table[static_cast<size_t>(object.type)](data, element);
+                assert_conditional(data.read_pos == object.size, fmt::format("invalid_pos. current: {} | next : {}", object.pos + data.read_pos, object.pos + object.size), "exchange_hierarchy"); });
             return;
         }
 
@@ -3313,26 +3313,46 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             std::string_view source) -> void
         {
             chuck_sign_set(stream, sign);
-            auto data_stream = DataStreamView{};
             auto data_count = value.size();
+            auto data_list = std::vector<DATA>(data_count);
+            auto data_position = 0_size;
             for (auto data_index : Range(data_count))
             {
-                auto data = FileSystem::read_binary<uint8_t>(fmt::format("{}/media/{}.wem", source, value[data_index]));
-                stream.writeUint32(value[data_index]);
-                stream.writeUint32(static_cast<uint32_t>(data_stream.write_pos));
-                stream.writeUint32(static_cast<uint32_t>(data.size()));
-                data_stream.writeBytes(data);
-                if (data_index < data_count - 1_size)
+                if (data_index != 0_size)
                 {
-                    data_stream.writeNull(compute_padding_size(data_stream.write_pos, k_data_block_padding_size));
+                    data_position += compute_padding_size(data_position, k_data_block_padding_size);
                 }
+                auto &element = data_list[data_index];
+                element.pos = static_cast<uint32_t>(data_position);
+                element.size = static_cast<uint32_t>(FileSystem::file_size(fmt::format("{}/media/{}.wem", source, value[data_index])));
+                stream.writeUint32(value[data_index]);
+                stream.writeUint32(element.pos);
+                stream.writeUint32(element.size);
+                data_position += static_cast<size_t>(element.size);
             }
             chuck_sign_write(stream, sign);
             auto data_sign = ChunkSign{
                 .id = ChunkSignFlag::data,
-                .size = static_cast<uint32_t>(data_stream.size())};
+                .size = static_cast<uint32_t>(data_position)};
             exchange_chuck_sign(data_sign, stream);
-            stream.writeBytes(data_stream.toBytes());
+            // only a window of wem is held in memory, every window is loaded in parallel then laid out in order
+            auto data_window = std::vector<std::vector<uint8_t>>(k_media_thread_limit);
+            auto data_begin = stream.write_pos;
+            for (auto window_begin = 0_size; window_begin < data_count; window_begin += data_window.size())
+            {
+                auto window_size = std::min(data_window.size(), data_count - window_begin);
+                parallel_for(window_size, [&](size_t window_index)
+                             { data_window[window_index] = FileSystem::read_binary<uint8_t>(fmt::format("{}/media/{}.wem", source, value[window_begin + window_index])); }, k_media_thread_limit);
+                for (auto window_index : Range(window_size))
+                {
+                    auto &element = data_list[window_begin + window_index];
+                    auto &data = data_window[window_index];
+                    assert_conditional(data.size() == static_cast<size_t>(element.size), fmt::format("{}: {}/media/{}.wem", Language::get("cannot_read_file"), source, value[window_begin + window_index]), "exchange_media");
+                    stream.writeNull(data_begin + static_cast<size_t>(element.pos) - stream.write_pos);
+                    stream.writeBytes(data);
+                    data = std::vector<uint8_t>{};
+                }
+            }
             return;
         }
 
@@ -3365,10 +3385,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             stream.writeUint32(value.id);
             stream.writeUint32(value.default_transition);
             exchange_list<true, uint32_t>(stream, value.custom_transition, [](auto &data, auto &value)
-                                          {
-							data.writeUint32(value.from);
-							data.writeUint32(value.to);
-							data.writeUint32(value.time); });
+                                          { StateGroupCustomTransitionRecord::write(data, value); });
             return;
         }
 
@@ -3419,12 +3436,7 @@ namespace Sen::Kernel::Support::WWise::SoundBank
             stream.writeUint32(value.id);
             if (k_version >= 140_ui)
             {
-                stream.writeFloat(value.u1);
-                stream.writeFloat(value.u2);
-                stream.writeFloat(value.u3);
-                stream.writeFloat(value.u4);
-                stream.writeFloat(value.u5);
-                stream.writeFloat(value.u6);
+                GameSynchronizationU1Record::write(stream, value);
             }
             return;
         }
@@ -3497,113 +3509,70 @@ namespace Sen::Kernel::Support::WWise::SoundBank
 
         //---------------------------------
 
+        // member of Hierarchy holding the object, one instantiation per HierarchyType
+
+        template <auto member>
+        inline static auto exchange_hierarchy_object(
+            DataStreamView &stream,
+            Hierarchy const &value) -> void
+        {
+            exchange_section(stream, value.*member);
+            return;
+        }
+
+        // objects are encoded on their own stream in parallel, then laid out in order with their length prefix
+
         inline static auto exchange_hierarchy(
             DataStreamView &stream,
             std::vector<Hierarchy> const &value) -> void
         {
-            exchange_list<true, uint32_t>(stream, value, [](auto &data, auto &value)
-                                          {
-				exchange_bit_multi<uint8_t>(data, value.type);
-				auto section_pos = data.write_pos;
-				data.writeNull(4_size);
-				data.writeUint32(value.id);
-				switch (value.type) {
-                        case HierarchyType::stateful_property_setting: {
-                            exchange_section(data, value.stateful_property_setting);
-                            break;
-                        }
-                        case HierarchyType::event_action: {
-                            exchange_section(data, value.event_action);
-                            break;
-                        }
-                        case HierarchyType::event: {
-                            exchange_section(data, value.event);
-                            break;
-                        }
-                        case HierarchyType::dialogue_event: {
-                            exchange_section(data, value.dialogue_event);
-                            break;
-                        }
-                        case HierarchyType::attenuation: {
-                            exchange_section(data, value.attenuation);
-                            break;
-                        }
-                        case HierarchyType::low_frequency_oscillator_modulator: {
-                            exchange_section(data, value.low_frequency_oscillator_modulator);
-                            break;
-                        }
-                        case HierarchyType::envelope_modulator: {
-                            exchange_section(data, value.envelope_modulator);
-                            break;
-                        }
-                        case HierarchyType::time_modulator: {
-                            exchange_section(data, value.time_modulator);
-                            break;
-                        }
-                        case HierarchyType::effect: {
-                            exchange_section(data, value.effect);
-                            break;
-                        }
-                        case HierarchyType::source: {
-                            exchange_section(data, value.source);
-                            break;
-                        }
-                        case HierarchyType::audio_device: {
-                            exchange_section(data, value.audio_device);
-                            break;
-                        }
-                        case HierarchyType::audio_bus: {
-                            exchange_section(data, value.audio_bus);
-                            break;
-                        }
-                        case HierarchyType::auxiliary_audio_bus: {
-                            exchange_section(data, value.auxiliary_audio_bus);
-                            break;
-                        }
-                        case HierarchyType::sound: {
-                            exchange_section(data, value.sound);
-                            break;
-                        }
-                        case HierarchyType::sound_playlist_container: {
-                            exchange_section(data, value.sound_playlist_container);
-                            break;
-                        }
-                        case HierarchyType::sound_switch_container: {
-                            exchange_section(data, value.sound_switch_container);
-                            break;
-                        }
-                        case HierarchyType::sound_blend_container: {
-                            exchange_section(data, value.sound_blend_container);
-                            break;
-                        }
-                        case HierarchyType::actor_mixer: {
-                            exchange_section(data, value.actor_mixer);
-                            break;
-                        }
-                        case HierarchyType::music_track: {
-                            exchange_section(data, value.music_track);
-                            break;
-                        }
-                        case HierarchyType::music_segment: {
-                            exchange_section(data, value.music_segment);
-                            break;
-                        }
-                        case HierarchyType::music_playlist_container: {
-                            exchange_section(data, value.music_playlist_container);
-                            break;
-                        }
-                        case HierarchyType::music_switch_container: {
-                            exchange_section(data, value.music_switch_container);
-                            break;
-                        }
-                        default: {
-                            assert_conditional(false,  String::format(fmt::format("{}", Language::get("wwise.soundbank.encode.invalid_hierarchy_type")), magic_enum::enum_name(value.type)), "exchange_hierarchy");
-                        }
-                    }
-				auto current_pos = data.write_pos;
-				auto section_length = current_pos - section_pos - k_block_size;
-				data.writeUint32(static_cast<uint32_t>(section_length), section_pos);
-				data.write_pos = current_pos; });
+            // indexed by HierarchyType
+            static constexpr auto exchanger_table = std::array<void (*)(DataStreamView &, Hierarchy const &), static_cast<size_t>(HierarchyType::time_modulator) + 1_size>{
+                nullptr,
+                &exchange_hierarchy_object<&Hierarchy::stateful_property_setting>,
+                &exchange_hierarchy_object<&Hierarchy::event_action>,
+                &exchange_hierarchy_object<&Hierarchy::event>,
+                &exchange_hierarchy_object<&Hierarchy::dialogue_event>,
+                &exchange_hierarchy_object<&Hierarchy::attenuation>,
+                &exchange_hierarchy_object<&Hierarchy::effect>,
+                &exchange_hierarchy_object<&Hierarchy::source>,
+                &exchange_hierarchy_object<&Hierarchy::audio_bus>,
+                &exchange_hierarchy_object<&Hierarchy::auxiliary_audio_bus>,
+                &exchange_hierarchy_object<&Hierarchy::sound>,
+                &exchange_hierarchy_object<&Hierarchy::sound_playlist_container>,
+                &exchange_hierarchy_object<&Hierarchy::sound_switch_container>,
+                &exchange_hierarchy_object<&Hierarchy::sound_blend_container>,
+                &exchange_hierarchy_object<&Hierarchy::actor_mixer>,
+                &exchange_hierarchy_object<&Hierarchy::music_track>,
+                &exchange_hierarchy_object<&Hierarchy::music_segment>,
+                &exchange_hierarchy_object<&Hierarchy::music_playlist_container>,
+                &exchange_hierarchy_object<&Hierarchy::music_switch_container>,
+                &exchange_hierarchy_object<&Hierarchy::low_frequency_oscillator_modulator>,
+                &exchange_hierarchy_object<&Hierarchy::envelope_modulator>,
+                &exchange_hierarchy_object<&Hierarchy::audio_device>,
+                &exchange_hierarchy_object<&Hierarchy::time_modulator>};
+            for (auto &element : value)
+            {
+                auto type_index = static_cast<size_t>(element.type);
+                if (type_index >= exchanger_table.size() || exchanger_table[type_index] == nullptr)
+                {
+                    assert_conditional(false, String::format(fmt::format("{}", Language::get("wwise.soundbank.encode.invalid_hierarchy_type")), magic_enum::enum_name(element.type)), "exchange_hierarchy");
+                }
+            }
+            auto object_list = std::vector<DataStreamView>(value.size());
+            parallel_for(value.size(), [&](size_t index)
+                         {
+                auto &element = value[index];
+                auto &data = object_list[index];
+                data.writeUint32(element.id);
+                exchanger_table[static_cast<size_t>(element.type)](data, element); });
+            stream.writeUint32(static_cast<uint32_t>(value.size()));
+            for (auto index : Range(value.size()))
+            {
+                exchange_bit_multi<uint8_t>(stream, value[index].type);
+                stream.writeUint32(static_cast<uint32_t>(object_list[index].size()));
+                stream.append(std::move(object_list[index]));
+            }
             return;
         }
 
@@ -3753,8 +3722,9 @@ namespace Sen::Kernel::Support::WWise::SoundBank
         {
             auto stream = DataStreamView{};
             auto definition = *FileSystem::read_json(fmt::format("{}/data.json", source));
+            stream.spill(destination);
             process_whole(stream, definition, source);
-            stream.out_file(destination);
+            stream.commit();
             return;
         }
     };
@@ -1,6 +1,19 @@
-#include <iostream>
+#include "test/player_info.hpp"
+
+using namespace Sen::Kernel;
+
+/**
+ * usage: test [--filter <name>]
+*/
 
 int main(int size, char** argc)
 {
-	return 0;
-}
\ No newline at end of file
+	for (auto i = 1; i < size; ++i) {
+		auto argument = std::string_view{argc[i]};
+		if (argument == "--filter" && i + 1 < size) {
+			Test::filter = argc[++i];
+		}
+	}
+	Test::PlayerInfo::run();
+	return Test::failure_count == 0 ? 0 : 1;
+}
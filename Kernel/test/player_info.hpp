@@ -0,0 +1,365 @@
+#pragma once
+
+#include "test/test.hpp"
+#include "kernel/support/popcap/player_info/encode.hpp"
+#include "kernel/support/popcap/player_info/decode.hpp"
+
+namespace Sen::Kernel::Test::PlayerInfo {
+
+	using namespace Sen::Kernel::Support::PopCap::PlayerInfo;
+
+	using Common = Sen::Kernel::Support::PopCap::PlayerInfo::Common;
+
+	/**
+	 * Random profiles drawn from the definition schema
+	 * Raw engine output is reduced with a modulo, distributions are not the same on every standard library
+	*/
+
+	struct Generator {
+
+		std::mt19937 engine{11u};
+
+		inline auto next(
+			std::uint32_t bound
+		) -> std::uint32_t
+		{
+			return static_cast<std::uint32_t>(thiz.engine() % bound);
+		}
+
+		template <typename Value>
+		inline auto fill(
+			Value & value
+		) -> void
+		{
+			if constexpr (std::is_same_v<Value, Achievement>) {
+				for (auto member : k_achievement_member) {
+					value.*member = AchievementInfo{thiz.next(2) == 1, thiz.next(2) == 1};
+				}
+			}
+			else if constexpr (HasSchema<Value>) {
+				std::apply([&](auto const &...field) {
+					(thiz.fill(value.*field.member), ...);
+					((field.presence != nullptr ? static_cast<void>(value.*field.presence = thiz.next(4) != 0) : static_cast<void>(0)), ...);
+				}, Schema<Value>::value);
+			}
+			else if constexpr (IsList<Value>::value) {
+				value.resize(thiz.next(3));
+				for (auto & element : value) {
+					thiz.fill(element);
+				}
+			}
+			else if constexpr (std::is_enum_v<Value>) {
+				auto list = magic_enum::enum_values<Value>();
+				value = list[thiz.next(static_cast<std::uint32_t>(list.size()))];
+			}
+			else if constexpr (std::is_same_v<Value, bool>) {
+				value = thiz.next(2) == 1;
+			}
+			else if constexpr (std::is_same_v<Value, std::string>) {
+				value = fmt::format("s{}", thiz.next(1000));
+			}
+			else {
+				value = static_cast<Value>(thiz.next(120));
+			}
+			return;
+		}
+
+	};
+
+	// the slot value is dropped when the profile version has no position for its key
+
+	template <typename Class, auto t_key, typename Convert, auto... t_member>
+	inline static auto clear_unmapped(
+		Slot<t_key, Convert, t_member...> *,
+		Class & value
+	) -> void
+	{
+		if constexpr (sizeof...(t_member) != 0) {
+			if (!index_of(t_key).has_value()) {
+				Path<t_member...>::get(value) = {};
+			}
+		}
+		return;
+	}
+
+	template <typename Class, typename... Slot>
+	inline static auto clear_unmapped(
+		SlotList<Slot...> *,
+		Class & value
+	) -> void
+	{
+		(clear_unmapped(static_cast<Slot *>(nullptr), value), ...);
+		return;
+	}
+
+	template <typename Class, auto t_key, typename Convert, auto... t_member>
+	inline static auto has_unmapped(
+		Slot<t_key, Convert, t_member...> *,
+		Class const & value
+	) -> bool
+	{
+		return !index_of(t_key).has_value() && Convert::is_set(Path<t_member...>::get(value));
+	}
+
+	template <typename Class, typename... Slot>
+	inline static auto has_unmapped(
+		SlotList<Slot...> *,
+		Class const & value
+	) -> bool
+	{
+		return (has_unmapped(static_cast<Slot *>(nullptr), value) || ...);
+	}
+
+	/**
+	 * Profile of version with only the sections a real profile of that version carry
+	 * Three in four leave the keys the version has no position for at zero
+	*/
+
+	inline static auto make_detail(
+		Generator & generator,
+		int version
+	) -> DetailInfo
+	{
+		k_version = version;
+		auto value = DetailInfo{};
+		generator.fill(value);
+		value.version = version;
+		value.achievement.num_of_achievement = version == 13 ? (generator.next(2) == 1 ? k_achievement_base_count : k_achievement_extended_count) : 0;
+		if (generator.next(3) == 0) {
+			value.unknown_expand.clear();
+		}
+		else {
+			value.unknown_expand = "0A 0B";
+		}
+		if (version < 13) {
+			value.has_zen_garden = true;
+			if (version < 12) {
+				value.has_zombatar = false;
+			}
+			if (version == 12) {
+				value.has_zombatar = value.has_achievement;
+			}
+		}
+		else {
+			value.has_achievement = true;
+			if (version >= 30) {
+				value.has_zen_garden = true;
+			}
+		}
+		value.unlocked.first_time_play_i_zombie = value.unlocked.first_time_play_survival;
+		if (generator.next(4) != 0) {
+			clear_unmapped(static_cast<Common::PurchaseSlot *>(nullptr), value);
+			clear_unmapped(static_cast<Common::ChallengeSlot *>(nullptr), value.trophies);
+		}
+		return value;
+	}
+
+	/**
+	 * Profiles the codec before the layout tables handled the same way
+	 * Excluded: keys without a position, which it indexed with an unspecified value,
+	 * potted plants before 30 it read 80 of 88 bytes of,
+	 * and 25 achievements of version 13 filling the profile to its end, it read 13 of them
+	*/
+
+	inline static auto is_comparable(
+		DetailInfo const & value
+	) -> bool
+	{
+		if (has_unmapped(static_cast<Common::PurchaseSlot *>(nullptr), value)) {
+			return false;
+		}
+		if ((value.has_trophies || value.has_unlocked) && has_unmapped(static_cast<Common::ChallengeSlot *>(nullptr), value.trophies)) {
+			return false;
+		}
+		if (value.has_zen_garden && k_version < 30 && !index_of(GameMode::tree_of_wisdom).has_value()) {
+			return false;
+		}
+		if (k_version < 30 && value.has_zen_garden && !value.zen_garden.potted_plants.empty()) {
+			return false;
+		}
+		return !(k_version == 13 && value.achievement.num_of_achievement == k_achievement_extended_count && value.unknown_expand.empty());
+	}
+
+	template <typename Value>
+	inline static auto encode(
+		Value const & value
+	) -> std::vector<std::uint8_t>
+	{
+		auto writer = Definition::JsonWriter{};
+		write_value(writer, value);
+		auto stream = DataStreamView{};
+		Encode::process_whole(stream, nlohmann::ordered_json::parse(writer.ToString()));
+		return stream.toBytes();
+	}
+
+	// line endings follow the platform, they are dropped so the digest is the same everywhere
+
+	inline static auto decode(
+		std::vector<std::uint8_t> const & data
+	) -> std::string
+	{
+		auto stream = DataStreamView{data};
+		auto writer = Definition::JsonWriter{};
+		writer.WriteIndent = true;
+		Decode::process_whole(stream, writer);
+		auto result = writer.ToString();
+		std::erase(result, '\r');
+		return result;
+	}
+
+	inline static auto encode_json(
+		std::string const & value
+	) -> std::vector<std::uint8_t>
+	{
+		auto stream = DataStreamView{};
+		Encode::process_whole(stream, nlohmann::ordered_json::parse(value));
+		return stream.toBytes();
+	}
+
+	inline static constexpr auto k_iteration = 300_size;
+
+	/**
+	 * Digest of the comparable profiles of each version, encoded bytes then decoded json,
+	 * as the hand written codec before the layout tables produced them
+	 * Version 10 has none, its zen garden was read with tree_of_wisdom at an unspecified position
+	*/
+
+	inline static constexpr auto k_baseline_digest = std::array<std::pair<int, std::uint64_t>, 5>{
+		std::pair(11, 0xEF26039EEF636FBDull),
+		std::pair(12, 0x1939B00AB43E58CDull),
+		std::pair(13, 0x0762797C7814AA45ull),
+		std::pair(30, 0x3E25C4C2C00A0D7Cull),
+		std::pair(14, 0x7D7EE5408B6DF870ull),
+	};
+
+	inline static auto baseline_digest(
+		int version
+	) -> std::optional<std::uint64_t>
+	{
+		for (auto & [element, digest] : k_baseline_digest) {
+			if (element == version) {
+				return digest;
+			}
+		}
+		return std::nullopt;
+	}
+
+	/**
+	 * Every profile must decode and encode back to the same bytes,
+	 * and the comparable ones must give what the old codec gave
+	*/
+
+	inline static auto run_random(
+		int version
+	) -> void
+	{
+		auto generator = Generator{};
+		generator.engine.seed(static_cast<std::uint32_t>(version));
+		auto digest = Digest{};
+		for (auto i : Range<std::size_t>(k_iteration)) {
+			auto value = make_detail(generator, version);
+			auto data = encode(value);
+			auto json = decode(data);
+			expect(encode_json(json) == data, fmt::format("profile {} of version {} does not encode back to the same bytes", i, version));
+			if (is_comparable(value)) {
+				digest.update(data);
+				digest.update(json);
+			}
+		}
+		if (auto baseline = baseline_digest(version); baseline.has_value()) {
+			expect(digest.value == baseline.value(), fmt::format("version {} digest {:#x} is not the baseline one", version, digest.value));
+		}
+		return;
+	}
+
+	inline static auto run_summary(
+	) -> void
+	{
+		auto generator = Generator{};
+		generator.engine.seed(static_cast<std::uint32_t>(Common::k_profile_version));
+		auto digest = Digest{};
+		k_version = Common::k_profile_version;
+		for (auto i : Range<std::size_t>(k_iteration)) {
+			auto value = SummaryInfo{};
+			generator.fill(value);
+			value.version = Common::k_profile_version;
+			auto data = encode(value);
+			auto json = decode(data);
+			expect(encode_json(json) == data, fmt::format("summary {} does not encode back to the same bytes", i));
+			digest.update(data);
+			digest.update(json);
+		}
+		expect(digest.value == baseline_digest(Common::k_profile_version).value(), fmt::format("summary digest {:#x} is not the baseline one", digest.value));
+		return;
+	}
+
+	// a profile of version with every section present and nothing set
+
+	inline static auto make_empty(
+		int version
+	) -> DetailInfo
+	{
+		k_version = version;
+		auto value = DetailInfo{};
+		value.version = version;
+		value.has_unlocked = true;
+		value.has_trophies = true;
+		value.has_zen_garden = true;
+		value.has_achievement = version >= 12;
+		value.has_zombatar = version == 12;
+		value.achievement.num_of_achievement = version == 13 ? k_achievement_base_count : 0;
+		return value;
+	}
+
+	inline static auto run_fixed(
+	) -> void
+	{
+		check("PlayerInfo::i_zombie and survival keep their order", [] {
+			auto value = make_empty(30);
+			value.unlocked.first_time_play_i_zombie = true;
+			auto json = nlohmann::ordered_json::parse(decode(encode(value)));
+			expect(json["unlocked"]["first_time_play_i_zombie"] == true, "first_time_play_i_zombie is lost");
+			expect(json["unlocked"]["first_time_play_survival"] == false, "first_time_play_survival is set");
+		});
+		check("PlayerInfo::potted plant before 30 is 88 bytes", [] {
+			auto value = make_empty(12);
+			value.zen_garden.potted_plants.resize(2);
+			value.zen_garden.potted_plants[1].seed_type = SeedType::seed_marigold;
+			value.zen_garden.potted_plants[1].plant_status.time.last_chocolate_time = 77;
+			auto json = nlohmann::ordered_json::parse(decode(encode(value)));
+			auto & plant = json["zen_garden"]["potted_plants"][1];
+			expect(plant["seed_type"] == "seed_marigold", "second potted plant is misread");
+			expect(plant["plant_status"]["time"]["last_chocolate_time"] == 77, "second potted plant time is misread");
+		});
+		check("PlayerInfo::25 achievements of version 13", [] {
+			auto value = make_empty(13);
+			value.achievement.num_of_achievement = k_achievement_extended_count;
+			auto json = nlohmann::ordered_json::parse(decode(encode(value)));
+			expect(json["achievement"].contains("second_life"), "the extended achievements are dropped");
+		});
+		check("PlayerInfo::key without a position is skipped", [] {
+			auto value = make_empty(13);
+			auto data = encode(value);
+			value.zen_garden.purchased.last_purchesed_marigold_1_time = 5;
+			value.store.purchased.bacon_2 = true;
+			expect(encode(value) == data, "a key version 13 does not store changed the profile");
+		});
+		return;
+	}
+
+	inline static auto run(
+	) -> void
+	{
+		for (auto version : {10, 11, 12, 13, 30}) {
+			check(fmt::format("PlayerInfo::random profiles of version {}", version), [&] {
+				run_random(version);
+			});
+		}
+		check("PlayerInfo::random summaries", [] {
+			run_summary();
+		});
+		run_fixed();
+		return;
+	}
+
+}
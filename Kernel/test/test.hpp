@@ -0,0 +1,83 @@
+#pragma once
+
+#include "kernel/definition/library.hpp"
+#include "kernel/definition/utility.hpp"
+
+namespace Sen::Kernel::Test {
+
+	// failed expectations of the whole run, the executable exit with a failure when it is not 0
+
+	inline static auto failure_count = 0_size;
+
+	// only tests whose name contains the filter are run
+
+	inline static auto filter = std::string{};
+
+	inline static auto expect(
+		bool condition,
+		std::string_view message
+	) -> void
+	{
+		if (!condition) {
+			++failure_count;
+			std::cout << fmt::format("    failed: {}", message) << '\n' << std::flush;
+		}
+		return;
+	}
+
+	/**
+	 * Run one test, whatever it throws is a failure
+	 * name: test name
+	 * callback: the test body, it report through expect
+	*/
+
+	template <typename Callback>
+	inline static auto check(
+		std::string_view name,
+		const Callback & callback
+	) -> void
+	{
+		if (!filter.empty() && name.find(filter) == std::string_view::npos) {
+			return;
+		}
+		auto before = failure_count;
+		try {
+			callback();
+		}
+		catch (std::exception & e) {
+			expect(false, e.what());
+		}
+		std::cout << fmt::format("{:<48} {}", name, failure_count == before ? "ok" : "FAILED") << '\n' << std::flush;
+		return;
+	}
+
+	/**
+	 * FNV-1a over everything updated into it
+	 * Outputs of a run are folded into one digest and compared with the digest an earlier kernel gave
+	*/
+
+	struct Digest {
+
+		std::uint64_t value{0xCBF29CE484222325ull};
+
+		inline auto update(
+			std::span<std::uint8_t const> data
+		) -> void
+		{
+			for (auto byte : data) {
+				thiz.value = (thiz.value ^ byte) * 0x100000001B3ull;
+			}
+			return;
+		}
+
+		inline auto update(
+			std::string_view data
+		) -> void
+		{
+			thiz.update(std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const *>(data.data()), data.size()});
+			return;
+		}
+
+	};
+
+}
@@ -48,7 +48,12 @@ namespace Sen.Script.Executor.Methods.WWise.Media.Decode {
                 return;
             },
             batch_forward(argument: BatchArgument): void {
-                return basic_batch(this, argument, false);
+                const files: Array<string> = Kernel.FileSystem.read_directory(argument.directory).filter((path: string) => Kernel.FileSystem.is_file(path) && this.filter[1].test(path));
+                clock.start_safe();
+                Sen.Script.Support.Wwise.Media.Decode.process_all(files.map((source: string) => [source, `${Kernel.Path.except_extension(source)}.wav`]));
+                clock.stop_safe();
+                Console.finished(format(Kernel.Language.get("batch.process.count"), files.length));
+                return;
             },
             is_enabled: true,
             configuration: undefined!,
@@ -26,22 +26,45 @@ namespace Sen.Script.Support.Texture.Upscaler {
         return rule[Number(Sen.Script.Executor.input_integer(new_rule) - 1n)][1];
     }
 
-    export function process(source: string, destination: string) {
+    export function program_path(): string {
         const operating_system = Kernel.OperatingSystem.current();
         assert(operating_system === "Windows" || operating_system === "macOS" || operating_system === "Linux", "unsupported_operating_system"); // TODO
         const real_esrgan_program_third_path = Home.query("~/../thirdapp/real_esrgan"); //
         const real_esrgan_program_file_path = `${real_esrgan_program_third_path}/realesrgan-ncnn-vulkan${operating_system === "Windows" ? ".exe" : ""}`;
         assert(Kernel.FileSystem.is_file(real_esrgan_program_file_path), "cannot_find_third"); // TODO
         assert(Kernel.FileSystem.is_directory(`${real_esrgan_program_third_path}/models`), "cannot_find_real_esrgan_models_folder"); // TODO
+        return real_esrgan_program_file_path;
+    }
+
+    export function select_model(): string {
+        const real_esrgan_program_third_path = Home.query("~/../thirdapp/real_esrgan"); //
         const model_list: Array<string> = Kernel.FileSystem.read_directory_only_file(`${real_esrgan_program_third_path}/models`).filter((e) => Kernel.Path.extname(e).toLowerCase() === ".param");
         assert(model_list.length > 0, "real_esrgan_model_folder_is_empty");
         const model_rule: Array<[bigint, string]> = model_list.map((e, i) => [BigInt(i + 1), Kernel.Path.base_without_extension(e).toLowerCase()]);
         Console.argument("Enter model"); //TODO.
-        const model_selected: string = load_string_by_int(model_rule);
-        const command = `${real_esrgan_program_file_path} -i "${source}" -o "${destination}" -n "${model_selected}" > nul 2>&1`;
-        Kernel.FileSystem.Operation.remove(destination);
-        Kernel.Process.execute(command);
-        assert(Kernel.FileSystem.is_file(destination), "failed_to_upscale_image"); //TODO
+        return load_string_by_int(model_rule);
+    }
+
+    export function process(source: string, destination: string) {
+        process_all([[source, destination]]);
+        return;
+    }
+
+    /**
+     * Upscale every image with the same model, the upscaler processes run in parallel
+     * @param list source and destination of each image
+     * @param limit concurrent upscaler count, one by default since every process already use the GPU
+     */
+
+    export function process_all(list: Array<[string, string]>, limit: bigint = 1n) {
+        const real_esrgan_program_file_path = program_path();
+        const model_selected: string = select_model();
+        list.forEach(([, destination]) => Kernel.FileSystem.Operation.remove(destination));
+        Kernel.Process.spawn_all(
+            list.map(([source, destination]) => [real_esrgan_program_file_path, "-i", source, "-o", destination, "-n", model_selected]),
+            limit,
+        );
+        list.forEach(([, destination]) => assert(Kernel.FileSystem.is_file(destination), "failed_to_upscale_image")); //TODO
         return;
     }
 
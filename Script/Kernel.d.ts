@@ -234,6 +234,32 @@ declare namespace Sen {
              */
             export function execute(command: string): string;
 
+            /**
+             * Result of a spawned process.
+             */
+            export interface SpawnResult {
+                exit_code: bigint;
+                output: string;
+                error: string;
+            }
+
+            /**
+             * Spawns a program directly, without a shell, and waits for it.
+             *
+             * @param argument The program followed by its arguments, the program is searched in PATH.
+             * @returns The exit code, stdout and stderr of the process.
+             */
+            export function spawn(argument: Array<string>): SpawnResult;
+
+            /**
+             * Spawns every command with bounded parallelism.
+             *
+             * @param command_list Every command as the program followed by its arguments.
+             * @param limit How many processes can run at the same time, defaults to the hardware concurrency.
+             * @returns The result of each command, in the same order.
+             */
+            export function spawn_all(command_list: Array<Array<string>>, limit?: bigint): Array<SpawnResult>;
+
             /**
              * Checks if a command exists in the system's PATH environment variable.
              *
@@ -673,6 +699,15 @@ declare namespace Sen {
              */
             export function read_directory(source: string): Array<string>;
 
+            /**
+             * Walk a directory and its nested directories on multiple threads.
+             * @param source - The path of the directory to walk
+             * @param extension - Accepted extensions with the dot, case-insensitive, empty array accepts every file
+             * @param pattern - Glob pattern relative to source, "*" and "?" stay inside a directory, "**" crosses directories, empty string accepts every file
+             * @param callback - Receives each batch of file paths as soon as it is ready, throwing stops the walk
+             */
+            export function walk_directory(source: string, extension: Array<string>, pattern: string, callback: (files: Array<string>) => void): void;
+
             /**
              * Read all files and directories within a directory.
              * @param source - The path of the directory to read
@@ -823,6 +858,14 @@ declare namespace Sen {
                  * @returns The MD5 hash of the file's contents.
                  */
                 export function hash_fs(source: string): string;
+
+                /**
+                 * Hashes multiple files using the MD5 algorithm across worker threads.
+                 *
+                 * @param source The paths to the files to hash.
+                 * @returns The MD5 hash of every file, in the same order.
+                 */
+                export function hash_fs_as_multiple_threads(source: Array<string>): Array<string>;
             }
 
             /**
@@ -867,6 +910,14 @@ declare namespace Sen {
                  * @returns The SHA-224 hash of the file's contents.
                  */
                 export function hash_fs(source: string): string;
+
+                /**
+                 * Hashes multiple files using the SHA-224 algorithm across worker threads.
+                 *
+                 * @param source The paths to the files to hash.
+                 * @returns The SHA-224 hash of every file, in the same order.
+                 */
+                export function hash_fs_as_multiple_threads(source: Array<string>): Array<string>;
             }
 
             /**
@@ -888,6 +939,14 @@ declare namespace Sen {
                  * @returns The SHA-256 hash of the file's contents.
                  */
                 export function hash_fs(source: string): string;
+
+                /**
+                 * Hashes multiple files using the SHA-256 algorithm across worker threads.
+                 *
+                 * @param source The paths to the files to hash.
+                 * @returns The SHA-256 hash of every file, in the same order.
+                 */
+                export function hash_fs_as_multiple_threads(source: Array<string>): Array<string>;
             }
 
             /**
@@ -909,6 +968,14 @@ declare namespace Sen {
                  * @returns The SHA-384 hash of the file's contents.
                  */
                 export function hash_fs(source: string): string;
+
+                /**
+                 * Hashes multiple files using the SHA-384 algorithm across worker threads.
+                 *
+                 * @param source The paths to the files to hash.
+                 * @returns The SHA-384 hash of every file, in the same order.
+                 */
+                export function hash_fs_as_multiple_threads(source: Array<string>): Array<string>;
             }
 
             /**
@@ -930,6 +997,14 @@ declare namespace Sen {
                  * @returns The SHA-512 hash of the file's contents.
                  */
                 export function hash_fs(source: string): string;
+
+                /**
+                 * Hashes multiple files using the SHA-512 algorithm across worker threads.
+                 *
+                 * @param source The paths to the files to hash.
+                 * @returns The SHA-512 hash of every file, in the same order.
+                 */
+                export function hash_fs_as_multiple_threads(source: Array<string>): Array<string>;
             }
 
             /**
@@ -1477,6 +1552,46 @@ declare namespace Sen {
                      *              Example: `[["source1.txt", "destination1.rton"], ["source2.png", "destination2.rton"]]`
                      */
                     export function encode_fs_as_multiple_threads(...params: Array<[string, string]>): void;
+
+                    /**
+                     * Key and initialization vector of an encrypted RTON batch.
+                     */
+                    export interface BatchRijndael {
+                        key: string;
+                        iv: string;
+                    }
+
+                    /**
+                     * Outcome of a directory batch, a failed file does not stop the others.
+                     */
+                    export interface BatchResult {
+                        processed: bigint;
+                        error: Array<{ source: string; message: string }>;
+                    }
+
+                    /**
+                     * Decodes every `.rton` file below a directory into `.json` files, mirroring the tree.
+                     *
+                     * @param source The directory to walk.
+                     * @param destination The directory receiving the decoded files.
+                     * @param rijndael Key and IV used for files that are encrypted, null if none are.
+                     * @param progress Called on the calling thread with the done and total file counts.
+                     * @param limit Maximum worker count, defaults to the hardware concurrency.
+                     * @returns The processed count and the files that failed.
+                     */
+                    export function decode_directory(source: string, destination: string, rijndael?: BatchRijndael | null, progress?: (done: bigint, total: bigint) => void, limit?: bigint): BatchResult;
+
+                    /**
+                     * Encodes every `.json` file below a directory into `.rton` files, mirroring the tree.
+                     *
+                     * @param source The directory to walk.
+                     * @param destination The directory receiving the encoded files.
+                     * @param rijndael Key and IV used to encrypt every file, null to keep them plain.
+                     * @param progress Called on the calling thread with the done and total file counts.
+                     * @param limit Maximum worker count, defaults to the hardware concurrency.
+                     * @returns The processed count and the files that failed.
+                     */
+                    export function encode_directory(source: string, destination: string, rijndael?: BatchRijndael | null, progress?: (done: bigint, total: bigint) => void, limit?: bigint): BatchResult;
                 }
 
                 /**
@@ -1733,6 +1848,31 @@ declare namespace Sen {
                      * @returns {void} No return value, function writes encoded data to the destination file.
                      */
                     export function encode_fs(source: string, destination: string): void;
+
+                    /**
+                     * Outcome of a directory batch, shared with the RTON batch.
+                     */
+                    export type BatchResult = RTON.BatchResult;
+
+                    /**
+                     * Decodes every `.dat` profile below a directory into `.json` files, mirroring the tree.
+                     *
+                     * @param source The directory to walk.
+                     * @param destination The directory receiving the decoded files.
+                     * @param limit Maximum worker count, defaults to the hardware concurrency.
+                     * @returns The processed count and the profiles that failed.
+                     */
+                    export function decode_directory(source: string, destination: string, limit?: bigint): BatchResult;
+
+                    /**
+                     * Encodes every `.json` profile below a directory into `.dat` files, mirroring the tree.
+                     *
+                     * @param source The directory to walk.
+                     * @param destination The directory receiving the encoded files.
+                     * @param limit Maximum worker count, defaults to the hardware concurrency.
+                     * @returns The processed count and the profiles that failed.
+                     */
+                    export function encode_directory(source: string, destination: string, limit?: bigint): BatchResult;
                 }
 
                 /**
@@ -1957,6 +2097,22 @@ declare namespace Sen {
                          */
                         export function dump_document(source: string, document: Document): void;
 
+                        /**
+                         * Render every frame of the main sprite natively, frames are rendered in parallel
+                         * and written to destination/frames, with data.json and the apng when requested
+                         * @param animation - Decoded animation
+                         * @param media - Directory of the animation images
+                         * @param destination - Output directory
+                         * @param setting - Same setting as the script animation generator
+                         * @returns The rendered frame dimension, computed when width and height are 0
+                         */
+                        export function render(
+                            animation: Script.Support.PopCap.Animation.SexyAnimation,
+                            media: string,
+                            destination: string,
+                            setting: Script.Support.PopCap.Animation.Miscellaenous.GenerateAnimation.Setting,
+                        ): { width: bigint; height: bigint };
+
                         /**
                          * Function to save a document object to a specified location
                          * @param destination  Path to the destination document
@@ -2162,6 +2318,41 @@ declare namespace Sen {
                     export function pack_resource(source: string, destination: string): void;
                     export function unpack_cipher(source: string, destination: string): void;
 
+                    /**
+                     * Extracts a single resource from an RSB bundle without unpacking it.
+                     *
+                     * Only the packet holding the resource is inflated. The bundle index and recently used packets are kept between calls.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @param resource_path {string} Path of the resource inside the bundle, case and separator insensitive.
+                     * @param destination {string} Path to the destination file.
+                     * @returns {void} No return value, function writes the resource to the destination file.
+                     */
+                    export function read_resource_fs(source: string, resource_path: string, destination: string): void;
+
+                    /**
+                     * Lists every resource path inside an RSB bundle.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @returns {Array<string>} Every resource path stored in the bundle.
+                     */
+                    export function resource_list(source: string): Array<string>;
+
+                    /**
+                     * Releases the opened reader of an RSB bundle.
+                     *
+                     * @param source {string} Path to the source RSB bundle file.
+                     * @returns {void} No return value.
+                     */
+                    export function close_reader(source: string): void;
+
+                    /**
+                     * Releases every opened RSB reader.
+                     *
+                     * @returns {void} No return value.
+                     */
+                    export function clear_reader(): void;
+
                     /**
                      * Unpacks an RSB bundle file and returns the manifest for modding purposes.
                      *
@@ -4617,6 +4808,16 @@ declare namespace Sen {
              */
             public read_position: bigint;
 
+            /**
+             * Same as read_position but as Number, cheaper to move inside byte level loops
+             */
+            public read_offset: number;
+
+            /**
+             * Same as write_position but as Number, cheaper to move inside byte level loops
+             */
+            public write_offset: number;
+
             /**
              * Constructor for the DataStreamView class
              *
@@ -5854,6 +6055,256 @@ declare namespace Sen {
              * @returns {void} (doesn't return a value)
              */
             public close(): void;
+
+            /**
+             * Number fast path
+             *
+             * Same as the BigInt read and write methods, but the value is a Number so no BigInt is created per call.
+             * Values are read from or written to the current position, which is then advanced.
+             */
+
+            /**
+             * Read an unsigned 8-bit integer as Number from the current read position
+             */
+            public readUint8AsNumber(): number;
+
+            /**
+             * Read an unsigned 16-bit integer as Number from the current read position
+             */
+            public readUint16AsNumber(): number;
+
+            /**
+             * Read an unsigned 24-bit integer as Number from the current read position
+             */
+            public readUint24AsNumber(): number;
+
+            /**
+             * Read an unsigned 32-bit integer as Number from the current read position
+             */
+            public readUint32AsNumber(): number;
+
+            /**
+             * Read a signed 8-bit integer as Number from the current read position
+             */
+            public readInt8AsNumber(): number;
+
+            /**
+             * Read a signed 16-bit integer as Number from the current read position
+             */
+            public readInt16AsNumber(): number;
+
+            /**
+             * Read a signed 24-bit integer as Number from the current read position
+             */
+            public readInt24AsNumber(): number;
+
+            /**
+             * Read a signed 32-bit integer as Number from the current read position
+             */
+            public readInt32AsNumber(): number;
+
+            /**
+             * Read a signed 32-bit variable-length integer as Number from the current read position
+             */
+            public readVarInt32AsNumber(): number;
+
+            /**
+             * Read an unsigned 32-bit variable-length integer as Number from the current read position
+             */
+            public readVarUint32AsNumber(): number;
+
+            /**
+             * Read a signed 32-bit zig-zag integer as Number from the current read position
+             */
+            public readZigZag32AsNumber(): number;
+
+            /**
+             * Read a 32-bit floating-point number as Number from the current read position
+             */
+            public readFloatAsNumber(): number;
+
+            /**
+             * Read a 64-bit floating-point number as Number from the current read position
+             */
+            public readDoubleAsNumber(): number;
+
+            /**
+             * Write an unsigned 8-bit integer from a Number at the current write position
+             */
+            public writeUint8AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 16-bit integer from a Number at the current write position
+             */
+            public writeUint16AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 24-bit integer from a Number at the current write position
+             */
+            public writeUint24AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 32-bit integer from a Number at the current write position
+             */
+            public writeUint32AsNumber(value: number): void;
+
+            /**
+             * Write a signed 8-bit integer from a Number at the current write position
+             */
+            public writeInt8AsNumber(value: number): void;
+
+            /**
+             * Write a signed 16-bit integer from a Number at the current write position
+             */
+            public writeInt16AsNumber(value: number): void;
+
+            /**
+             * Write a signed 24-bit integer from a Number at the current write position
+             */
+            public writeInt24AsNumber(value: number): void;
+
+            /**
+             * Write a signed 32-bit integer from a Number at the current write position
+             */
+            public writeInt32AsNumber(value: number): void;
+
+            /**
+             * Write a signed 32-bit variable-length integer from a Number at the current write position
+             */
+            public writeVarInt32AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 32-bit variable-length integer from a Number at the current write position
+             */
+            public writeVarUint32AsNumber(value: number): void;
+
+            /**
+             * Write a signed 32-bit zig-zag integer from a Number at the current write position
+             */
+            public writeZigZag32AsNumber(value: number): void;
+
+            /**
+             * Write a 32-bit floating-point number from a Number at the current write position
+             */
+            public writeFloatAsNumber(value: number): void;
+
+            /**
+             * Write a 64-bit floating-point number from a Number at the current write position
+             */
+            public writeDoubleAsNumber(value: number): void;
+
+            /**
+             * Read count elements from the current read position into a new Uint8Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Uint8Array} - A copy of the elements.
+             */
+            public readUint8Array(count: number): Uint8Array;
+
+            /**
+             * Read count elements from the current read position into a new Int8Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Int8Array} - A copy of the elements.
+             */
+            public readInt8Array(count: number): Int8Array;
+
+            /**
+             * Read count elements from the current read position into a new Uint16Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Uint16Array} - A copy of the elements.
+             */
+            public readUint16Array(count: number): Uint16Array;
+
+            /**
+             * Read count elements from the current read position into a new Int16Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Int16Array} - A copy of the elements.
+             */
+            public readInt16Array(count: number): Int16Array;
+
+            /**
+             * Read count elements from the current read position into a new Uint32Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Uint32Array} - A copy of the elements.
+             */
+            public readUint32Array(count: number): Uint32Array;
+
+            /**
+             * Read count elements from the current read position into a new Int32Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Int32Array} - A copy of the elements.
+             */
+            public readInt32Array(count: number): Int32Array;
+
+            /**
+             * Read count elements from the current read position into a new Float32Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Float32Array} - A copy of the elements.
+             */
+            public readFloat32Array(count: number): Float32Array;
+
+            /**
+             * Read count elements from the current read position into a new Float64Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Float64Array} - A copy of the elements.
+             */
+            public readFloat64Array(count: number): Float64Array;
+
+            /**
+             * Write every element of the Int8Array at the current write position, element endian follow the stream
+             *
+             * @param {Int8Array} value - The elements to write.
+             */
+            public writeInt8Array(value: Int8Array): void;
+
+            /**
+             * Write every element of the Uint16Array at the current write position, element endian follow the stream
+             *
+             * @param {Uint16Array} value - The elements to write.
+             */
+            public writeUint16Array(value: Uint16Array): void;
+
+            /**
+             * Write every element of the Int16Array at the current write position, element endian follow the stream
+             *
+             * @param {Int16Array} value - The elements to write.
+             */
+            public writeInt16Array(value: Int16Array): void;
+
+            /**
+             * Write every element of the Uint32Array at the current write position, element endian follow the stream
+             *
+             * @param {Uint32Array} value - The elements to write.
+             */
+            public writeUint32Array(value: Uint32Array): void;
+
+            /**
+             * Write every element of the Int32Array at the current write position, element endian follow the stream
+             *
+             * @param {Int32Array} value - The elements to write.
+             */
+            public writeInt32Array(value: Int32Array): void;
+
+            /**
+             * Write every element of the Float32Array at the current write position, element endian follow the stream
+             *
+             * @param {Float32Array} value - The elements to write.
+             */
+            public writeFloat32Array(value: Float32Array): void;
+
+            /**
+             * Write every element of the Float64Array at the current write position, element endian follow the stream
+             *
+             * @param {Float64Array} value - The elements to write.
+             */
+            public writeFloat64Array(value: Float64Array): void;
         }
 
         /**
@@ -5880,6 +6331,16 @@ declare namespace Sen {
              */
             public read_position: bigint;
 
+            /**
+             * Same as read_position but as Number, cheaper to move inside byte level loops
+             */
+            public read_offset: number;
+
+            /**
+             * Same as write_position but as Number, cheaper to move inside byte level loops
+             */
+            public write_offset: number;
+
             /**
              * Constructor for the DataStreamView class
              *
@@ -7126,6 +7587,256 @@ declare namespace Sen {
              * @returns {void} (doesn't return a value)
              */
             public close(): void;
+
+            /**
+             * Number fast path
+             *
+             * Same as the BigInt read and write methods, but the value is a Number so no BigInt is created per call.
+             * Values are read from or written to the current position, which is then advanced.
+             */
+
+            /**
+             * Read an unsigned 8-bit integer as Number from the current read position
+             */
+            public readUint8AsNumber(): number;
+
+            /**
+             * Read an unsigned 16-bit integer as Number from the current read position
+             */
+            public readUint16AsNumber(): number;
+
+            /**
+             * Read an unsigned 24-bit integer as Number from the current read position
+             */
+            public readUint24AsNumber(): number;
+
+            /**
+             * Read an unsigned 32-bit integer as Number from the current read position
+             */
+            public readUint32AsNumber(): number;
+
+            /**
+             * Read a signed 8-bit integer as Number from the current read position
+             */
+            public readInt8AsNumber(): number;
+
+            /**
+             * Read a signed 16-bit integer as Number from the current read position
+             */
+            public readInt16AsNumber(): number;
+
+            /**
+             * Read a signed 24-bit integer as Number from the current read position
+             */
+            public readInt24AsNumber(): number;
+
+            /**
+             * Read a signed 32-bit integer as Number from the current read position
+             */
+            public readInt32AsNumber(): number;
+
+            /**
+             * Read a signed 32-bit variable-length integer as Number from the current read position
+             */
+            public readVarInt32AsNumber(): number;
+
+            /**
+             * Read an unsigned 32-bit variable-length integer as Number from the current read position
+             */
+            public readVarUint32AsNumber(): number;
+
+            /**
+             * Read a signed 32-bit zig-zag integer as Number from the current read position
+             */
+            public readZigZag32AsNumber(): number;
+
+            /**
+             * Read a 32-bit floating-point number as Number from the current read position
+             */
+            public readFloatAsNumber(): number;
+
+            /**
+             * Read a 64-bit floating-point number as Number from the current read position
+             */
+            public readDoubleAsNumber(): number;
+
+            /**
+             * Write an unsigned 8-bit integer from a Number at the current write position
+             */
+            public writeUint8AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 16-bit integer from a Number at the current write position
+             */
+            public writeUint16AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 24-bit integer from a Number at the current write position
+             */
+            public writeUint24AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 32-bit integer from a Number at the current write position
+             */
+            public writeUint32AsNumber(value: number): void;
+
+            /**
+             * Write a signed 8-bit integer from a Number at the current write position
+             */
+            public writeInt8AsNumber(value: number): void;
+
+            /**
+             * Write a signed 16-bit integer from a Number at the current write position
+             */
+            public writeInt16AsNumber(value: number): void;
+
+            /**
+             * Write a signed 24-bit integer from a Number at the current write position
+             */
+            public writeInt24AsNumber(value: number): void;
+
+            /**
+             * Write a signed 32-bit integer from a Number at the current write position
+             */
+            public writeInt32AsNumber(value: number): void;
+
+            /**
+             * Write a signed 32-bit variable-length integer from a Number at the current write position
+             */
+            public writeVarInt32AsNumber(value: number): void;
+
+            /**
+             * Write an unsigned 32-bit variable-length integer from a Number at the current write position
+             */
+            public writeVarUint32AsNumber(value: number): void;
+
+            /**
+             * Write a signed 32-bit zig-zag integer from a Number at the current write position
+             */
+            public writeZigZag32AsNumber(value: number): void;
+
+            /**
+             * Write a 32-bit floating-point number from a Number at the current write position
+             */
+            public writeFloatAsNumber(value: number): void;
+
+            /**
+             * Write a 64-bit floating-point number from a Number at the current write position
+             */
+            public writeDoubleAsNumber(value: number): void;
+
+            /**
+             * Read count elements from the current read position into a new Uint8Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Uint8Array} - A copy of the elements.
+             */
+            public readUint8Array(count: number): Uint8Array;
+
+            /**
+             * Read count elements from the current read position into a new Int8Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Int8Array} - A copy of the elements.
+             */
+            public readInt8Array(count: number): Int8Array;
+
+            /**
+             * Read count elements from the current read position into a new Uint16Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Uint16Array} - A copy of the elements.
+             */
+            public readUint16Array(count: number): Uint16Array;
+
+            /**
+             * Read count elements from the current read position into a new Int16Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Int16Array} - A copy of the elements.
+             */
+            public readInt16Array(count: number): Int16Array;
+
+            /**
+             * Read count elements from the current read position into a new Uint32Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Uint32Array} - A copy of the elements.
+             */
+            public readUint32Array(count: number): Uint32Array;
+
+            /**
+             * Read count elements from the current read position into a new Int32Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Int32Array} - A copy of the elements.
+             */
+            public readInt32Array(count: number): Int32Array;
+
+            /**
+             * Read count elements from the current read position into a new Float32Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Float32Array} - A copy of the elements.
+             */
+            public readFloat32Array(count: number): Float32Array;
+
+            /**
+             * Read count elements from the current read position into a new Float64Array, element endian follow the stream
+             *
+             * @param {number} count - Number of elements to read.
+             * @returns {Float64Array} - A copy of the elements.
+             */
+            public readFloat64Array(count: number): Float64Array;
+
+            /**
+             * Write every element of the Int8Array at the current write position, element endian follow the stream
+             *
+             * @param {Int8Array} value - The elements to write.
+             */
+            public writeInt8Array(value: Int8Array): void;
+
+            /**
+             * Write every element of the Uint16Array at the current write position, element endian follow the stream
+             *
+             * @param {Uint16Array} value - The elements to write.
+             */
+            public writeUint16Array(value: Uint16Array): void;
+
+            /**
+             * Write every element of the Int16Array at the current write position, element endian follow the stream
+             *
+             * @param {Int16Array} value - The elements to write.
+             */
+            public writeInt16Array(value: Int16Array): void;
+
+            /**
+             * Write every element of the Uint32Array at the current write position, element endian follow the stream
+             *
+             * @param {Uint32Array} value - The elements to write.
+             */
+            public writeUint32Array(value: Uint32Array): void;
+
+            /**
+             * Write every element of the Int32Array at the current write position, element endian follow the stream
+             *
+             * @param {Int32Array} value - The elements to write.
+             */
+            public writeInt32Array(value: Int32Array): void;
+
+            /**
+             * Write every element of the Float32Array at the current write position, element endian follow the stream
+             *
+             * @param {Float32Array} value - The elements to write.
+             */
+            public writeFloat32Array(value: Float32Array): void;
+
+            /**
+             * Write every element of the Float64Array at the current write position, element endian follow the stream
+             *
+             * @param {Float64Array} value - The elements to write.
+             */
+            public writeFloat64Array(value: Float64Array): void;
         }
 
         /**
@@ -1,5 +1,5 @@
 namespace Sen.Script.Support.Wwise.Media.Decode {
-    export function process(source: string, destination: string) {
+    export function program_path(): string {
         const operating_system = Kernel.OperatingSystem.current();
         assert(operating_system === "Windows" || operating_system === "macOS" || operating_system === "Linux", Kernel.Language.get("wwise.media.decode.unsupported_operating_system"));
         // const vgmstream_program_file_path = Script.Support.Wwise.Media.Common.search_path("vgmstream-cli");
@@ -8,9 +8,30 @@ namespace Sen.Script.Support.Wwise.Media.Decode {
         assert(Kernel.FileSystem.is_file(vgmstream_program_file_path), Kernel.Language.get("wwise.media.decode.cannot_find_third"));
         //  const fallback_temporary_path = `${Kernel.Process.get_path_environment("TEMP")}/wem`;
         //  Kernel.FileSystem.create_directory(fallback_temporary_path);
-        const command = `${vgmstream_program_file_path} -o "${destination}" "${source}"`;
-        const program_result = Kernel.Process.execute(command);
-        let regex_result = /^encoding: (.+)$/m.exec(program_result);
+        return vgmstream_program_file_path;
+    }
+
+    export function process(source: string, destination: string) {
+        const program_result = Kernel.Process.spawn([program_path(), "-o", destination, source]);
+        exchange_format(program_result);
+        return;
+    }
+
+    /**
+     * Decode every wem, the vgmstream processes run in parallel
+     * @param list source and destination of each wem
+     */
+
+    export function process_all(list: Array<[string, string]>) {
+        const vgmstream_program_file_path = program_path();
+        const result = Kernel.Process.spawn_all(list.map(([source, destination]) => [vgmstream_program_file_path, "-o", destination, source]));
+        result.forEach((program_result) => exchange_format(program_result));
+        return;
+    }
+
+    export function exchange_format(program_result: Kernel.Process.SpawnResult) {
+        assert(program_result.exit_code === 0n, program_result.error);
+        let regex_result = /^encoding: (.+)$/m.exec(program_result.output);
         assert(regex_result !== null);
         let encoding = regex_result![1];
         let format: null | Common.Format = null;
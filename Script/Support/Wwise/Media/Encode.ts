@@ -288,9 +288,10 @@ namespace Sen.Script.Support.Wwise.Media.Encode {
         const temporary_path = Home.query("~/../temporary");
         const wwise_project_dir = `${temporary_path}/Sample`;
         const wwise_wproj_file = `${wwise_project_dir}/Sample.wproj`;
-        const wwise_create_new_project_command = `WwiseConsole create-new-project "${wwise_wproj_file}" --platform "Android" "iOS"`;
+        // every encode share the same temporary project, so WwiseConsole is spawned one at a time
+        const wwise_create_new_project_command = [wwise_program_file_path!, "create-new-project", wwise_wproj_file, "--platform", "Android", "iOS"];
         while (true) {
-            Kernel.Process.execute(wwise_create_new_project_command);
+            Kernel.Process.spawn(wwise_create_new_project_command);
             if (Kernel.FileSystem.is_file(wwise_wproj_file)) {
                 break;
             }
@@ -323,9 +324,9 @@ namespace Sen.Script.Support.Wwise.Media.Encode {
             opus: "Android",
             wemopus: "Android",
         }[format];
-        const wwise_command = `WwiseConsole convert-external-source "${wwise_wproj_file}" --platform "${platform}" --source-file "${wwise_wsources_file}"`;
-        const process_result = Kernel.Process.execute(wwise_command);
-        const result_string_list = process_result.split("\n");
+        const wwise_command = [wwise_program_file_path!, "convert-external-source", wwise_wproj_file, "--platform", platform, "--source-file", wwise_wsources_file];
+        const process_result = Kernel.Process.spawn(wwise_command);
+        const result_string_list = process_result.output.split("\n");
         assert(result_string_list[result_string_list.length - 2] === "Process completed successfully.", Kernel.Language.get("wwise.media.encode.failed"))
         Kernel.FileSystem.Operation.remove(destination);
         Kernel.FileSystem.Operation.copy(`${wwise_project_dir}/GeneratedSoundBanks/${platform}/Sample.wem`, destination);
@@ -280,9 +280,38 @@ namespace Sen.Script {
 
     export function main(): void {
         const result: string = launch();
-        Console.error(result);
-        Console.finished(Kernel.Language.get("method_are_succeeded"));
-        Shell.callback(["finish"]);
+        finish(result);
+        return;
+    }
+
+    /**
+     * --------------------------------------------------
+     * Host mode: load the modules and the setting once,
+     * the kernel then call run_job for every job
+     * @returns
+     * --------------------------------------------------
+     */
+
+    export function initialize(): void {
+        setup();
+        return;
+    }
+
+    /**
+     * --------------------------------------------------
+     * Host mode: run one job on the already loaded modules
+     * @returns
+     * --------------------------------------------------
+     */
+
+    export function run_job(): void {
+        let result: string = undefined!;
+        try {
+            forward();
+        } catch (e: any) {
+            result = Exception.make_exception(e);
+        }
+        finish(result);
         return;
     }
 
@@ -296,20 +325,59 @@ namespace Sen.Script {
     export function launch(): string {
         let result: string = undefined!;
         try {
-            const args = Kernel.arguments();
-            args.splice(0, 3);
-            Home.setup();
-            Module.load();
-            Console.send(`Sen ~ Shell: ${Shell.version()} & Kernel: ${Kernel.version()} & Script: ${version} ~ ${Kernel.OperatingSystem.current()} & ${Kernel.OperatingSystem.architecture()}`);
-            Setting.load();
-            Console.finished(Kernel.Language.get("current_status"), format(Kernel.Language.get("js.environment_has_been_loaded"), 1n, 1n, Module.script_list.length + 1));
-            Executor.forward({ source: args });
+            setup();
+            forward();
         } catch (e: any) {
             result = Exception.make_exception(e);
         }
         return result;
     }
 
+    /**
+     * --------------------------------------------------
+     * Load every module and the setting
+     * @returns
+     * --------------------------------------------------
+     */
+
+    export function setup(): void {
+        Home.setup();
+        Module.load();
+        Console.send(`Sen ~ Shell: ${Shell.version()} & Kernel: ${Kernel.version()} & Script: ${version} ~ ${Kernel.OperatingSystem.current()} & ${Kernel.OperatingSystem.architecture()}`);
+        Setting.load();
+        Console.finished(Kernel.Language.get("current_status"), format(Kernel.Language.get("js.environment_has_been_loaded"), 1n, 1n, Module.script_list.length + 1));
+        return;
+    }
+
+    /**
+     * --------------------------------------------------
+     * Forward the current arguments to the executor
+     * @returns
+     * --------------------------------------------------
+     */
+
+    export function forward(): void {
+        const args = Kernel.arguments();
+        args.splice(0, 3);
+        Executor.forward({ source: args });
+        return;
+    }
+
+    /**
+     * --------------------------------------------------
+     * Report the result of a job to the shell
+     * @param result - exception message, undefined on success
+     * @returns
+     * --------------------------------------------------
+     */
+
+    export function finish(result: string): void {
+        Console.error(result);
+        Console.finished(Kernel.Language.get("method_are_succeeded"));
+        Shell.callback(["finish"]);
+        return;
+    }
+
     /**
      * JavaScript Modules
      */
@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <cstdint>
 #include <regex>
 #include <version>
@@ -101,6 +102,24 @@ char* copy = new char[1];
 typedef int (*execute)
 (CStringView* script, CStringList* argument, ShellCallback m_callback);
 
+typedef int (*initialize)
+(CStringView* script, CStringList* argument, ShellCallback m_callback);
+
+typedef int (*run)
+(CStringList* argument);
+
+typedef int (*finalize)
+();
+
+// host mode: one job per stdin line, arguments separated by a tab
+// every job is acknowledged on stdout by the terminator followed by its result code
+
+#define HOST_ARGUMENT "--host"
+
+#define HOST_JOB_SEPARATOR '\t'
+
+#define HOST_JOB_TERMINATOR "\x1e"
+
 #define assert_conditional(condition, message) \
 	if(!(condition)) {\
 		throw std::runtime_error(message); \
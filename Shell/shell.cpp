@@ -41,6 +41,71 @@ MAIN_FUNCTION
             Console::print("Kernel cannot be loaded", "", Sen::Shell::Interactive::Color::RED);
             return 1;
         }
+        #if WINDOWS
+            auto program = Sen::Shell::utf16_to_utf8(argc[0]);
+            auto is_host = size >= 4 && Sen::Shell::utf16_to_utf8(argc[3]) == HOST_ARGUMENT;
+        #else
+            auto program = std::string{argc[0]};
+            auto is_host = size >= 4 && std::string_view{argc[3]} == HOST_ARGUMENT;
+        #endif
+        if (is_host) {
+            #if WIN32
+                auto initialize_method = (initialize)GetProcAddress(hinstLib, "initialize");
+                auto run_method = (run)GetProcAddress(hinstLib, "run");
+                auto finalize_method = (finalize)GetProcAddress(hinstLib, "finalize");
+            #else
+                auto initialize_method = (initialize)dlsym(hinstLib, "initialize");
+                auto run_method = (run)dlsym(hinstLib, "run");
+                auto finalize_method = (finalize)dlsym(hinstLib, "finalize");
+            #endif
+            if (initialize_method == nullptr || run_method == nullptr || finalize_method == nullptr) {
+                Console::print("Method not found", "", Sen::Shell::Interactive::Color::RED);
+                #if WINDOWS
+                        FreeLibrary(hinstLib);
+                #else
+                        dlclose(hinstLib);
+                #endif
+                return 1;
+            }
+            auto make_argument_list = [&](const std::vector<std::string>& job) -> std::vector<CStringView> {
+                auto destination = std::vector<CStringView>{};
+                destination.emplace_back(program.size(), program.data());
+                destination.emplace_back(kernel.size(), kernel.data());
+                destination.emplace_back(script.size(), script.data());
+                for (auto& e : job) {
+                    destination.emplace_back(e.size(), e.data());
+                }
+                return destination;
+            };
+            auto script_pointer = std::make_unique<CStringView>(script.size(), script.data());
+            auto arguments = make_argument_list({});
+            auto argument_list = CStringList{ .value = arguments.data(), .size = arguments.size() };
+            result = initialize_method(script_pointer.get(), &argument_list, callback);
+            if (result == 0) {
+                auto line = std::string{};
+                while (std::getline(std::cin, line) && !line.empty()) {
+                    if (line.back() == '\r') {
+                        line.pop_back();
+                    }
+                    auto job = std::vector<std::string>{};
+                    auto stream = std::istringstream{ line };
+                    for (auto e = std::string{}; std::getline(stream, e, HOST_JOB_SEPARATOR);) {
+                        job.emplace_back(e);
+                    }
+                    auto job_arguments = make_argument_list(job);
+                    auto job_list = CStringList{ .value = job_arguments.data(), .size = job_arguments.size() };
+                    auto job_result = run_method(&job_list);
+                    std::cout << HOST_JOB_TERMINATOR << job_result << '\n' << std::flush;
+                }
+            }
+            finalize_method();
+            #if WIN32
+                FreeLibrary(hinstLib);
+            #else
+                dlclose(hinstLib);
+            #endif
+            return result;
+        }
         #if WIN32
             auto execute_method = (execute)GetProcAddress(hinstLib, "execute");
         #else